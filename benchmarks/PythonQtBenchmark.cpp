@@ -0,0 +1,258 @@
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtBenchmark.cpp
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtBenchmark.h"
+#include "PythonQtConversion.h"
+
+#include <QDir>
+#include <QFile>
+
+void PythonQtBenchmark::initTestCase()
+{
+  _helper = new PythonQtBenchmarkHelper;
+  _main = PythonQt::self()->getMainModule();
+  _main.evalScript("import sys\nimport PythonQt\n");
+  PythonQt::self()->addObject(_main, "obj", _helper);
+
+  // arguments of the slot calls
+  _main.evalScript("color = PythonQt.QtGui.QColor(1,2,3)\n"
+                   "size = PythonQt.QtCore.QSize(1,2)\n"
+                   "intList = list(range(100))\n"
+                   "stringList = [str(i) for i in range(100)]\n"
+                   "variantList = [i if i % 2 else str(i) for i in range(100)]\n"
+                   "sizeList = [PythonQt.QtCore.QSize(i,i) for i in range(100)]\n");
+
+  // the signal handler of the signal dispatch benchmark
+  _main.evalScript("def intSignalHandler(value):\n  pass\n");
+  PythonQt::self()->addSignalHandler(_helper, SIGNAL(intSignal(int)), _main, "intSignalHandler");
+
+  // modules for the import benchmarks, one in a directory and one in the resources
+  PythonQt::self()->installDefaultImporter();
+  QDir dir(QDir::tempPath());
+  dir.mkpath("PythonQtBenchmark");
+  dir.cd("PythonQtBenchmark");
+  _moduleDir = dir.absolutePath();
+  QFile file(dir.absoluteFilePath("pqbenchmark_file.py"));
+  if (file.open(QIODevice::WriteOnly)) {
+    file.write("value = 42\n\ndef add(x):\n  return x + value\n");
+    file.close();
+  }
+  PythonQt::self()->addSysPath(_moduleDir);
+  PythonQt::self()->addSysPath(":/benchmark");
+}
+
+void PythonQtBenchmark::cleanupTestCase()
+{
+  PythonQt::self()->removeSignalHandler(_helper, SIGNAL(intSignal(int)), _main, "intSignalHandler");
+  QDir dir(_moduleDir);
+  dir.remove("pqbenchmark_file.py");
+  dir.remove("pqbenchmark_file.pyc");
+  delete _helper;
+  _helper = NULL;
+}
+
+void PythonQtBenchmark::benchmarkStatement(const QString& statement)
+{
+  _main.evalScript("def benchmarkStatement():\n  for i in range(1000):\n    " + statement + "\n");
+  PythonQtObjectPtr callable = PythonQt::self()->lookupCallable(_main, "benchmarkStatement");
+  QVERIFY(callable);
+  PythonQt::self()->clearError();
+
+  // each iteration executes the statement 1000 times
+  QBENCHMARK {
+    PythonQt::self()->call(callable);
+  }
+  QVERIFY(!PythonQt::self()->hadError());
+}
+
+void PythonQtBenchmark::benchmarkSlotCalls_data()
+{
+  QTest::addColumn<QString>("statement");
+  QTest::newRow("no arguments") << "obj.noArgs()";
+  QTest::newRow("int") << "obj.getInt(42)";
+  QTest::newRow("double") << "obj.getDouble(42.5)";
+  QTest::newRow("bool") << "obj.getBool(True)";
+  QTest::newRow("QString") << "obj.getQString('hello')";
+  QTest::newRow("QByteArray") << "obj.getQByteArray(b'hello')";
+  QTest::newRow("QVariant") << "obj.getQVariant(42)";
+  QTest::newRow("QObject*") << "obj.getQObject(obj)";
+  QTest::newRow("QColor") << "obj.getQColor(color)";
+  QTest::newRow("QSize") << "obj.getQSize(size)";
+}
+
+void PythonQtBenchmark::benchmarkSlotCalls()
+{
+  QFETCH(QString, statement);
+  benchmarkStatement(statement);
+}
+
+void PythonQtBenchmark::benchmarkSpecializedConverters_data()
+{
+  QTest::addColumn<QString>("statement");
+  QTest::addColumn<bool>("specialized");
+  QTest::newRow("int, generic") << "obj.getInt(42)" << false;
+  QTest::newRow("int, specialized") << "obj.getInt(42)" << true;
+  QTest::newRow("double, generic") << "obj.getDouble(42.5)" << false;
+  QTest::newRow("double, specialized") << "obj.getDouble(42.5)" << true;
+  QTest::newRow("QString, generic") << "obj.getQString('hello')" << false;
+  QTest::newRow("QString, specialized") << "obj.getQString('hello')" << true;
+  QTest::newRow("QObject*, generic") << "obj.getQObject(obj)" << false;
+  QTest::newRow("QObject*, specialized") << "obj.getQObject(obj)" << true;
+}
+
+void PythonQtBenchmark::benchmarkSpecializedConverters()
+{
+  QFETCH(QString, statement);
+  QFETCH(bool, specialized);
+  // compare the specialized converters with the generic ConvertPythonToQt()/ConvertQtValueToPython() path
+  PythonQtConv::setSpecializedConvertersEnabled(specialized);
+  benchmarkStatement(statement);
+  PythonQtConv::setSpecializedConvertersEnabled(true);
+}
+
+void PythonQtBenchmark::benchmarkOverloadedCalls_data()
+{
+  QTest::addColumn<QString>("statement");
+  QTest::newRow("int") << "obj.overload(42)";
+  QTest::newRow("double") << "obj.overload(42.5)";
+  QTest::newRow("QString") << "obj.overload('hello')";
+  QTest::newRow("QObject*") << "obj.overload(obj)";
+}
+
+void PythonQtBenchmark::benchmarkOverloadedCalls()
+{
+  QFETCH(QString, statement);
+  benchmarkStatement(statement);
+}
+
+void PythonQtBenchmark::benchmarkProperties_data()
+{
+  QTest::addColumn<QString>("statement");
+  QTest::newRow("get int") << "obj.intProp";
+  QTest::newRow("set int") << "obj.intProp = i";
+  QTest::newRow("get QString") << "obj.stringProp";
+  QTest::newRow("set QString") << "obj.stringProp = 'hello'";
+}
+
+void PythonQtBenchmark::benchmarkProperties()
+{
+  QFETCH(QString, statement);
+  benchmarkStatement(statement);
+}
+
+void PythonQtBenchmark::benchmarkWrapping_data()
+{
+  QTest::addColumn<QString>("statement");
+  // the returned wrappers are deleted right away, so each call creates a new wrapper
+  QTest::newRow("QObject") << "obj.child(i)";
+  QTest::newRow("value type") << "obj.newQSize(i)";
+}
+
+void PythonQtBenchmark::benchmarkWrapping()
+{
+  QFETCH(QString, statement);
+  benchmarkStatement(statement);
+}
+
+void PythonQtBenchmark::benchmarkContainers_data()
+{
+  // all lists have 100 elements
+  QTest::addColumn<QString>("statement");
+  QTest::newRow("QList<int>") << "obj.getQListInt(intList)";
+  QTest::newRow("QStringList") << "obj.getQStringList(stringList)";
+  QTest::newRow("QVariantList") << "obj.getQVariantList(variantList)";
+  QTest::newRow("QList<QSize>") << "obj.getQListQSize(sizeList)";
+  QTest::newRow("QList<QObject*>") << "obj.getQObjectList()";
+}
+
+void PythonQtBenchmark::benchmarkContainers()
+{
+  QFETCH(QString, statement);
+  benchmarkStatement(statement);
+}
+
+void PythonQtBenchmark::benchmarkSignalDispatch()
+{
+  PythonQt::self()->clearError();
+  // each iteration emits the signal 1000 times
+  QBENCHMARK {
+    for (int i = 0; i < 1000; i++) {
+      _helper->emitIntSignal(i);
+    }
+  }
+  QVERIFY(!PythonQt::self()->hadError());
+}
+
+void PythonQtBenchmark::benchmarkEvalScript_data()
+{
+  QTest::addColumn<QString>("script");
+  QTest::addColumn<int>("start");
+  QTest::newRow("expression") << "1 + 2" << int(Py_eval_input);
+  QTest::newRow("statements") << "x = 1\ny = x + 2\n" << int(Py_file_input);
+}
+
+void PythonQtBenchmark::benchmarkEvalScript()
+{
+  QFETCH(QString, script);
+  QFETCH(int, start);
+  PythonQt::self()->clearError();
+  // each iteration evaluates the script 1000 times
+  QBENCHMARK {
+    for (int i = 0; i < 1000; i++) {
+      _main.evalScript(script, start);
+    }
+  }
+  QVERIFY(!PythonQt::self()->hadError());
+}
+
+void PythonQtBenchmark::benchmarkImport_data()
+{
+  QTest::addColumn<QString>("module");
+  QTest::newRow("QFile") << "pqbenchmark_file";
+  QTest::newRow("resource") << "pqbenchmark_resource";
+}
+
+void PythonQtBenchmark::benchmarkImport()
+{
+  QFETCH(QString, module);
+  // remove the module from sys.modules, so that it is really imported again
+  benchmarkStatement("sys.modules.pop('" + module + "', None)\n    __import__('" + module + "')");
+}
@@ -0,0 +1,148 @@
+#ifndef _PYTHONQTBENCHMARK_H
+#define _PYTHONQTBENCHMARK_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtBenchmark.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQt.h"
+#include <QtTest/QtTest>
+#include <QVariant>
+#include <QColor>
+#include <QSize>
+#include <QStringList>
+
+class PythonQtBenchmarkHelper;
+
+//! measures the call overhead of the binding layer, run with -xml or -csv to get machine readable results
+class PythonQtBenchmark : public QObject
+{
+  Q_OBJECT
+
+private Q_SLOTS:
+  void initTestCase();
+  void cleanupTestCase();
+
+  void benchmarkSlotCalls_data();
+  void benchmarkSlotCalls();
+  void benchmarkSpecializedConverters_data();
+  void benchmarkSpecializedConverters();
+  void benchmarkOverloadedCalls_data();
+  void benchmarkOverloadedCalls();
+  void benchmarkProperties_data();
+  void benchmarkProperties();
+  void benchmarkWrapping_data();
+  void benchmarkWrapping();
+  void benchmarkContainers_data();
+  void benchmarkContainers();
+  void benchmarkSignalDispatch();
+  void benchmarkEvalScript_data();
+  void benchmarkEvalScript();
+  void benchmarkImport_data();
+  void benchmarkImport();
+
+private:
+  //! runs the given Python statement 1000 times per benchmark iteration
+  void benchmarkStatement(const QString& statement);
+
+  PythonQtBenchmarkHelper* _helper;
+  PythonQtObjectPtr _main;
+  QString _moduleDir;
+};
+
+//! the object that is called by the benchmarks (available as "obj" in Python)
+class PythonQtBenchmarkHelper : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY(int intProp READ intProp WRITE setIntProp)
+  Q_PROPERTY(QString stringProp READ stringProp WRITE setStringProp)
+
+public:
+  PythonQtBenchmarkHelper() {
+    _intProp = 0;
+    for (int i = 0; i < 100; i++) {
+      _objects << new QObject(this);
+    }
+  }
+
+  int intProp() const { return _intProp; }
+  void setIntProp(int value) { _intProp = value; }
+
+  QString stringProp() const { return _stringProp; }
+  void setStringProp(const QString& value) { _stringProp = value; }
+
+  void emitIntSignal(int value) { emit intSignal(value); }
+
+public Q_SLOTS:
+  void noArgs() {}
+  int getInt(int value) { return value; }
+  double getDouble(double value) { return value; }
+  bool getBool(bool value) { return value; }
+  QString getQString(const QString& value) { return value; }
+  QByteArray getQByteArray(const QByteArray& value) { return value; }
+  QVariant getQVariant(const QVariant& value) { return value; }
+  QObject* getQObject(QObject* value) { return value; }
+  QColor getQColor(const QColor& value) { return value; }
+  QSize getQSize(const QSize& value) { return value; }
+
+  int overload(int value) { return value; }
+  double overload(double value) { return value; }
+  QString overload(const QString& value) { return value; }
+  QObject* overload(QObject* value) { return value; }
+
+  QObject* child(int index) { return _objects.at(index % _objects.size()); }
+  QSize newQSize(int width) { return QSize(width, 1); }
+
+  QList<int> getQListInt(const QList<int>& list) { return list; }
+  QStringList getQStringList(const QStringList& list) { return list; }
+  QVariantList getQVariantList(const QVariantList& list) { return list; }
+  QList<QSize> getQListQSize(const QList<QSize>& list) { return list; }
+  QList<QObject*> getQObjectList() { return _objects; }
+
+Q_SIGNALS:
+  void intSignal(int value);
+
+private:
+  int _intProp;
+  QString _stringProp;
+  QList<QObject*> _objects;
+};
+
+#endif
@@ -0,0 +1,29 @@
+# --------- PythonQtBenchmark profile -------------------
+# Last changed by $Author: florian $
+# --------------------------------------------------
+TARGET   = PythonQtBenchmark
+TEMPLATE = app
+
+DESTDIR    = ../lib
+
+QT += testlib
+
+contains(QT_MAJOR_VERSION, 5) {
+  QT += widgets
+}
+
+include ( ../build/common.prf )
+include ( ../build/PythonQt.prf )
+
+HEADERS +=                    \
+  PythonQtBenchmark.h
+
+SOURCES +=                    \
+  PythonQtBenchmarkMain.cpp   \
+  PythonQtBenchmark.cpp
+
+OTHER_FILES +=                \
+  pqbenchmark_resource.py
+
+RESOURCES +=                  \
+  PythonQtBenchmark.qrc
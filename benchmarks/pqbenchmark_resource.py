@@ -0,0 +1,4 @@
+value = 42
+
+def add(x):
+  return x + value
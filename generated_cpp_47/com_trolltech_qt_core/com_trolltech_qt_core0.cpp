@@ -43,9 +43,12 @@
 void PythonQtShell_QAbstractAnimation::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -60,9 +63,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -77,9 +83,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractAnimation::duration() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "duration");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("duration");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("duration");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -105,9 +114,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractAnimation::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -133,9 +145,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractAnimation::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -161,9 +176,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -178,9 +196,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::updateCurrentTime(int  currentTime)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&currentTime};
@@ -195,9 +216,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::updateDirection(QAbstractAnimation::Direction  direction)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateDirection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateDirection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateDirection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::Direction"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&direction};
@@ -212,9 +236,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::updateState(QAbstractAnimation::State  newState, QAbstractAnimation::State  oldState)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::State" , "QAbstractAnimation::State"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&newState, (void*)&oldState};
@@ -300,9 +327,12 @@ void PythonQtWrapper_QAbstractAnimation::updateState(QAbstractAnimation* theWrap
 QModelIndex  PythonQtShell_QAbstractItemModel::buddy(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "buddy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("buddy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("buddy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QModelIndex returnValue;
@@ -328,9 +358,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::canFetchMore(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "canFetchMore");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("canFetchMore");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("canFetchMore");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -356,9 +389,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -373,9 +409,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemModel::columnCount(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -401,9 +440,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -418,9 +460,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractItemModel::data(const QModelIndex&  index, int  role) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "data");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("data");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("data");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QModelIndex&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QVariant returnValue;
@@ -446,9 +491,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::dropMimeData(const QMimeData*  data, Qt::DropAction  action, int  row, int  column, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropMimeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropMimeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropMimeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QMimeData*" , "Qt::DropAction" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       bool returnValue;
@@ -474,9 +522,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -502,9 +553,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -530,9 +584,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::fetchMore(const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fetchMore");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fetchMore");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fetchMore");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&parent};
@@ -547,9 +604,12 @@ if (_wrapper) {
 Qt::ItemFlags  PythonQtShell_QAbstractItemModel::flags(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "flags");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("flags");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("flags");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"Qt::ItemFlags" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       Qt::ItemFlags returnValue;
@@ -575,9 +635,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::hasChildren(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasChildren");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasChildren");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasChildren");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -603,9 +666,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractItemModel::headerData(int  section, Qt::Orientation  orientation, int  role) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "headerData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("headerData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("headerData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "int" , "Qt::Orientation" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QVariant returnValue;
@@ -631,9 +697,12 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemModel::index(int  row, int  column, const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "index");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("index");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("index");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QModelIndex returnValue;
@@ -659,9 +728,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::insertColumns(int  column, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "insertColumns");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("insertColumns");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("insertColumns");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -687,9 +759,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::insertRows(int  row, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "insertRows");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("insertRows");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("insertRows");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -715,9 +790,12 @@ if (_wrapper) {
 QMap<int , QVariant >  PythonQtShell_QAbstractItemModel::itemData(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "itemData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("itemData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("itemData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QMap<int , QVariant >" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QMap<int , QVariant > returnValue;
@@ -743,9 +821,12 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractItemModel::match(const QModelIndex&  start, int  role, const QVariant&  value, int  hits, Qt::MatchFlags  flags) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "match");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("match");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("match");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QList<QModelIndex >" , "const QModelIndex&" , "int" , "const QVariant&" , "int" , "Qt::MatchFlags"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       QList<QModelIndex > returnValue;
@@ -771,9 +852,12 @@ if (_wrapper) {
 QMimeData*  PythonQtShell_QAbstractItemModel::mimeData(const QList<QModelIndex >&  indexes) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mimeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mimeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mimeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QMimeData*" , "const QList<QModelIndex >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QMimeData* returnValue;
@@ -799,9 +883,12 @@ if (_wrapper) {
 QStringList  PythonQtShell_QAbstractItemModel::mimeTypes() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mimeTypes");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mimeTypes");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mimeTypes");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStringList"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QStringList returnValue;
@@ -827,9 +914,12 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemModel::parent(const QModelIndex&  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QModelIndex returnValue;
@@ -855,9 +945,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::removeColumns(int  column, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "removeColumns");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("removeColumns");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("removeColumns");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -883,9 +976,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::removeRows(int  row, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "removeRows");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("removeRows");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("removeRows");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -911,9 +1007,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::revert()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "revert");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("revert");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("revert");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -928,9 +1027,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemModel::rowCount(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -956,9 +1058,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::setData(const QModelIndex&  index, const QVariant&  value, int  role)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&" , "const QVariant&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -984,9 +1089,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::setHeaderData(int  section, Qt::Orientation  orientation, const QVariant&  value, int  role)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setHeaderData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setHeaderData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setHeaderData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "Qt::Orientation" , "const QVariant&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -1012,9 +1120,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::setItemData(const QModelIndex&  index, const QMap<int , QVariant >&  roles)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setItemData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setItemData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setItemData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&" , "const QMap<int , QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1040,9 +1151,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::sort(int  column, Qt::SortOrder  order)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sort");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sort");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sort");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int" , "Qt::SortOrder"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&column, (void*)&order};
@@ -1057,9 +1171,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractItemModel::span(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "span");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("span");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("span");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QSize returnValue;
@@ -1085,9 +1202,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::submit()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "submit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("submit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("submit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1113,9 +1233,12 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractItemModel::supportedDropActions() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "supportedDropActions");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("supportedDropActions");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("supportedDropActions");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"Qt::DropActions"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       Qt::DropActions returnValue;
@@ -1141,9 +1264,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1319,9 +1445,12 @@ Qt::DropActions  PythonQtWrapper_QAbstractItemModel::supportedDropActions(QAbstr
 QModelIndex  PythonQtShell_QAbstractListModel::buddy(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "buddy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("buddy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("buddy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QModelIndex returnValue;
@@ -1347,9 +1476,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::canFetchMore(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "canFetchMore");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("canFetchMore");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("canFetchMore");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1375,9 +1507,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1392,9 +1527,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1409,9 +1547,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractListModel::data(const QModelIndex&  index, int  role) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "data");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("data");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("data");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QModelIndex&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QVariant returnValue;
@@ -1437,9 +1578,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::dropMimeData(const QMimeData*  data, Qt::DropAction  action, int  row, int  column, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropMimeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropMimeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropMimeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QMimeData*" , "Qt::DropAction" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       bool returnValue;
@@ -1465,9 +1609,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1493,9 +1640,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1521,9 +1671,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::fetchMore(const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fetchMore");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fetchMore");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fetchMore");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&parent};
@@ -1538,9 +1691,12 @@ if (_wrapper) {
 Qt::ItemFlags  PythonQtShell_QAbstractListModel::flags(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "flags");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("flags");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("flags");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"Qt::ItemFlags" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       Qt::ItemFlags returnValue;
@@ -1566,9 +1722,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractListModel::headerData(int  section, Qt::Orientation  orientation, int  role) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "headerData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("headerData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("headerData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "int" , "Qt::Orientation" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QVariant returnValue;
@@ -1594,9 +1753,12 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractListModel::index(int  row, int  column, const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "index");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("index");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("index");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QModelIndex returnValue;
@@ -1622,9 +1784,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::insertColumns(int  column, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "insertColumns");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("insertColumns");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("insertColumns");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1650,9 +1815,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::insertRows(int  row, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "insertRows");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("insertRows");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("insertRows");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1678,9 +1846,12 @@ if (_wrapper) {
 QMap<int , QVariant >  PythonQtShell_QAbstractListModel::itemData(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "itemData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("itemData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("itemData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QMap<int , QVariant >" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QMap<int , QVariant > returnValue;
@@ -1706,9 +1877,12 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractListModel::match(const QModelIndex&  start, int  role, const QVariant&  value, int  hits, Qt::MatchFlags  flags) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "match");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("match");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("match");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QList<QModelIndex >" , "const QModelIndex&" , "int" , "const QVariant&" , "int" , "Qt::MatchFlags"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       QList<QModelIndex > returnValue;
@@ -1734,9 +1908,12 @@ if (_wrapper) {
 QMimeData*  PythonQtShell_QAbstractListModel::mimeData(const QList<QModelIndex >&  indexes) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mimeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mimeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mimeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QMimeData*" , "const QList<QModelIndex >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QMimeData* returnValue;
@@ -1762,9 +1939,12 @@ if (_wrapper) {
 QStringList  PythonQtShell_QAbstractListModel::mimeTypes() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mimeTypes");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mimeTypes");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mimeTypes");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStringList"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QStringList returnValue;
@@ -1790,9 +1970,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::removeColumns(int  column, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "removeColumns");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("removeColumns");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("removeColumns");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1818,9 +2001,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::removeRows(int  row, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "removeRows");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("removeRows");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("removeRows");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1846,9 +2032,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::revert()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "revert");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("revert");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("revert");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -1863,9 +2052,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractListModel::rowCount(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -1891,9 +2083,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::setData(const QModelIndex&  index, const QVariant&  value, int  role)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&" , "const QVariant&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1919,9 +2114,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::setHeaderData(int  section, Qt::Orientation  orientation, const QVariant&  value, int  role)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setHeaderData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setHeaderData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setHeaderData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "Qt::Orientation" , "const QVariant&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -1947,9 +2145,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::setItemData(const QModelIndex&  index, const QMap<int , QVariant >&  roles)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setItemData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setItemData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setItemData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&" , "const QMap<int , QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1975,9 +2176,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::sort(int  column, Qt::SortOrder  order)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sort");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sort");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sort");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int" , "Qt::SortOrder"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&column, (void*)&order};
@@ -1992,9 +2196,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractListModel::span(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "span");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("span");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("span");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QSize returnValue;
@@ -2020,9 +2227,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::submit()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "submit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("submit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("submit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -2048,9 +2258,12 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractListModel::supportedDropActions() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "supportedDropActions");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("supportedDropActions");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("supportedDropActions");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"Qt::DropActions"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       Qt::DropActions returnValue;
@@ -2076,9 +2289,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2109,9 +2325,12 @@ QModelIndex  PythonQtWrapper_QAbstractListModel::index(QAbstractListModel* theWr
 void PythonQtShell_QAbstractState::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2126,9 +2345,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractState::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2143,9 +2365,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractState::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2171,9 +2396,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractState::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2199,9 +2427,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractState::onEntry(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onEntry");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onEntry");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onEntry");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2216,9 +2447,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractState::onExit(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onExit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onExit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onExit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2233,9 +2467,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractState::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2267,9 +2504,12 @@ QState*  PythonQtWrapper_QAbstractState::parentState(QAbstractState* theWrappedO
 void PythonQtShell_QAbstractTransition::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2284,9 +2524,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTransition::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2301,9 +2544,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTransition::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2329,9 +2575,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTransition::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2357,9 +2606,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTransition::eventTest(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventTest");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventTest");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventTest");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2385,9 +2637,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTransition::onTransition(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onTransition");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onTransition");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onTransition");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2402,9 +2657,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTransition::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2475,9 +2733,12 @@ QList<QAbstractState* >  PythonQtWrapper_QAbstractTransition::targetStates(QAbst
 void PythonQtShell_QAnimationGroup::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2492,9 +2753,12 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2509,9 +2773,12 @@ if (_wrapper) {
 int  PythonQtShell_QAnimationGroup::duration() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "duration");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("duration");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("duration");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -2537,9 +2804,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAnimationGroup::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2565,9 +2835,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAnimationGroup::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2593,9 +2866,12 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2610,9 +2886,12 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::updateCurrentTime(int  currentTime)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&currentTime};
@@ -2627,9 +2906,12 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::updateDirection(QAbstractAnimation::Direction  direction)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateDirection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateDirection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateDirection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::Direction"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&direction};
@@ -2644,9 +2926,12 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::updateState(QAbstractAnimation::State  newState, QAbstractAnimation::State  oldState)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::State" , "QAbstractAnimation::State"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&newState, (void*)&oldState};
@@ -2738,9 +3023,12 @@ int  PythonQtWrapper_QBasicTimer::timerId(QBasicTimer* theWrappedObject) const
 bool  PythonQtShell_QBuffer::atEnd() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "atEnd");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("atEnd");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("atEnd");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -2766,9 +3054,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::bytesAvailable() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesAvailable");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesAvailable");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesAvailable");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -2794,9 +3085,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::bytesToWrite() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesToWrite");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesToWrite");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesToWrite");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -2822,9 +3116,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::canReadLine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "canReadLine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("canReadLine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("canReadLine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -2850,9 +3147,12 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2867,9 +3167,12 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::close()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "close");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("close");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("close");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2884,9 +3187,12 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2901,9 +3207,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2929,9 +3238,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2957,9 +3269,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::isSequential() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isSequential");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isSequential");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isSequential");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -2985,9 +3300,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::open(QIODevice::OpenMode  openMode)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "open");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("open");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("open");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QIODevice::OpenMode"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3013,9 +3331,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::pos() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pos");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pos");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pos");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -3041,9 +3362,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::readData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -3069,9 +3393,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::readLineData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readLineData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readLineData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readLineData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -3097,9 +3424,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3125,9 +3455,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::seek(qint64  off)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "seek");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("seek");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("seek");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3153,9 +3486,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::size() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "size");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("size");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("size");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -3181,9 +3517,12 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3198,9 +3537,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::waitForBytesWritten(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForBytesWritten");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForBytesWritten");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForBytesWritten");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3226,9 +3568,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::waitForReadyRead(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForReadyRead");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForReadyRead");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForReadyRead");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3254,9 +3599,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::writeData(const char*  data, qint64  len)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "writeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("writeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("writeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "const char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -3411,9 +3759,12 @@ bool  PythonQtWrapper_QChildEvent::removed(QChildEvent* theWrappedObject) const
 void PythonQtShell_QCoreApplication::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3428,9 +3779,12 @@ if (_wrapper) {
 void PythonQtShell_QCoreApplication::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3445,9 +3799,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCoreApplication::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3473,9 +3830,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCoreApplication::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3501,9 +3861,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCoreApplication::notify(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "notify");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("notify");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("notify");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3529,9 +3892,12 @@ if (_wrapper) {
 void PythonQtShell_QCoreApplication::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4422,9 +4788,12 @@ QString PythonQtWrapper_QEvent::py_toString(QEvent* obj) {
 void PythonQtShell_QEventLoop::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4439,9 +4808,12 @@ if (_wrapper) {
 void PythonQtShell_QEventLoop::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4456,9 +4828,12 @@ if (_wrapper) {
 bool  PythonQtShell_QEventLoop::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4484,9 +4859,12 @@ if (_wrapper) {
 bool  PythonQtShell_QEventLoop::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -4512,9 +4890,12 @@ if (_wrapper) {
 void PythonQtShell_QEventLoop::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4565,9 +4946,12 @@ void PythonQtWrapper_QEventLoop::wakeUp(QEventLoop* theWrappedObject)
 void PythonQtShell_QEventTransition::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4582,9 +4966,12 @@ if (_wrapper) {
 void PythonQtShell_QEventTransition::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4599,9 +4986,12 @@ if (_wrapper) {
 bool  PythonQtShell_QEventTransition::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4627,9 +5017,12 @@ if (_wrapper) {
 bool  PythonQtShell_QEventTransition::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -4655,9 +5048,12 @@ if (_wrapper) {
 bool  PythonQtShell_QEventTransition::eventTest(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventTest");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventTest");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventTest");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4683,9 +5079,12 @@ if (_wrapper) {
 void PythonQtShell_QEventTransition::onTransition(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onTransition");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onTransition");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onTransition");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -4700,9 +5099,12 @@ if (_wrapper) {
 void PythonQtShell_QEventTransition::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4762,9 +5164,12 @@ void PythonQtWrapper_QEventTransition::setEventType(QEventTransition* theWrapped
 QStringList  PythonQtShell_QFactoryInterface::keys() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keys");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keys");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keys");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStringList"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QStringList returnValue;
@@ -4796,9 +5201,12 @@ return new PythonQtShell_QFactoryInterface(); }
 bool  PythonQtShell_QFile::atEnd() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "atEnd");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("atEnd");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("atEnd");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -4824,9 +5232,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::bytesAvailable() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesAvailable");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesAvailable");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesAvailable");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -4852,9 +5263,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::bytesToWrite() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesToWrite");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesToWrite");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesToWrite");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -4880,9 +5294,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::canReadLine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "canReadLine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("canReadLine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("canReadLine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -4908,9 +5325,12 @@ if (_wrapper) {
 void PythonQtShell_QFile::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4925,9 +5345,12 @@ if (_wrapper) {
 void PythonQtShell_QFile::close()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "close");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("close");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("close");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -4942,9 +5365,12 @@ if (_wrapper) {
 void PythonQtShell_QFile::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4959,9 +5385,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4987,9 +5416,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -5015,9 +5447,12 @@ if (_wrapper) {
 QAbstractFileEngine*  PythonQtShell_QFile::fileEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fileEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fileEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fileEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAbstractFileEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAbstractFileEngine* returnValue;
@@ -5043,9 +5478,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::isSequential() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isSequential");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isSequential");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isSequential");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -5071,9 +5509,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::open(QIODevice::OpenMode  flags)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "open");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("open");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("open");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QIODevice::OpenMode"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5099,9 +5540,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::pos() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pos");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pos");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pos");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -5127,9 +5571,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::readData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -5155,9 +5602,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::readLineData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readLineData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readLineData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readLineData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -5183,9 +5633,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -5211,9 +5664,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::seek(qint64  offset)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "seek");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("seek");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("seek");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5239,9 +5695,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::size() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "size");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("size");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("size");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -5267,9 +5726,12 @@ if (_wrapper) {
 void PythonQtShell_QFile::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5284,9 +5746,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::waitForBytesWritten(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForBytesWritten");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForBytesWritten");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForBytesWritten");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5312,9 +5777,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::waitForReadyRead(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForReadyRead");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForReadyRead");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForReadyRead");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5340,9 +5808,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::writeData(const char*  data, qint64  len)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "writeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("writeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("writeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "const char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -5823,9 +6294,12 @@ QString  PythonQtWrapper_QFileInfo::symLinkTarget(QFileInfo* theWrappedObject) c
 void PythonQtShell_QFileSystemWatcher::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5840,9 +6314,12 @@ if (_wrapper) {
 void PythonQtShell_QFileSystemWatcher::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5857,9 +6334,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFileSystemWatcher::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5885,9 +6365,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFileSystemWatcher::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -5913,9 +6396,12 @@ if (_wrapper) {
 void PythonQtShell_QFileSystemWatcher::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5970,9 +6456,12 @@ void PythonQtWrapper_QFileSystemWatcher::removePaths(QFileSystemWatcher* theWrap
 void PythonQtShell_QFinalState::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5987,9 +6476,12 @@ if (_wrapper) {
 void PythonQtShell_QFinalState::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6004,9 +6496,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFinalState::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6032,9 +6527,12 @@ if (_wrapper) {
 bool  PythonQtShell_QFinalState::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -6060,9 +6558,12 @@ if (_wrapper) {
 void PythonQtShell_QFinalState::onEntry(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onEntry");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onEntry");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onEntry");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -6077,9 +6578,12 @@ if (_wrapper) {
 void PythonQtShell_QFinalState::onExit(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onExit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onExit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onExit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -6094,9 +6598,12 @@ if (_wrapper) {
 void PythonQtShell_QFinalState::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6132,9 +6639,12 @@ void PythonQtWrapper_QFinalState::onExit(QFinalState* theWrappedObject, QEvent*
 void PythonQtShell_QHistoryState::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6149,9 +6659,12 @@ if (_wrapper) {
 void PythonQtShell_QHistoryState::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6166,9 +6679,12 @@ if (_wrapper) {
 bool  PythonQtShell_QHistoryState::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6194,9 +6710,12 @@ if (_wrapper) {
 bool  PythonQtShell_QHistoryState::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -6222,9 +6741,12 @@ if (_wrapper) {
 void PythonQtShell_QHistoryState::onEntry(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onEntry");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onEntry");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onEntry");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -6239,9 +6761,12 @@ if (_wrapper) {
 void PythonQtShell_QHistoryState::onExit(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onExit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onExit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onExit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -6256,9 +6781,12 @@ if (_wrapper) {
 void PythonQtShell_QHistoryState::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6318,9 +6846,12 @@ void PythonQtWrapper_QHistoryState::setHistoryType(QHistoryState* theWrappedObje
 bool  PythonQtShell_QIODevice::atEnd() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "atEnd");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("atEnd");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("atEnd");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -6346,9 +6877,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::bytesAvailable() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesAvailable");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesAvailable");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesAvailable");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -6374,9 +6908,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::bytesToWrite() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesToWrite");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesToWrite");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesToWrite");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -6402,9 +6939,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::canReadLine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "canReadLine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("canReadLine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("canReadLine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -6430,9 +6970,12 @@ if (_wrapper) {
 void PythonQtShell_QIODevice::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6447,9 +6990,12 @@ if (_wrapper) {
 void PythonQtShell_QIODevice::close()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "close");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("close");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("close");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -6464,9 +7010,12 @@ if (_wrapper) {
 void PythonQtShell_QIODevice::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6481,9 +7030,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6509,9 +7061,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -6537,9 +7092,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::isSequential() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isSequential");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isSequential");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isSequential");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -6565,9 +7123,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::open(QIODevice::OpenMode  mode)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "open");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("open");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("open");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QIODevice::OpenMode"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6593,9 +7154,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::pos() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pos");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pos");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pos");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -6621,9 +7185,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::readData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -6649,9 +7216,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::readLineData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readLineData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readLineData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readLineData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -6677,9 +7247,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -6705,9 +7278,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::seek(qint64  pos)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "seek");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("seek");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("seek");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6733,9 +7309,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::size() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "size");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("size");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("size");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -6761,9 +7340,12 @@ if (_wrapper) {
 void PythonQtShell_QIODevice::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6778,9 +7360,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::waitForBytesWritten(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForBytesWritten");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForBytesWritten");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForBytesWritten");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6806,9 +7391,12 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::waitForReadyRead(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForReadyRead");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForReadyRead");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForReadyRead");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6834,9 +7422,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::writeData(const char*  data, qint64  len)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "writeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("writeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("writeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "const char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -7049,9 +7640,12 @@ QString  PythonQtWrapper_QLibraryInfo::static_QLibraryInfo_location(QLibraryInfo
 void PythonQtShell_QMimeData::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7066,9 +7660,12 @@ if (_wrapper) {
 void PythonQtShell_QMimeData::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7083,9 +7680,12 @@ if (_wrapper) {
 bool  PythonQtShell_QMimeData::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -7111,9 +7711,12 @@ if (_wrapper) {
 bool  PythonQtShell_QMimeData::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -7139,9 +7742,12 @@ if (_wrapper) {
 QStringList  PythonQtShell_QMimeData::formats() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "formats");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("formats");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("formats");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStringList"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QStringList returnValue;
@@ -7167,9 +7773,12 @@ if (_wrapper) {
 bool  PythonQtShell_QMimeData::hasFormat(const QString&  mimetype) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasFormat");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasFormat");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasFormat");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -7195,9 +7804,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QMimeData::retrieveData(const QString&  mimetype, QVariant::Type  preferredType) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "retrieveData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("retrieveData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("retrieveData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QString&" , "QVariant::Type"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QVariant returnValue;
@@ -7223,9 +7835,12 @@ if (_wrapper) {
 void PythonQtShell_QMimeData::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -75,9 +75,12 @@ void PythonQtWrapper_QMutex::unlock(QMutex* theWrappedObject)
 void PythonQtShell_QObject::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -92,9 +95,12 @@ if (_wrapper) {
 void PythonQtShell_QObject::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -109,9 +115,12 @@ if (_wrapper) {
 bool  PythonQtShell_QObject::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -137,9 +146,12 @@ if (_wrapper) {
 bool  PythonQtShell_QObject::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -165,9 +177,12 @@ if (_wrapper) {
 void PythonQtShell_QObject::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -308,9 +323,12 @@ void PythonQtWrapper_QObject::timerEvent(QObject* theWrappedObject, QTimerEvent*
 void PythonQtShell_QParallelAnimationGroup::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -325,9 +343,12 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -342,9 +363,12 @@ if (_wrapper) {
 int  PythonQtShell_QParallelAnimationGroup::duration() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "duration");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("duration");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("duration");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -370,9 +394,12 @@ if (_wrapper) {
 bool  PythonQtShell_QParallelAnimationGroup::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -398,9 +425,12 @@ if (_wrapper) {
 bool  PythonQtShell_QParallelAnimationGroup::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -426,9 +456,12 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -443,9 +476,12 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::updateCurrentTime(int  currentTime)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&currentTime};
@@ -460,9 +496,12 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::updateDirection(QAbstractAnimation::Direction  direction)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateDirection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateDirection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateDirection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::Direction"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&direction};
@@ -477,9 +516,12 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::updateState(QAbstractAnimation::State  newState, QAbstractAnimation::State  oldState)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::State" , "QAbstractAnimation::State"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&newState, (void*)&oldState};
@@ -525,9 +567,12 @@ void PythonQtWrapper_QParallelAnimationGroup::updateState(QParallelAnimationGrou
 void PythonQtShell_QPauseAnimation::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -542,9 +587,12 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -559,9 +607,12 @@ if (_wrapper) {
 int  PythonQtShell_QPauseAnimation::duration() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "duration");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("duration");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("duration");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -587,9 +638,12 @@ if (_wrapper) {
 bool  PythonQtShell_QPauseAnimation::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -615,9 +669,12 @@ if (_wrapper) {
 bool  PythonQtShell_QPauseAnimation::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -643,9 +700,12 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -660,9 +720,12 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::updateCurrentTime(int  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -677,9 +740,12 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::updateDirection(QAbstractAnimation::Direction  direction)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateDirection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateDirection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateDirection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::Direction"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&direction};
@@ -694,9 +760,12 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::updateState(QAbstractAnimation::State  newState, QAbstractAnimation::State  oldState)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::State" , "QAbstractAnimation::State"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&newState, (void*)&oldState};
@@ -741,9 +810,12 @@ void PythonQtWrapper_QPauseAnimation::updateCurrentTime(QPauseAnimation* theWrap
 bool  PythonQtShell_QProcess::atEnd() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "atEnd");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("atEnd");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("atEnd");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -769,9 +841,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::bytesAvailable() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesAvailable");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesAvailable");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesAvailable");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -797,9 +872,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::bytesToWrite() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesToWrite");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesToWrite");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesToWrite");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -825,9 +903,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::canReadLine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "canReadLine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("canReadLine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("canReadLine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -853,9 +934,12 @@ if (_wrapper) {
 void PythonQtShell_QProcess::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -870,9 +954,12 @@ if (_wrapper) {
 void PythonQtShell_QProcess::close()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "close");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("close");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("close");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -887,9 +974,12 @@ if (_wrapper) {
 void PythonQtShell_QProcess::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -904,9 +994,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -932,9 +1025,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -960,9 +1056,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::isSequential() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isSequential");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isSequential");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isSequential");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -988,9 +1087,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::open(QIODevice::OpenMode  mode)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "open");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("open");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("open");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QIODevice::OpenMode"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1016,9 +1118,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::pos() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pos");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pos");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pos");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -1044,9 +1149,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::readData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -1072,9 +1180,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::readLineData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readLineData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readLineData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readLineData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -1100,9 +1211,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1128,9 +1242,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::seek(qint64  pos)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "seek");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("seek");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("seek");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1156,9 +1273,12 @@ if (_wrapper) {
 void PythonQtShell_QProcess::setupChildProcess()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setupChildProcess");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setupChildProcess");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setupChildProcess");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -1173,9 +1293,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::size() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "size");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("size");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("size");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -1201,9 +1324,12 @@ if (_wrapper) {
 void PythonQtShell_QProcess::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1218,9 +1344,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::waitForBytesWritten(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForBytesWritten");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForBytesWritten");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForBytesWritten");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1246,9 +1375,12 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::waitForReadyRead(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForReadyRead");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForReadyRead");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForReadyRead");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1274,9 +1406,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::writeData(const char*  data, qint64  len)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "writeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("writeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("writeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "const char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -1588,9 +1723,12 @@ QString  PythonQtWrapper_QProcessEnvironment::value(QProcessEnvironment* theWrap
 void PythonQtShell_QPropertyAnimation::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1605,9 +1743,12 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1622,9 +1763,12 @@ if (_wrapper) {
 int  PythonQtShell_QPropertyAnimation::duration() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "duration");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("duration");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("duration");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -1650,9 +1794,12 @@ if (_wrapper) {
 bool  PythonQtShell_QPropertyAnimation::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1678,9 +1825,12 @@ if (_wrapper) {
 bool  PythonQtShell_QPropertyAnimation::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1706,9 +1856,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QPropertyAnimation::interpolated(const QVariant&  from, const QVariant&  to, qreal  progress) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "interpolated");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("interpolated");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("interpolated");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QVariant&" , "const QVariant&" , "qreal"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QVariant returnValue;
@@ -1734,9 +1887,12 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1751,9 +1907,12 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::updateCurrentTime(int  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1768,9 +1927,12 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::updateCurrentValue(const QVariant&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentValue");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentValue");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentValue");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QVariant&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&value};
@@ -1785,9 +1947,12 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::updateDirection(QAbstractAnimation::Direction  direction)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateDirection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateDirection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateDirection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::Direction"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&direction};
@@ -1802,9 +1967,12 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::updateState(QAbstractAnimation::State  newState, QAbstractAnimation::State  oldState)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::State" , "QAbstractAnimation::State"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&newState, (void*)&oldState};
@@ -1909,9 +2077,12 @@ void PythonQtWrapper_QReadWriteLock::unlock(QReadWriteLock* theWrappedObject)
 void PythonQtShell_QRunnable::run()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "run");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("run");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("run");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -1973,9 +2144,12 @@ bool  PythonQtWrapper_QSemaphore::tryAcquire(QSemaphore* theWrappedObject, int
 void PythonQtShell_QSequentialAnimationGroup::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1990,9 +2164,12 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2007,9 +2184,12 @@ if (_wrapper) {
 int  PythonQtShell_QSequentialAnimationGroup::duration() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "duration");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("duration");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("duration");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -2035,9 +2215,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSequentialAnimationGroup::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2063,9 +2246,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSequentialAnimationGroup::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2091,9 +2277,12 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2108,9 +2297,12 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::updateCurrentTime(int  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2125,9 +2317,12 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::updateDirection(QAbstractAnimation::Direction  direction)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateDirection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateDirection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateDirection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::Direction"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&direction};
@@ -2142,9 +2337,12 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::updateState(QAbstractAnimation::State  newState, QAbstractAnimation::State  oldState)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::State" , "QAbstractAnimation::State"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&newState, (void*)&oldState};
@@ -2205,9 +2403,12 @@ void PythonQtWrapper_QSequentialAnimationGroup::updateState(QSequentialAnimation
 void PythonQtShell_QSettings::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2222,9 +2423,12 @@ if (_wrapper) {
 void PythonQtShell_QSettings::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2239,9 +2443,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSettings::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2267,9 +2474,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSettings::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2295,9 +2505,12 @@ if (_wrapper) {
 void PythonQtShell_QSettings::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2494,9 +2707,12 @@ QVariant  PythonQtWrapper_QSettings::value(QSettings* theWrappedObject, const QS
 void PythonQtShell_QSignalMapper::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2511,9 +2727,12 @@ if (_wrapper) {
 void PythonQtShell_QSignalMapper::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2528,9 +2747,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalMapper::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2556,9 +2778,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalMapper::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2584,9 +2809,12 @@ if (_wrapper) {
 void PythonQtShell_QSignalMapper::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2642,9 +2870,12 @@ void PythonQtWrapper_QSignalMapper::setMapping(QSignalMapper* theWrappedObject,
 void PythonQtShell_QSignalTransition::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2659,9 +2890,12 @@ if (_wrapper) {
 void PythonQtShell_QSignalTransition::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2676,9 +2910,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalTransition::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2704,9 +2941,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalTransition::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2732,9 +2972,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalTransition::eventTest(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventTest");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventTest");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventTest");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2760,9 +3003,12 @@ if (_wrapper) {
 void PythonQtShell_QSignalTransition::onTransition(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onTransition");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onTransition");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onTransition");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2777,9 +3023,12 @@ if (_wrapper) {
 void PythonQtShell_QSignalTransition::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2839,9 +3088,12 @@ QByteArray  PythonQtWrapper_QSignalTransition::signal(QSignalTransition* theWrap
 void PythonQtShell_QSocketNotifier::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2856,9 +3108,12 @@ if (_wrapper) {
 void PythonQtShell_QSocketNotifier::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2873,9 +3128,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSocketNotifier::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2901,9 +3159,12 @@ if (_wrapper) {
 bool  PythonQtShell_QSocketNotifier::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2929,9 +3190,12 @@ if (_wrapper) {
 void PythonQtShell_QSocketNotifier::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2972,9 +3236,12 @@ QSocketNotifier::Type  PythonQtWrapper_QSocketNotifier::type(QSocketNotifier* th
 void PythonQtShell_QState::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2989,9 +3256,12 @@ if (_wrapper) {
 void PythonQtShell_QState::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3006,9 +3276,12 @@ if (_wrapper) {
 bool  PythonQtShell_QState::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3034,9 +3307,12 @@ if (_wrapper) {
 bool  PythonQtShell_QState::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3062,9 +3338,12 @@ if (_wrapper) {
 void PythonQtShell_QState::onEntry(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onEntry");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onEntry");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onEntry");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3079,9 +3358,12 @@ if (_wrapper) {
 void PythonQtShell_QState::onExit(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onExit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onExit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onExit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3096,9 +3378,12 @@ if (_wrapper) {
 void PythonQtShell_QState::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3193,9 +3478,12 @@ void PythonQtWrapper_QState::setInitialState(QState* theWrappedObject, QAbstract
 void PythonQtShell_QStateMachine::beginMicrostep(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "beginMicrostep");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("beginMicrostep");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("beginMicrostep");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3210,9 +3498,12 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::beginSelectTransitions(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "beginSelectTransitions");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("beginSelectTransitions");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("beginSelectTransitions");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3227,9 +3518,12 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3244,9 +3538,12 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3261,9 +3558,12 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::endMicrostep(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endMicrostep");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endMicrostep");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endMicrostep");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3278,9 +3578,12 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::endSelectTransitions(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endSelectTransitions");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endSelectTransitions");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endSelectTransitions");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3295,9 +3598,12 @@ if (_wrapper) {
 bool  PythonQtShell_QStateMachine::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3323,9 +3629,12 @@ if (_wrapper) {
 bool  PythonQtShell_QStateMachine::eventFilter(QObject*  watched, QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3351,9 +3660,12 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::onEntry(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onEntry");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onEntry");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onEntry");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3368,9 +3680,12 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::onExit(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "onExit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("onExit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("onExit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3385,9 +3700,12 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3645,9 +3963,12 @@ void PythonQtWrapper_QSystemSemaphore::setKey(QSystemSemaphore* theWrappedObject
 bool  PythonQtShell_QTemporaryFile::atEnd() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "atEnd");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("atEnd");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("atEnd");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3673,9 +3994,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::bytesAvailable() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesAvailable");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesAvailable");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesAvailable");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -3701,9 +4025,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::bytesToWrite() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "bytesToWrite");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("bytesToWrite");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("bytesToWrite");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -3729,9 +4056,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::canReadLine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "canReadLine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("canReadLine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("canReadLine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3757,9 +4087,12 @@ if (_wrapper) {
 void PythonQtShell_QTemporaryFile::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3774,9 +4107,12 @@ if (_wrapper) {
 void PythonQtShell_QTemporaryFile::close()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "close");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("close");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("close");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3791,9 +4127,12 @@ if (_wrapper) {
 void PythonQtShell_QTemporaryFile::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3808,9 +4147,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3836,9 +4178,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3864,9 +4209,12 @@ if (_wrapper) {
 QAbstractFileEngine*  PythonQtShell_QTemporaryFile::fileEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fileEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fileEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fileEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAbstractFileEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAbstractFileEngine* returnValue;
@@ -3892,9 +4240,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::isSequential() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isSequential");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isSequential");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isSequential");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3920,9 +4271,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::open(QIODevice::OpenMode  flags)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "open");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("open");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("open");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QIODevice::OpenMode"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3948,9 +4302,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::pos() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pos");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pos");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pos");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -3976,9 +4333,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::readData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -4004,9 +4364,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::readLineData(char*  data, qint64  maxlen)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "readLineData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("readLineData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("readLineData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -4032,9 +4395,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -4060,9 +4426,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::seek(qint64  offset)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "seek");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("seek");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("seek");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4088,9 +4457,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::size() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "size");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("size");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("size");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       qint64 returnValue;
@@ -4116,9 +4488,12 @@ if (_wrapper) {
 void PythonQtShell_QTemporaryFile::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4133,9 +4508,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::waitForBytesWritten(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForBytesWritten");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForBytesWritten");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForBytesWritten");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4161,9 +4539,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::waitForReadyRead(int  msecs)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "waitForReadyRead");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("waitForReadyRead");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("waitForReadyRead");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4189,9 +4570,12 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::writeData(const char*  data, qint64  len)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "writeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("writeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("writeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qint64" , "const char*" , "qint64"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       qint64 returnValue;
@@ -4354,9 +4738,12 @@ QTextBoundaryFinder::BoundaryType  PythonQtWrapper_QTextBoundaryFinder::type(QTe
 QList<QByteArray >  PythonQtShell_QTextCodec::aliases() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "aliases");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("aliases");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("aliases");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QList<QByteArray >"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QList<QByteArray > returnValue;
@@ -4382,9 +4769,12 @@ if (_wrapper) {
 QByteArray  PythonQtShell_QTextCodec::convertFromUnicode(const QChar*  in, int  length, QTextCodec::ConverterState*  state) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "convertFromUnicode");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("convertFromUnicode");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("convertFromUnicode");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QByteArray" , "const QChar*" , "int" , "QTextCodec::ConverterState*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QByteArray returnValue;
@@ -4410,9 +4800,12 @@ if (_wrapper) {
 QString  PythonQtShell_QTextCodec::convertToUnicode(const char*  in, int  length, QTextCodec::ConverterState*  state) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "convertToUnicode");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("convertToUnicode");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("convertToUnicode");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const char*" , "int" , "QTextCodec::ConverterState*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QString returnValue;
@@ -4438,9 +4831,12 @@ if (_wrapper) {
 int  PythonQtShell_QTextCodec::mibEnum() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mibEnum");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mibEnum");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mibEnum");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -4466,9 +4862,12 @@ if (_wrapper) {
 QByteArray  PythonQtShell_QTextCodec::name() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "name");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("name");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("name");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QByteArray"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QByteArray returnValue;
@@ -4897,9 +5296,12 @@ QTextStream::Status  PythonQtWrapper_QTextStream::status(QTextStream* theWrapped
 void PythonQtShell_QThreadPool::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4914,9 +5316,12 @@ if (_wrapper) {
 void PythonQtShell_QThreadPool::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4931,9 +5336,12 @@ if (_wrapper) {
 bool  PythonQtShell_QThreadPool::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4959,9 +5367,12 @@ if (_wrapper) {
 bool  PythonQtShell_QThreadPool::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -4987,9 +5398,12 @@ if (_wrapper) {
 void PythonQtShell_QThreadPool::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5065,9 +5479,12 @@ void PythonQtWrapper_QThreadPool::waitForDone(QThreadPool* theWrappedObject)
 void PythonQtShell_QTimeLine::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5082,9 +5499,12 @@ if (_wrapper) {
 void PythonQtShell_QTimeLine::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5099,9 +5519,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTimeLine::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5127,9 +5550,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTimeLine::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -5155,9 +5581,12 @@ if (_wrapper) {
 void PythonQtShell_QTimeLine::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -5172,9 +5601,12 @@ if (_wrapper) {
 qreal  PythonQtShell_QTimeLine::valueForTime(int  msec) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "valueForTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("valueForTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("valueForTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"qreal" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       qreal returnValue;
@@ -5326,9 +5758,12 @@ qreal  PythonQtWrapper_QTimeLine::valueForTime(QTimeLine* theWrappedObject, int
 void PythonQtShell_QTimer::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5343,9 +5778,12 @@ if (_wrapper) {
 void PythonQtShell_QTimer::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5360,9 +5798,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTimer::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5388,9 +5829,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTimer::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -5416,9 +5860,12 @@ if (_wrapper) {
 void PythonQtShell_QTimer::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -35,9 +35,12 @@ int  PythonQtWrapper_QTimerEvent::timerId(QTimerEvent* theWrappedObject) const
 void PythonQtShell_QTranslator::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -52,9 +55,12 @@ if (_wrapper) {
 void PythonQtShell_QTranslator::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -69,9 +75,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTranslator::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -97,9 +106,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTranslator::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -125,9 +137,12 @@ if (_wrapper) {
 bool  PythonQtShell_QTranslator::isEmpty() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isEmpty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isEmpty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isEmpty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -153,9 +168,12 @@ if (_wrapper) {
 void PythonQtShell_QTranslator::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -170,9 +188,12 @@ if (_wrapper) {
 QString  PythonQtShell_QTranslator::translate(const char*  context, const char*  sourceText, const char*  disambiguation) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "translate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("translate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("translate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const char*" , "const char*" , "const char*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QString returnValue;
@@ -294,9 +315,12 @@ QString PythonQtWrapper_QUuid::py_toString(QUuid* obj) { return obj->toString();
 void PythonQtShell_QVariantAnimation::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -311,9 +335,12 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -328,9 +355,12 @@ if (_wrapper) {
 int  PythonQtShell_QVariantAnimation::duration() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "duration");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("duration");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("duration");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -356,9 +386,12 @@ if (_wrapper) {
 bool  PythonQtShell_QVariantAnimation::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -384,9 +417,12 @@ if (_wrapper) {
 bool  PythonQtShell_QVariantAnimation::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -412,9 +448,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QVariantAnimation::interpolated(const QVariant&  from, const QVariant&  to, qreal  progress) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "interpolated");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("interpolated");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("interpolated");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QVariant&" , "const QVariant&" , "qreal"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QVariant returnValue;
@@ -440,9 +479,12 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -457,9 +499,12 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::updateCurrentTime(int  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -474,9 +519,12 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::updateCurrentValue(const QVariant&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateCurrentValue");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateCurrentValue");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateCurrentValue");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QVariant&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&value};
@@ -491,9 +539,12 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::updateDirection(QAbstractAnimation::Direction  direction)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateDirection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateDirection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateDirection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::Direction"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&direction};
@@ -508,9 +559,12 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::updateState(QAbstractAnimation::State  newState, QAbstractAnimation::State  oldState)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractAnimation::State" , "QAbstractAnimation::State"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&newState, (void*)&oldState};
@@ -642,9 +696,12 @@ void PythonQtWrapper_QWaitCondition::wakeOne(QWaitCondition* theWrappedObject)
 QString  PythonQtShell_QXmlStreamEntityResolver::resolveEntity(const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resolveEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resolveEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resolveEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -670,9 +727,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlStreamEntityResolver::resolveUndeclaredEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resolveUndeclaredEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resolveUndeclaredEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resolveUndeclaredEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QString returnValue;
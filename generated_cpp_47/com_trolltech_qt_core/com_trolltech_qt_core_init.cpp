@@ -7,32 +7,37 @@ static void* polymorphichandler_QEvent(const void *ptr, const char **class_name)
 {
     Q_ASSERT(ptr != 0);
     QEvent *object = (QEvent *)ptr;
-    if (object->type() == QEvent::None) {
+    switch (object->type()) {
+    case QEvent::None:
         *class_name = "QEvent";
         return (QEvent*)object;
-    }
-    if (object->type() == QEvent::ChildAdded || object->type() == QEvent::ChildPolished || object->type() == QEvent::ChildRemoved) {
+    case QEvent::ChildAdded:
+    case QEvent::ChildPolished:
+    case QEvent::ChildRemoved:
         *class_name = "QChildEvent";
         return (QChildEvent*)object;
-    }
-    if (object->type() == QEvent::StateMachineWrapped) {
+    case QEvent::StateMachineWrapped:
         *class_name = "QStateMachine_WrappedEvent";
         return (QStateMachine::WrappedEvent*)object;
-    }
-    if (object->type() == QEvent::StateMachineSignal) {
+    case QEvent::StateMachineSignal:
         *class_name = "QStateMachine_SignalEvent";
         return (QStateMachine::SignalEvent*)object;
-    }
-    if (object->type() == QEvent::Timer) {
+    case QEvent::Timer:
         *class_name = "QTimerEvent";
         return (QTimerEvent*)object;
-    }
-    if (object->type() == QEvent::DynamicPropertyChange) {
+    case QEvent::DynamicPropertyChange:
         *class_name = "QDynamicPropertyChangeEvent";
         return (QDynamicPropertyChangeEvent*)object;
+    default:
+        break;
     }
     return NULL;
 }
+static int polymorphicdiscriminator_QEvent(const void *ptr)
+{
+    QEvent *object = (QEvent *)ptr;
+    return (int)(object->type());
+}
 
 void PythonQt_init_QtCore(PyObject* module) {
 PythonQt::priv()->registerClass(&QAbstractAnimation::staticMetaObject, "QtCore", PythonQtCreateObject<PythonQtWrapper_QAbstractAnimation>, PythonQtSetInstanceWrapperOnShell<PythonQtShell_QAbstractAnimation>, module, 0);
@@ -103,5 +108,5 @@ PythonQt::priv()->registerCPPClass("QWaitCondition", "", "QtCore", PythonQtCreat
 PythonQt::priv()->registerCPPClass("QXmlStreamEntityResolver", "", "QtCore", PythonQtCreateObject<PythonQtWrapper_QXmlStreamEntityResolver>, PythonQtSetInstanceWrapperOnShell<PythonQtShell_QXmlStreamEntityResolver>, module, 0);
 PythonQt::priv()->registerCPPClass("QtConcurrent", "", "QtCore", PythonQtCreateObject<PythonQtWrapper_QtConcurrent>, NULL, module, 0);
 
-PythonQt::self()->addPolymorphicHandler("QEvent", polymorphichandler_QEvent);
+PythonQt::self()->addPolymorphicHandler("QEvent", polymorphichandler_QEvent, polymorphicdiscriminator_QEvent);
 }
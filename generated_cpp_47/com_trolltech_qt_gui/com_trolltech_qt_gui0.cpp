@@ -90,9 +90,12 @@
 void PythonQtShell_QAbstractButton::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -107,9 +110,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::changeEvent(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -124,9 +130,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::checkStateSet()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "checkStateSet");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("checkStateSet");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("checkStateSet");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -141,9 +150,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -158,9 +170,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -175,9 +190,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -192,9 +210,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -209,9 +230,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractButton::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -237,9 +261,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -254,9 +281,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -271,9 +301,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -288,9 +321,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -305,9 +341,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -322,9 +361,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -350,9 +392,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -378,9 +423,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::focusInEvent(QFocusEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -395,9 +443,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -423,9 +474,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::focusOutEvent(QFocusEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -440,9 +494,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractButton::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -468,9 +525,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -485,9 +545,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::hitButton(const QPoint&  pos) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hitButton");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hitButton");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hitButton");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QPoint&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -513,9 +576,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -530,9 +596,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractButton::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -558,9 +627,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::keyPressEvent(QKeyEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -575,9 +647,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::keyReleaseEvent(QKeyEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -592,9 +667,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -609,9 +687,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -626,9 +707,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractButton::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -654,9 +738,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractButton::minimumSizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getMinimumSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getMinimumSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getMinimumSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -682,9 +769,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -699,9 +789,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::mouseMoveEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -716,9 +809,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::mousePressEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -733,9 +829,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::mouseReleaseEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -750,9 +849,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -767,9 +869,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::nextCheckState()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "nextCheckState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("nextCheckState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("nextCheckState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -784,9 +889,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractButton::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -812,9 +920,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::paintEvent(QPaintEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -829,9 +940,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -846,9 +960,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -863,9 +980,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractButton::sizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -891,9 +1011,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -908,9 +1031,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::timerEvent(QTimerEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -925,9 +1051,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1118,9 +1247,12 @@ void PythonQtWrapper_QAbstractButton::timerEvent(QAbstractButton* theWrappedObje
 void PythonQtShell_QAbstractGraphicsShapeItem::advance(int  phase)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "advance");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("advance");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("advance");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&phase};
@@ -1135,9 +1267,12 @@ if (_wrapper) {
 QRectF  PythonQtShell_QAbstractGraphicsShapeItem::boundingRect() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "boundingRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("boundingRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("boundingRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRectF"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QRectF returnValue;
@@ -1163,9 +1298,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::collidesWithItem(const QGraphicsItem*  other, Qt::ItemSelectionMode  mode) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "collidesWithItem");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("collidesWithItem");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("collidesWithItem");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QGraphicsItem*" , "Qt::ItemSelectionMode"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1191,9 +1329,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::collidesWithPath(const QPainterPath&  path, Qt::ItemSelectionMode  mode) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "collidesWithPath");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("collidesWithPath");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("collidesWithPath");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QPainterPath&" , "Qt::ItemSelectionMode"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1219,9 +1360,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::contains(const QPointF&  point) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contains");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contains");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contains");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QPointF&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1247,9 +1391,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::contextMenuEvent(QGraphicsSceneContextMenuEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1264,9 +1411,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::dragEnterEvent(QGraphicsSceneDragDropEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneDragDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1281,9 +1431,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::dragLeaveEvent(QGraphicsSceneDragDropEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneDragDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1298,9 +1451,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::dragMoveEvent(QGraphicsSceneDragDropEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneDragDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1315,9 +1471,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::dropEvent(QGraphicsSceneDragDropEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneDragDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1332,9 +1491,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractGraphicsShapeItem::extension(const QVariant&  variant) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "extension");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("extension");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("extension");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QVariant&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -1360,9 +1522,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::focusInEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1377,9 +1542,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::focusOutEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1394,9 +1562,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::hoverEnterEvent(QGraphicsSceneHoverEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hoverEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hoverEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hoverEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneHoverEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1411,9 +1582,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::hoverLeaveEvent(QGraphicsSceneHoverEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hoverLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hoverLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hoverLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneHoverEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1428,9 +1602,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::hoverMoveEvent(QGraphicsSceneHoverEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hoverMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hoverMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hoverMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneHoverEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1445,9 +1622,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::inputMethodEvent(QInputMethodEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1462,9 +1642,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractGraphicsShapeItem::inputMethodQuery(Qt::InputMethodQuery  query) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -1490,9 +1673,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::isObscuredBy(const QGraphicsItem*  item) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isObscuredBy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isObscuredBy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isObscuredBy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QGraphicsItem*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1518,9 +1704,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractGraphicsShapeItem::itemChange(QGraphicsItem::GraphicsItemChange  change, const QVariant&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "itemChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("itemChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("itemChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "QGraphicsItem::GraphicsItemChange" , "const QVariant&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QVariant returnValue;
@@ -1546,9 +1735,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::keyPressEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1563,9 +1755,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::keyReleaseEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1580,9 +1775,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1597,9 +1795,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::mouseMoveEvent(QGraphicsSceneMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1614,9 +1815,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::mousePressEvent(QGraphicsSceneMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1631,9 +1835,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::mouseReleaseEvent(QGraphicsSceneMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1648,9 +1855,12 @@ if (_wrapper) {
 QPainterPath  PythonQtShell_QAbstractGraphicsShapeItem::opaqueArea() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "opaqueArea");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("opaqueArea");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("opaqueArea");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPainterPath"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPainterPath returnValue;
@@ -1676,9 +1886,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::paint(QPainter*  painter, const QStyleOptionGraphicsItem*  option, QWidget*  widget)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QStyleOptionGraphicsItem*" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&painter, (void*)&option, (void*)&widget};
@@ -1693,9 +1906,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::sceneEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sceneEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sceneEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sceneEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1721,9 +1937,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::sceneEventFilter(QGraphicsItem*  watched, QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sceneEventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sceneEventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sceneEventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QGraphicsItem*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1749,9 +1968,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::setExtension(QGraphicsItem::Extension  extension, const QVariant&  variant)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setExtension");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setExtension");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setExtension");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsItem::Extension" , "const QVariant&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&extension, (void*)&variant};
@@ -1766,9 +1988,12 @@ if (_wrapper) {
 QPainterPath  PythonQtShell_QAbstractGraphicsShapeItem::shape() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "shape");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("shape");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("shape");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPainterPath"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPainterPath returnValue;
@@ -1794,9 +2019,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::supportsExtension(QGraphicsItem::Extension  extension) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "supportsExtension");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("supportsExtension");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("supportsExtension");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QGraphicsItem::Extension"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1822,9 +2050,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractGraphicsShapeItem::type() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "type");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("type");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("type");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -1850,9 +2081,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::wheelEvent(QGraphicsSceneWheelEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QGraphicsSceneWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1903,9 +2137,12 @@ void PythonQtWrapper_QAbstractGraphicsShapeItem::setPen(QAbstractGraphicsShapeIt
 void PythonQtShell_QAbstractItemDelegate::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1920,9 +2157,12 @@ if (_wrapper) {
 QWidget*  PythonQtShell_QAbstractItemDelegate::createEditor(QWidget*  parent, const QStyleOptionViewItem&  option, const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "createEditor");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("createEditor");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("createEditor");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QWidget*" , "QWidget*" , "const QStyleOptionViewItem&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QWidget* returnValue;
@@ -1948,9 +2188,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1965,9 +2208,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemDelegate::editorEvent(QEvent*  event, QAbstractItemModel*  model, const QStyleOptionViewItem&  option, const QModelIndex&  index)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "editorEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("editorEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("editorEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*" , "QAbstractItemModel*" , "const QStyleOptionViewItem&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -1993,9 +2239,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemDelegate::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2021,9 +2270,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemDelegate::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2049,9 +2301,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::paint(QPainter*  painter, const QStyleOptionViewItem&  option, const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QStyleOptionViewItem&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&painter, (void*)&option, (void*)&index};
@@ -2066,9 +2321,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::setEditorData(QWidget*  editor, const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setEditorData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setEditorData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setEditorData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&editor, (void*)&index};
@@ -2083,9 +2341,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::setModelData(QWidget*  editor, QAbstractItemModel*  model, const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setModelData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setModelData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setModelData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*" , "QAbstractItemModel*" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&editor, (void*)&model, (void*)&index};
@@ -2100,9 +2361,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractItemDelegate::sizeHint(const QStyleOptionViewItem&  option, const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize" , "const QStyleOptionViewItem&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QSize returnValue;
@@ -2128,9 +2392,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2145,9 +2412,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::updateEditorGeometry(QWidget*  editor, const QStyleOptionViewItem&  option, const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateEditorGeometry");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateEditorGeometry");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateEditorGeometry");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*" , "const QStyleOptionViewItem&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&editor, (void*)&option, (void*)&index};
@@ -2193,9 +2463,12 @@ void PythonQtWrapper_QAbstractItemDelegate::updateEditorGeometry(QAbstractItemDe
 void PythonQtShell_QAbstractItemView::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2210,9 +2483,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2227,9 +2503,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2244,9 +2523,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::closeEditor(QWidget*  editor, QAbstractItemDelegate::EndEditHint  hint)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEditor");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEditor");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEditor");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*" , "QAbstractItemDelegate::EndEditHint"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&editor, (void*)&hint};
@@ -2261,9 +2543,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2278,9 +2563,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::commitData(QWidget*  editor)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "commitData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("commitData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("commitData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&editor};
@@ -2295,9 +2583,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2312,9 +2603,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::currentChanged(const QModelIndex&  current, const QModelIndex&  previous)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "currentChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("currentChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("currentChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&current, (void*)&previous};
@@ -2329,9 +2623,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2346,9 +2643,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dataChanged(const QModelIndex&  topLeft, const QModelIndex&  bottomRight)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dataChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dataChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dataChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&topLeft, (void*)&bottomRight};
@@ -2363,9 +2663,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -2391,9 +2694,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::doItemsLayout()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "doItemsLayout");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("doItemsLayout");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("doItemsLayout");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2408,9 +2714,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dragEnterEvent(QDragEnterEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2425,9 +2734,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dragLeaveEvent(QDragLeaveEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2442,9 +2754,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dragMoveEvent(QDragMoveEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2459,9 +2774,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dropEvent(QDropEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2476,9 +2794,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::edit(const QModelIndex&  index, QAbstractItemView::EditTrigger  trigger, QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "edit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("edit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("edit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&" , "QAbstractItemView::EditTrigger" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2504,9 +2825,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::editorDestroyed(QObject*  editor)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "editorDestroyed");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("editorDestroyed");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("editorDestroyed");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&editor};
@@ -2521,9 +2845,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2538,9 +2865,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2566,9 +2896,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2594,9 +2927,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::focusInEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2611,9 +2947,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2639,9 +2978,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::focusOutEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2656,9 +2998,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -2684,9 +3029,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2701,9 +3049,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::horizontalOffset() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "horizontalOffset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("horizontalOffset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("horizontalOffset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -2729,9 +3080,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::horizontalScrollbarAction(int  action)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "horizontalScrollbarAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("horizontalScrollbarAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("horizontalScrollbarAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&action};
@@ -2746,9 +3100,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::horizontalScrollbarValueChanged(int  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "horizontalScrollbarValueChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("horizontalScrollbarValueChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("horizontalScrollbarValueChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&value};
@@ -2763,9 +3120,12 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemView::indexAt(const QPoint&  point) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "const QPoint&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QModelIndex returnValue;
@@ -2791,9 +3151,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::inputMethodEvent(QInputMethodEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2808,9 +3171,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractItemView::inputMethodQuery(Qt::InputMethodQuery  query) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -2836,9 +3202,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::isIndexHidden(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isIndexHidden");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isIndexHidden");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isIndexHidden");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2864,9 +3233,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::keyPressEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2881,9 +3253,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2898,9 +3273,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::keyboardSearch(const QString&  search)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyboardSearch");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyboardSearch");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyboardSearch");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&search};
@@ -2915,9 +3293,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2932,9 +3313,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2949,9 +3333,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -2977,9 +3364,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::mouseDoubleClickEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2994,9 +3384,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::mouseMoveEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3011,9 +3404,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::mousePressEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3028,9 +3424,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::mouseReleaseEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3045,9 +3444,12 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemView::moveCursor(QAbstractItemView::CursorAction  cursorAction, Qt::KeyboardModifiers  modifiers)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveCursor");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveCursor");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveCursor");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "QAbstractItemView::CursorAction" , "Qt::KeyboardModifiers"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QModelIndex returnValue;
@@ -3073,9 +3475,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3090,9 +3495,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractItemView::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -3118,9 +3526,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3135,9 +3546,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3152,9 +3566,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::resizeEvent(QResizeEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3169,9 +3586,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::rowsAboutToBeRemoved(const QModelIndex&  parent, int  start, int  end)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowsAboutToBeRemoved");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowsAboutToBeRemoved");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowsAboutToBeRemoved");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&parent, (void*)&start, (void*)&end};
@@ -3186,9 +3606,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::rowsInserted(const QModelIndex&  parent, int  start, int  end)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowsInserted");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowsInserted");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowsInserted");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&parent, (void*)&start, (void*)&end};
@@ -3203,9 +3626,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::scrollContentsBy(int  dx, int  dy)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "scrollContentsBy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("scrollContentsBy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("scrollContentsBy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&dx, (void*)&dy};
@@ -3220,9 +3646,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::scrollTo(const QModelIndex&  index, QAbstractItemView::ScrollHint  hint)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "scrollTo");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("scrollTo");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("scrollTo");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "QAbstractItemView::ScrollHint"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&index, (void*)&hint};
@@ -3237,9 +3666,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::selectAll()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectAll");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectAll");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectAll");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3254,9 +3686,12 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractItemView::selectedIndexes() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectedIndexes");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectedIndexes");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectedIndexes");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QList<QModelIndex >"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QList<QModelIndex > returnValue;
@@ -3282,9 +3717,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::selectionChanged(const QItemSelection&  selected, const QItemSelection&  deselected)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectionChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectionChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectionChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QItemSelection&" , "const QItemSelection&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&selected, (void*)&deselected};
@@ -3299,9 +3737,12 @@ if (_wrapper) {
 QItemSelectionModel::SelectionFlags  PythonQtShell_QAbstractItemView::selectionCommand(const QModelIndex&  index, const QEvent*  event) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectionCommand");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectionCommand");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectionCommand");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QItemSelectionModel::SelectionFlags" , "const QModelIndex&" , "const QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QItemSelectionModel::SelectionFlags returnValue;
@@ -3327,9 +3768,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setModel(QAbstractItemModel*  model)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setModel");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setModel");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setModel");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractItemModel*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&model};
@@ -3344,9 +3788,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setRootIndex(const QModelIndex&  index)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setRootIndex");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setRootIndex");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setRootIndex");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&index};
@@ -3361,9 +3808,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setSelection(const QRect&  rect, QItemSelectionModel::SelectionFlags  command)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setSelection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setSelection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setSelection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QRect&" , "QItemSelectionModel::SelectionFlags"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&rect, (void*)&command};
@@ -3378,9 +3828,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setSelectionModel(QItemSelectionModel*  selectionModel)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setSelectionModel");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setSelectionModel");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setSelectionModel");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QItemSelectionModel*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&selectionModel};
@@ -3395,9 +3848,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3412,9 +3868,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::sizeHintForColumn(int  column) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sizeHintForColumn");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sizeHintForColumn");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sizeHintForColumn");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -3440,9 +3899,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::sizeHintForRow(int  row) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sizeHintForRow");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sizeHintForRow");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sizeHintForRow");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -3468,9 +3930,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::startDrag(Qt::DropActions  supportedActions)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDrag");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDrag");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDrag");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "Qt::DropActions"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&supportedActions};
@@ -3485,9 +3950,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3502,9 +3970,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3519,9 +3990,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::updateEditorData()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateEditorData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateEditorData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateEditorData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3536,9 +4010,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::updateEditorGeometries()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateEditorGeometries");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateEditorGeometries");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateEditorGeometries");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3553,9 +4030,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::updateGeometries()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateGeometries");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateGeometries");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateGeometries");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3570,9 +4050,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::verticalOffset() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "verticalOffset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("verticalOffset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("verticalOffset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -3598,9 +4081,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::verticalScrollbarAction(int  action)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "verticalScrollbarAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("verticalScrollbarAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("verticalScrollbarAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&action};
@@ -3615,9 +4101,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::verticalScrollbarValueChanged(int  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "verticalScrollbarValueChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("verticalScrollbarValueChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("verticalScrollbarValueChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&value};
@@ -3632,9 +4121,12 @@ if (_wrapper) {
 QStyleOptionViewItem  PythonQtShell_QAbstractItemView::viewOptions() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "viewOptions");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("viewOptions");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("viewOptions");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStyleOptionViewItem"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QStyleOptionViewItem returnValue;
@@ -3660,9 +4152,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::viewportEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "viewportEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("viewportEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("viewportEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3688,9 +4183,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QAbstractItemView::visualRect(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "visualRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("visualRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("visualRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRect returnValue;
@@ -3716,9 +4214,12 @@ if (_wrapper) {
 QRegion  PythonQtShell_QAbstractItemView::visualRegionForSelection(const QItemSelection&  selection) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "visualRegionForSelection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("visualRegionForSelection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("visualRegionForSelection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRegion" , "const QItemSelection&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRegion returnValue;
@@ -3744,9 +4245,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4147,9 +4651,12 @@ bool  PythonQtWrapper_QAbstractItemView::viewportEvent(QAbstractItemView* theWra
 void PythonQtShell_QAbstractPageSetupDialog::accept()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "accept");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("accept");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("accept");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -4164,9 +4671,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4181,9 +4691,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4198,9 +4711,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4215,9 +4731,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4232,9 +4751,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4249,9 +4771,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4266,9 +4791,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPageSetupDialog::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -4294,9 +4822,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::done(int  result)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "done");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("done");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("done");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&result};
@@ -4311,9 +4842,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4328,9 +4862,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4345,9 +4882,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4362,9 +4902,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4379,9 +4922,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4396,9 +4942,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPageSetupDialog::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4424,9 +4973,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPageSetupDialog::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -4452,9 +5004,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPageSetupDialog::exec()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "exec");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("exec");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("exec");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -4480,9 +5035,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4497,9 +5055,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPageSetupDialog::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4525,9 +5086,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4542,9 +5106,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPageSetupDialog::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -4570,9 +5137,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4587,9 +5157,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4604,9 +5177,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractPageSetupDialog::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -4632,9 +5208,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4649,9 +5228,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4666,9 +5248,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -4683,9 +5268,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4700,9 +5288,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPageSetupDialog::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -4728,9 +5319,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4745,9 +5339,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4762,9 +5359,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4779,9 +5379,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4796,9 +5399,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4813,9 +5419,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractPageSetupDialog::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -4841,9 +5450,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4858,9 +5470,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::reject()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reject");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reject");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reject");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -4875,9 +5490,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4892,9 +5510,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4909,9 +5530,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4926,9 +5550,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4943,9 +5570,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPageSetupDialog::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4976,9 +5606,12 @@ QPrinter*  PythonQtWrapper_QAbstractPageSetupDialog::printer(QAbstractPageSetupD
 void PythonQtShell_QAbstractPrintDialog::accept()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "accept");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("accept");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("accept");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -4993,9 +5626,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5010,9 +5646,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5027,9 +5666,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5044,9 +5686,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5061,9 +5706,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5078,9 +5726,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5095,9 +5746,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPrintDialog::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -5123,9 +5777,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::done(int  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "done");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("done");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("done");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5140,9 +5797,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5157,9 +5817,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5174,9 +5837,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5191,9 +5857,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5208,9 +5877,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5225,9 +5897,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPrintDialog::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5253,9 +5928,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPrintDialog::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -5281,9 +5959,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPrintDialog::exec()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "exec");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("exec");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("exec");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -5309,9 +5990,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5326,9 +6010,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPrintDialog::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5354,9 +6041,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5371,9 +6061,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPrintDialog::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -5399,9 +6092,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5416,9 +6112,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5433,9 +6132,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractPrintDialog::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -5461,9 +6163,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5478,9 +6183,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5495,9 +6203,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -5512,9 +6223,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5529,9 +6243,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPrintDialog::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -5557,9 +6274,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5574,9 +6294,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5591,9 +6314,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5608,9 +6334,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5625,9 +6354,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5642,9 +6374,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractPrintDialog::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -5670,9 +6405,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5687,9 +6425,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::reject()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reject");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reject");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reject");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -5704,9 +6445,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5721,9 +6465,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5738,9 +6485,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5755,9 +6505,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5772,9 +6525,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5865,9 +6621,12 @@ int  PythonQtWrapper_QAbstractPrintDialog::toPage(QAbstractPrintDialog* theWrapp
 void PythonQtShell_QAbstractScrollArea::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5882,9 +6641,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5899,9 +6661,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5916,9 +6681,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5933,9 +6701,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5950,9 +6721,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5967,9 +6741,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractScrollArea::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -5995,9 +6772,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6012,9 +6792,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6029,9 +6812,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6046,9 +6832,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6063,9 +6852,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6080,9 +6872,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6108,9 +6903,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -6136,9 +6934,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6153,9 +6954,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6181,9 +6985,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6198,9 +7005,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractScrollArea::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -6226,9 +7036,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6243,9 +7056,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6260,9 +7076,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractScrollArea::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -6288,9 +7107,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6305,9 +7127,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6322,9 +7147,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -6339,9 +7167,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6356,9 +7187,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractScrollArea::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -6384,9 +7218,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6401,9 +7238,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6418,9 +7258,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6435,9 +7278,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6452,9 +7298,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6469,9 +7318,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractScrollArea::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -6497,9 +7349,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6514,9 +7369,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6531,9 +7389,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::scrollContentsBy(int  dx, int  dy)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "scrollContentsBy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("scrollContentsBy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("scrollContentsBy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&dx, (void*)&dy};
@@ -6548,9 +7409,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6565,9 +7429,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6582,9 +7449,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6599,9 +7469,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::viewportEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "viewportEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("viewportEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("viewportEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6627,9 +7500,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6815,9 +7691,12 @@ void PythonQtWrapper_QAbstractScrollArea::wheelEvent(QAbstractScrollArea* theWra
 void PythonQtShell_QAbstractSlider::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6832,9 +7711,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::changeEvent(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -6849,9 +7731,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6866,9 +7751,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6883,9 +7771,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6900,9 +7791,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6917,9 +7811,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSlider::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -6945,9 +7842,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6962,9 +7862,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6979,9 +7882,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6996,9 +7902,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7013,9 +7922,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7030,9 +7942,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSlider::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -7058,9 +7973,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSlider::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -7086,9 +8004,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7103,9 +8024,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSlider::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -7131,9 +8055,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7148,9 +8075,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSlider::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -7176,9 +8106,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7193,9 +8126,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7210,9 +8146,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractSlider::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -7238,9 +8177,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::keyPressEvent(QKeyEvent*  ev)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&ev};
@@ -7255,9 +8197,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7272,9 +8217,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -7289,9 +8237,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7306,9 +8257,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSlider::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -7334,9 +8288,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractSlider::minimumSizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getMinimumSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getMinimumSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getMinimumSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -7362,9 +8319,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7379,9 +8339,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7396,9 +8359,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7413,9 +8379,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7430,9 +8399,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7447,9 +8419,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractSlider::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -7475,9 +8450,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7492,9 +8470,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7509,9 +8490,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7526,9 +8510,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractSlider::sizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -7554,9 +8541,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::sliderChange(QAbstractSlider::SliderChange  change)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sliderChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sliderChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sliderChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractSlider::SliderChange"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&change};
@@ -7571,9 +8561,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7588,9 +8581,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7605,9 +8601,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::wheelEvent(QWheelEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -7763,9 +8762,12 @@ void PythonQtWrapper_QAbstractSlider::wheelEvent(QAbstractSlider* theWrappedObje
 void PythonQtShell_QAbstractSpinBox::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7780,9 +8782,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::changeEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7797,9 +8802,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7814,9 +8822,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::clear()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "clear");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("clear");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("clear");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -7831,9 +8842,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::closeEvent(QCloseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7848,9 +8862,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::contextMenuEvent(QContextMenuEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7865,9 +8882,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7882,9 +8902,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSpinBox::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -7910,9 +8933,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7927,9 +8953,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7944,9 +8973,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7961,9 +8993,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7978,9 +9013,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7995,9 +9033,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSpinBox::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -8023,9 +9064,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSpinBox::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -8051,9 +9095,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::fixup(QString&  input) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fixup");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fixup");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fixup");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&input};
@@ -8068,9 +9115,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::focusInEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8085,9 +9135,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSpinBox::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -8113,9 +9166,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::focusOutEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8130,9 +9186,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSpinBox::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -8158,9 +9217,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::hideEvent(QHideEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8175,9 +9237,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8192,9 +9257,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractSpinBox::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -8220,9 +9288,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::keyPressEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8237,9 +9308,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::keyReleaseEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8254,9 +9328,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -8271,9 +9348,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8288,9 +9368,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSpinBox::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -8316,9 +9399,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8333,9 +9419,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::mouseMoveEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8350,9 +9439,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::mousePressEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8367,9 +9459,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::mouseReleaseEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8384,9 +9479,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8401,9 +9499,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractSpinBox::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -8429,9 +9530,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::paintEvent(QPaintEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8446,9 +9550,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::resizeEvent(QResizeEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8463,9 +9570,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::showEvent(QShowEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8480,9 +9590,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::stepBy(int  steps)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "stepBy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("stepBy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("stepBy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&steps};
@@ -8497,9 +9610,12 @@ if (_wrapper) {
 QAbstractSpinBox::StepEnabled  PythonQtShell_QAbstractSpinBox::stepEnabled() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "stepEnabled");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("stepEnabled");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("stepEnabled");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAbstractSpinBox::StepEnabled"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAbstractSpinBox::StepEnabled returnValue;
@@ -8525,9 +9641,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8542,9 +9661,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8559,9 +9681,12 @@ if (_wrapper) {
 QValidator::State  PythonQtShell_QAbstractSpinBox::validate(QString&  input, int&  pos) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "validate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("validate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("validate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QValidator::State" , "QString&" , "int&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QValidator::State returnValue;
@@ -8587,9 +9712,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::wheelEvent(QWheelEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8835,9 +9963,12 @@ bool  PythonQtWrapper_QAbstractSpinBox::wrapping(QAbstractSpinBox* theWrappedObj
 QModelIndex  PythonQtShell_QAbstractTableModel::buddy(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "buddy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("buddy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("buddy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QModelIndex returnValue;
@@ -8863,9 +9994,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::canFetchMore(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "canFetchMore");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("canFetchMore");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("canFetchMore");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -8891,9 +10025,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8908,9 +10045,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractTableModel::columnCount(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -8936,9 +10076,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8953,9 +10096,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractTableModel::data(const QModelIndex&  index, int  role) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "data");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("data");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("data");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QModelIndex&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QVariant returnValue;
@@ -8981,9 +10127,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::dropMimeData(const QMimeData*  data, Qt::DropAction  action, int  row, int  column, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropMimeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropMimeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropMimeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QMimeData*" , "Qt::DropAction" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       bool returnValue;
@@ -9009,9 +10158,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -9037,9 +10189,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -9065,9 +10220,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::fetchMore(const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fetchMore");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fetchMore");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fetchMore");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&parent};
@@ -9082,9 +10240,12 @@ if (_wrapper) {
 Qt::ItemFlags  PythonQtShell_QAbstractTableModel::flags(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "flags");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("flags");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("flags");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"Qt::ItemFlags" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       Qt::ItemFlags returnValue;
@@ -9110,9 +10271,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractTableModel::headerData(int  section, Qt::Orientation  orientation, int  role) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "headerData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("headerData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("headerData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "int" , "Qt::Orientation" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QVariant returnValue;
@@ -9138,9 +10302,12 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractTableModel::index(int  row, int  column, const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "index");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("index");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("index");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QModelIndex returnValue;
@@ -9166,9 +10333,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::insertColumns(int  column, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "insertColumns");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("insertColumns");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("insertColumns");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -9194,9 +10364,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::insertRows(int  row, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "insertRows");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("insertRows");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("insertRows");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -9222,9 +10395,12 @@ if (_wrapper) {
 QMap<int , QVariant >  PythonQtShell_QAbstractTableModel::itemData(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "itemData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("itemData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("itemData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QMap<int , QVariant >" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QMap<int , QVariant > returnValue;
@@ -9250,9 +10426,12 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractTableModel::match(const QModelIndex&  start, int  role, const QVariant&  value, int  hits, Qt::MatchFlags  flags) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "match");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("match");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("match");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QList<QModelIndex >" , "const QModelIndex&" , "int" , "const QVariant&" , "int" , "Qt::MatchFlags"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       QList<QModelIndex > returnValue;
@@ -9278,9 +10457,12 @@ if (_wrapper) {
 QMimeData*  PythonQtShell_QAbstractTableModel::mimeData(const QList<QModelIndex >&  indexes) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mimeData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mimeData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mimeData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QMimeData*" , "const QList<QModelIndex >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QMimeData* returnValue;
@@ -9306,9 +10488,12 @@ if (_wrapper) {
 QStringList  PythonQtShell_QAbstractTableModel::mimeTypes() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mimeTypes");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mimeTypes");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mimeTypes");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStringList"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QStringList returnValue;
@@ -9334,9 +10519,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::removeColumns(int  column, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "removeColumns");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("removeColumns");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("removeColumns");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -9362,9 +10550,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::removeRows(int  row, int  count, const QModelIndex&  parent)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "removeRows");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("removeRows");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("removeRows");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -9390,9 +10581,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::revert()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "revert");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("revert");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("revert");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -9407,9 +10601,12 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractTableModel::rowCount(const QModelIndex&  parent) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -9435,9 +10632,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::setData(const QModelIndex&  index, const QVariant&  value, int  role)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&" , "const QVariant&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -9463,9 +10663,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::setHeaderData(int  section, Qt::Orientation  orientation, const QVariant&  value, int  role)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setHeaderData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setHeaderData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setHeaderData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "Qt::Orientation" , "const QVariant&" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -9491,9 +10694,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::setItemData(const QModelIndex&  index, const QMap<int , QVariant >&  roles)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setItemData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setItemData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setItemData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&" , "const QMap<int , QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -9519,9 +10725,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::sort(int  column, Qt::SortOrder  order)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sort");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sort");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sort");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int" , "Qt::SortOrder"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&column, (void*)&order};
@@ -9536,9 +10745,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractTableModel::span(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "span");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("span");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("span");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QSize returnValue;
@@ -9564,9 +10776,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::submit()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "submit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("submit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("submit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -9592,9 +10807,12 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractTableModel::supportedDropActions() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "supportedDropActions");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("supportedDropActions");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("supportedDropActions");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"Qt::DropActions"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       Qt::DropActions returnValue;
@@ -9620,9 +10838,12 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9685,9 +10906,12 @@ return new PythonQtShell_QAccessible2Interface(); }
 void PythonQtShell_QAccessibleBridge::notifyAccessibilityUpdate(int  arg__1, QAccessibleInterface*  arg__2, int  arg__3)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "notifyAccessibilityUpdate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("notifyAccessibilityUpdate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("notifyAccessibilityUpdate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int" , "QAccessibleInterface*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&arg__1, (void*)&arg__2, (void*)&arg__3};
@@ -9702,9 +10926,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleBridge::setRootObject(QAccessibleInterface*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setRootObject");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setRootObject");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setRootObject");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9746,9 +10973,12 @@ QString  PythonQtWrapper_QAccessibleEvent::value(QAccessibleEvent* theWrappedObj
 QString  PythonQtShell_QAccessibleInterface::actionText(int  action, QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "int" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QString returnValue;
@@ -9774,9 +11004,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterface::childAt(int  x, int  y) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -9802,9 +11035,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterface::childCount() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -9830,9 +11066,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleInterface::doAction(int  action, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "doAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("doAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("doAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -9858,9 +11097,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterface::indexOfChild(const QAccessibleInterface*  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexOfChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexOfChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexOfChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -9886,9 +11128,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleInterface::isValid() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isValid");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isValid");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isValid");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -9914,9 +11159,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterface::navigate(QAccessible::RelationFlag  relation, int  index, QAccessibleInterface**  iface) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "navigate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("navigate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("navigate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QAccessible::RelationFlag" , "int" , "QAccessibleInterface**"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -9942,9 +11190,12 @@ if (_wrapper) {
 QObject*  PythonQtShell_QAccessibleInterface::object() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "object");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("object");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("object");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QObject* returnValue;
@@ -9970,9 +11221,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QAccessibleInterface::rect(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRect returnValue;
@@ -9998,9 +11252,12 @@ if (_wrapper) {
 QAccessible::Relation  PythonQtShell_QAccessibleInterface::relationTo(int  child, const QAccessibleInterface*  other, int  otherChild) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "relationTo");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("relationTo");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("relationTo");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Relation" , "int" , "const QAccessibleInterface*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QAccessible::Relation returnValue;
@@ -10026,9 +11283,12 @@ if (_wrapper) {
 QAccessible::Role  PythonQtShell_QAccessibleInterface::role(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "role");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("role");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("role");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Role" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::Role returnValue;
@@ -10054,9 +11314,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleInterface::setText(QAccessible::Text  t, int  child, const QString&  text)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAccessible::Text" , "int" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&t, (void*)&child, (void*)&text};
@@ -10071,9 +11334,12 @@ if (_wrapper) {
 QAccessible::State  PythonQtShell_QAccessibleInterface::state(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "state");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("state");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("state");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::State" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::State returnValue;
@@ -10099,9 +11365,12 @@ if (_wrapper) {
 QString  PythonQtShell_QAccessibleInterface::text(QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "text");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("text");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("text");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -10127,9 +11396,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterface::userActionCount(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "userActionCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("userActionCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("userActionCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -10171,9 +11443,12 @@ QSet<QAccessible::Method >  PythonQtWrapper_QAccessibleInterface::supportedMetho
 QString  PythonQtShell_QAccessibleInterfaceEx::actionText(int  action, QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "int" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QString returnValue;
@@ -10199,9 +11474,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterfaceEx::childAt(int  x, int  y) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -10227,9 +11505,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterfaceEx::childCount() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -10255,9 +11536,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleInterfaceEx::doAction(int  action, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "doAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("doAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("doAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -10283,9 +11567,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterfaceEx::indexOfChild(const QAccessibleInterface*  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexOfChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexOfChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexOfChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -10311,9 +11598,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAccessibleInterfaceEx::invokeMethodEx(QAccessible::Method  method, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "invokeMethodEx");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("invokeMethodEx");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("invokeMethodEx");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "QAccessible::Method" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QVariant returnValue;
@@ -10339,9 +11629,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleInterfaceEx::isValid() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isValid");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isValid");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isValid");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -10367,9 +11660,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterfaceEx::navigate(QAccessible::RelationFlag  relation, int  index, QAccessibleInterface**  iface) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "navigate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("navigate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("navigate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QAccessible::RelationFlag" , "int" , "QAccessibleInterface**"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -10395,9 +11691,12 @@ if (_wrapper) {
 QObject*  PythonQtShell_QAccessibleInterfaceEx::object() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "object");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("object");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("object");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QObject* returnValue;
@@ -10423,9 +11722,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QAccessibleInterfaceEx::rect(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRect returnValue;
@@ -10451,9 +11753,12 @@ if (_wrapper) {
 QAccessible::Relation  PythonQtShell_QAccessibleInterfaceEx::relationTo(int  child, const QAccessibleInterface*  other, int  otherChild) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "relationTo");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("relationTo");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("relationTo");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Relation" , "int" , "const QAccessibleInterface*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QAccessible::Relation returnValue;
@@ -10479,9 +11784,12 @@ if (_wrapper) {
 QAccessible::Role  PythonQtShell_QAccessibleInterfaceEx::role(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "role");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("role");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("role");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Role" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::Role returnValue;
@@ -10507,9 +11815,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleInterfaceEx::setText(QAccessible::Text  t, int  child, const QString&  text)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAccessible::Text" , "int" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&t, (void*)&child, (void*)&text};
@@ -10524,9 +11835,12 @@ if (_wrapper) {
 QAccessible::State  PythonQtShell_QAccessibleInterfaceEx::state(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "state");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("state");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("state");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::State" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::State returnValue;
@@ -10552,9 +11866,12 @@ if (_wrapper) {
 QString  PythonQtShell_QAccessibleInterfaceEx::text(QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "text");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("text");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("text");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -10580,9 +11897,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleInterfaceEx::userActionCount(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "userActionCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("userActionCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("userActionCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -10608,9 +11928,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAccessibleInterfaceEx::virtual_hook(const QVariant&  data)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "virtual_hook");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("virtual_hook");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("virtual_hook");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QVariant&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -10647,9 +11970,12 @@ QVariant  PythonQtWrapper_QAccessibleInterfaceEx::virtual_hook(QAccessibleInterf
 QString  PythonQtShell_QAccessibleObject::actionText(int  action, QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "int" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QString returnValue;
@@ -10675,9 +12001,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObject::childAt(int  x, int  y) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -10703,9 +12032,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObject::childCount() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -10731,9 +12063,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleObject::doAction(int  action, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "doAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("doAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("doAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -10759,9 +12094,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObject::indexOfChild(const QAccessibleInterface*  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexOfChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexOfChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexOfChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -10787,9 +12125,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleObject::isValid() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isValid");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isValid");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isValid");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -10815,9 +12156,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObject::navigate(QAccessible::RelationFlag  relation, int  index, QAccessibleInterface**  iface) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "navigate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("navigate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("navigate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QAccessible::RelationFlag" , "int" , "QAccessibleInterface**"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -10843,9 +12187,12 @@ if (_wrapper) {
 QObject*  PythonQtShell_QAccessibleObject::object() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "object");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("object");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("object");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QObject* returnValue;
@@ -10871,9 +12218,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QAccessibleObject::rect(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRect returnValue;
@@ -10899,9 +12249,12 @@ if (_wrapper) {
 QAccessible::Relation  PythonQtShell_QAccessibleObject::relationTo(int  child, const QAccessibleInterface*  other, int  otherChild) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "relationTo");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("relationTo");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("relationTo");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Relation" , "int" , "const QAccessibleInterface*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QAccessible::Relation returnValue;
@@ -10927,9 +12280,12 @@ if (_wrapper) {
 QAccessible::Role  PythonQtShell_QAccessibleObject::role(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "role");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("role");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("role");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Role" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::Role returnValue;
@@ -10955,9 +12311,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleObject::setText(QAccessible::Text  t, int  child, const QString&  text)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAccessible::Text" , "int" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&t, (void*)&child, (void*)&text};
@@ -10972,9 +12331,12 @@ if (_wrapper) {
 QAccessible::State  PythonQtShell_QAccessibleObject::state(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "state");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("state");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("state");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::State" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::State returnValue;
@@ -11000,9 +12362,12 @@ if (_wrapper) {
 QString  PythonQtShell_QAccessibleObject::text(QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "text");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("text");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("text");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -11028,9 +12393,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObject::userActionCount(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "userActionCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("userActionCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("userActionCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -11097,9 +12465,12 @@ int  PythonQtWrapper_QAccessibleObject::userActionCount(QAccessibleObject* theWr
 QString  PythonQtShell_QAccessibleObjectEx::actionText(int  action, QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "int" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QString returnValue;
@@ -11125,9 +12496,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObjectEx::childAt(int  x, int  y) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -11153,9 +12527,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObjectEx::childCount() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -11181,9 +12558,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleObjectEx::doAction(int  action, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "doAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("doAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("doAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -11209,9 +12589,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObjectEx::indexOfChild(const QAccessibleInterface*  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexOfChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexOfChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexOfChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -11237,9 +12620,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAccessibleObjectEx::invokeMethodEx(QAccessible::Method  method, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "invokeMethodEx");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("invokeMethodEx");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("invokeMethodEx");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "QAccessible::Method" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QVariant returnValue;
@@ -11265,9 +12651,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleObjectEx::isValid() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isValid");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isValid");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isValid");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -11293,9 +12682,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObjectEx::navigate(QAccessible::RelationFlag  relation, int  index, QAccessibleInterface**  iface) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "navigate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("navigate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("navigate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QAccessible::RelationFlag" , "int" , "QAccessibleInterface**"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -11321,9 +12713,12 @@ if (_wrapper) {
 QObject*  PythonQtShell_QAccessibleObjectEx::object() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "object");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("object");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("object");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QObject* returnValue;
@@ -11349,9 +12744,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QAccessibleObjectEx::rect(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRect returnValue;
@@ -11377,9 +12775,12 @@ if (_wrapper) {
 QAccessible::Relation  PythonQtShell_QAccessibleObjectEx::relationTo(int  child, const QAccessibleInterface*  other, int  otherChild) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "relationTo");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("relationTo");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("relationTo");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Relation" , "int" , "const QAccessibleInterface*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QAccessible::Relation returnValue;
@@ -11405,9 +12806,12 @@ if (_wrapper) {
 QAccessible::Role  PythonQtShell_QAccessibleObjectEx::role(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "role");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("role");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("role");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Role" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::Role returnValue;
@@ -11433,9 +12837,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleObjectEx::setText(QAccessible::Text  t, int  child, const QString&  text)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAccessible::Text" , "int" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&t, (void*)&child, (void*)&text};
@@ -11450,9 +12857,12 @@ if (_wrapper) {
 QAccessible::State  PythonQtShell_QAccessibleObjectEx::state(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "state");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("state");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("state");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::State" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::State returnValue;
@@ -11478,9 +12888,12 @@ if (_wrapper) {
 QString  PythonQtShell_QAccessibleObjectEx::text(QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "text");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("text");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("text");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -11506,9 +12919,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleObjectEx::userActionCount(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "userActionCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("userActionCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("userActionCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -11534,9 +12950,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAccessibleObjectEx::virtual_hook(const QVariant&  data)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "virtual_hook");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("virtual_hook");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("virtual_hook");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QVariant&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -11603,9 +13022,12 @@ int  PythonQtWrapper_QAccessibleObjectEx::userActionCount(QAccessibleObjectEx* t
 void PythonQtShell_QAccessiblePlugin::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11620,9 +13042,12 @@ if (_wrapper) {
 QAccessibleInterface*  PythonQtShell_QAccessiblePlugin::create(const QString&  key, QObject*  object)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "create");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("create");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("create");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessibleInterface*" , "const QString&" , "QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QAccessibleInterface* returnValue;
@@ -11648,9 +13073,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessiblePlugin::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11665,9 +13093,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessiblePlugin::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -11693,9 +13124,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessiblePlugin::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -11721,9 +13155,12 @@ if (_wrapper) {
 QStringList  PythonQtShell_QAccessiblePlugin::keys() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keys");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keys");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keys");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStringList"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QStringList returnValue;
@@ -11749,9 +13186,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessiblePlugin::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11772,9 +13212,12 @@ return new PythonQtShell_QAccessiblePlugin(parent); }
 QAccessibleInterface*  PythonQtShell_QAccessibleTableInterface::accessibleAt(int  row, int  column)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "accessibleAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("accessibleAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("accessibleAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessibleInterface*" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QAccessibleInterface* returnValue;
@@ -11800,9 +13243,12 @@ if (_wrapper) {
 QAccessibleInterface*  PythonQtShell_QAccessibleTableInterface::caption()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "caption");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("caption");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("caption");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAccessibleInterface* returnValue;
@@ -11828,9 +13274,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleTableInterface::cellAtIndex(int  index, int*  row, int*  column, int*  rowSpan, int*  columnSpan, bool*  isSelected)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "cellAtIndex");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("cellAtIndex");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("cellAtIndex");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int" , "int*" , "int*" , "int*" , "int*" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(7, argumentList);
     void* args[7] = {NULL, (void*)&index, (void*)&row, (void*)&column, (void*)&rowSpan, (void*)&columnSpan, (void*)&isSelected};
@@ -11845,9 +13294,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::childIndex(int  rowIndex, int  columnIndex)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childIndex");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childIndex");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childIndex");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -11873,9 +13325,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::columnCount()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -11901,9 +13356,12 @@ if (_wrapper) {
 QString  PythonQtShell_QAccessibleTableInterface::columnDescription(int  column)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnDescription");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnDescription");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnDescription");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QString returnValue;
@@ -11929,9 +13387,12 @@ if (_wrapper) {
 QAccessibleInterface*  PythonQtShell_QAccessibleTableInterface::columnHeader()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnHeader");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnHeader");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnHeader");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAccessibleInterface* returnValue;
@@ -11957,9 +13418,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::columnIndex(int  childIndex)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnIndex");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnIndex");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnIndex");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -11985,9 +13449,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::columnSpan(int  row, int  column)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnSpan");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnSpan");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnSpan");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -12013,9 +13480,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleTableInterface::isColumnSelected(int  column)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isColumnSelected");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isColumnSelected");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isColumnSelected");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -12041,9 +13511,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleTableInterface::isRowSelected(int  row)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isRowSelected");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isRowSelected");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isRowSelected");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -12069,9 +13542,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleTableInterface::isSelected(int  row, int  column)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isSelected");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isSelected");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isSelected");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -12097,9 +13573,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::rowCount()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -12125,9 +13604,12 @@ if (_wrapper) {
 QString  PythonQtShell_QAccessibleTableInterface::rowDescription(int  row)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowDescription");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowDescription");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowDescription");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QString returnValue;
@@ -12153,9 +13635,12 @@ if (_wrapper) {
 QAccessibleInterface*  PythonQtShell_QAccessibleTableInterface::rowHeader()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowHeader");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowHeader");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowHeader");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAccessibleInterface* returnValue;
@@ -12181,9 +13666,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::rowIndex(int  childIndex)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowIndex");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowIndex");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowIndex");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -12209,9 +13697,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::rowSpan(int  row, int  column)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowSpan");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowSpan");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowSpan");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -12237,9 +13728,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleTableInterface::selectColumn(int  column)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectColumn");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectColumn");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectColumn");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&column};
@@ -12254,9 +13748,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleTableInterface::selectRow(int  row)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectRow");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectRow");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectRow");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&row};
@@ -12271,9 +13768,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::selectedColumnCount()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectedColumnCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectedColumnCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectedColumnCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -12299,9 +13799,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::selectedColumns(int  maxColumns, QList<int >*  columns)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectedColumns");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectedColumns");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectedColumns");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "QList<int >*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -12327,9 +13830,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::selectedRowCount()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectedRowCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectedRowCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectedRowCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -12355,9 +13861,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleTableInterface::selectedRows(int  maxRows, QList<int >*  rows)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectedRows");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectedRows");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectedRows");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "QList<int >*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -12383,9 +13892,12 @@ if (_wrapper) {
 QAccessibleInterface*  PythonQtShell_QAccessibleTableInterface::summary()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "summary");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("summary");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("summary");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAccessibleInterface* returnValue;
@@ -12411,9 +13923,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleTableInterface::unselectColumn(int  column)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unselectColumn");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unselectColumn");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unselectColumn");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&column};
@@ -12428,9 +13943,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleTableInterface::unselectRow(int  row)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unselectRow");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unselectRow");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unselectRow");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&row};
@@ -12451,9 +13969,12 @@ return new PythonQtShell_QAccessibleTableInterface(); }
 QString  PythonQtShell_QAccessibleWidget::actionText(int  action, QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "int" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QString returnValue;
@@ -12479,9 +14000,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidget::childAt(int  x, int  y) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -12507,9 +14031,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidget::childCount() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -12535,9 +14062,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleWidget::doAction(int  action, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "doAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("doAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("doAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -12563,9 +14093,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidget::indexOfChild(const QAccessibleInterface*  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexOfChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexOfChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexOfChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -12591,9 +14124,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleWidget::isValid() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isValid");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isValid");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isValid");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -12619,9 +14155,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidget::navigate(QAccessible::RelationFlag  rel, int  entry, QAccessibleInterface**  target) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "navigate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("navigate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("navigate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QAccessible::RelationFlag" , "int" , "QAccessibleInterface**"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -12647,9 +14186,12 @@ if (_wrapper) {
 QObject*  PythonQtShell_QAccessibleWidget::object() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "object");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("object");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("object");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QObject* returnValue;
@@ -12675,9 +14217,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QAccessibleWidget::rect(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRect returnValue;
@@ -12703,9 +14248,12 @@ if (_wrapper) {
 QAccessible::Relation  PythonQtShell_QAccessibleWidget::relationTo(int  child, const QAccessibleInterface*  other, int  otherChild) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "relationTo");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("relationTo");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("relationTo");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Relation" , "int" , "const QAccessibleInterface*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QAccessible::Relation returnValue;
@@ -12731,9 +14279,12 @@ if (_wrapper) {
 QAccessible::Role  PythonQtShell_QAccessibleWidget::role(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "role");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("role");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("role");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Role" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::Role returnValue;
@@ -12759,9 +14310,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleWidget::setText(QAccessible::Text  t, int  child, const QString&  text)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAccessible::Text" , "int" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&t, (void*)&child, (void*)&text};
@@ -12776,9 +14330,12 @@ if (_wrapper) {
 QAccessible::State  PythonQtShell_QAccessibleWidget::state(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "state");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("state");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("state");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::State" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::State returnValue;
@@ -12804,9 +14361,12 @@ if (_wrapper) {
 QString  PythonQtShell_QAccessibleWidget::text(QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "text");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("text");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("text");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -12832,9 +14392,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidget::userActionCount(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "userActionCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("userActionCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("userActionCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -12926,9 +14489,12 @@ int  PythonQtWrapper_QAccessibleWidget::userActionCount(QAccessibleWidget* theWr
 QString  PythonQtShell_QAccessibleWidgetEx::actionText(int  action, QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "int" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QString returnValue;
@@ -12954,9 +14520,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidgetEx::childAt(int  x, int  y) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       int returnValue;
@@ -12982,9 +14551,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidgetEx::childCount() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -13010,9 +14582,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleWidgetEx::doAction(int  action, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "doAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("doAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("doAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "int" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -13038,9 +14613,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidgetEx::indexOfChild(const QAccessibleInterface*  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexOfChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexOfChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexOfChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "const QAccessibleInterface*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -13066,9 +14644,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAccessibleWidgetEx::invokeMethodEx(QAccessible::Method  method, int  child, const QList<QVariant >&  params)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "invokeMethodEx");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("invokeMethodEx");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("invokeMethodEx");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "QAccessible::Method" , "int" , "const QList<QVariant >&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QVariant returnValue;
@@ -13094,9 +14675,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAccessibleWidgetEx::isValid() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isValid");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isValid");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isValid");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -13122,9 +14706,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidgetEx::navigate(QAccessible::RelationFlag  rel, int  entry, QAccessibleInterface**  target) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "navigate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("navigate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("navigate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QAccessible::RelationFlag" , "int" , "QAccessibleInterface**"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -13150,9 +14737,12 @@ if (_wrapper) {
 QObject*  PythonQtShell_QAccessibleWidgetEx::object() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "object");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("object");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("object");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QObject* returnValue;
@@ -13178,9 +14768,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QAccessibleWidgetEx::rect(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRect returnValue;
@@ -13206,9 +14799,12 @@ if (_wrapper) {
 QAccessible::Relation  PythonQtShell_QAccessibleWidgetEx::relationTo(int  child, const QAccessibleInterface*  other, int  otherChild) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "relationTo");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("relationTo");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("relationTo");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Relation" , "int" , "const QAccessibleInterface*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QAccessible::Relation returnValue;
@@ -13234,9 +14830,12 @@ if (_wrapper) {
 QAccessible::Role  PythonQtShell_QAccessibleWidgetEx::role(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "role");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("role");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("role");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::Role" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::Role returnValue;
@@ -13262,9 +14861,12 @@ if (_wrapper) {
 void PythonQtShell_QAccessibleWidgetEx::setText(QAccessible::Text  t, int  child, const QString&  text)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAccessible::Text" , "int" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&t, (void*)&child, (void*)&text};
@@ -13279,9 +14881,12 @@ if (_wrapper) {
 QAccessible::State  PythonQtShell_QAccessibleWidgetEx::state(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "state");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("state");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("state");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAccessible::State" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAccessible::State returnValue;
@@ -13307,9 +14912,12 @@ if (_wrapper) {
 QString  PythonQtShell_QAccessibleWidgetEx::text(QAccessible::Text  t, int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "text");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("text");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("text");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "QAccessible::Text" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -13335,9 +14943,12 @@ if (_wrapper) {
 int  PythonQtShell_QAccessibleWidgetEx::userActionCount(int  child) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "userActionCount");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("userActionCount");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("userActionCount");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -13363,9 +14974,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAccessibleWidgetEx::virtual_hook(const QVariant&  data)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "virtual_hook");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("virtual_hook");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("virtual_hook");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "const QVariant&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -13457,9 +15071,12 @@ QString  PythonQtWrapper_QAccessibleWidgetEx::text(QAccessibleWidgetEx* theWrapp
 void PythonQtShell_QAction::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13474,9 +15091,12 @@ if (_wrapper) {
 void PythonQtShell_QAction::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13491,9 +15111,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAction::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -13519,9 +15142,12 @@ if (_wrapper) {
 bool  PythonQtShell_QAction::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -13547,9 +15173,12 @@ if (_wrapper) {
 void PythonQtShell_QAction::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13844,9 +15473,12 @@ QAction*  PythonQtWrapper_QActionEvent::before(QActionEvent* theWrappedObject) c
 void PythonQtShell_QActionGroup::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13861,9 +15493,12 @@ if (_wrapper) {
 void PythonQtShell_QActionGroup::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13878,9 +15513,12 @@ if (_wrapper) {
 bool  PythonQtShell_QActionGroup::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -13906,9 +15544,12 @@ if (_wrapper) {
 bool  PythonQtShell_QActionGroup::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -13934,9 +15575,12 @@ if (_wrapper) {
 void PythonQtShell_QActionGroup::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14002,9 +15646,12 @@ void PythonQtWrapper_QActionGroup::removeAction(QActionGroup* theWrappedObject,
 void PythonQtShell_QApplication::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14019,9 +15666,12 @@ if (_wrapper) {
 void PythonQtShell_QApplication::commitData(QSessionManager&  sm)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "commitData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("commitData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("commitData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QSessionManager&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&sm};
@@ -14036,9 +15686,12 @@ if (_wrapper) {
 void PythonQtShell_QApplication::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14053,9 +15706,12 @@ if (_wrapper) {
 bool  PythonQtShell_QApplication::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -14081,9 +15737,12 @@ if (_wrapper) {
 bool  PythonQtShell_QApplication::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -14109,9 +15768,12 @@ if (_wrapper) {
 bool  PythonQtShell_QApplication::notify(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "notify");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("notify");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("notify");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -14137,9 +15799,12 @@ if (_wrapper) {
 void PythonQtShell_QApplication::saveState(QSessionManager&  sm)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "saveState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("saveState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("saveState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QSessionManager&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&sm};
@@ -14154,9 +15819,12 @@ if (_wrapper) {
 void PythonQtShell_QApplication::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14533,9 +16201,12 @@ QIcon  PythonQtWrapper_QApplication::static_QApplication_windowIcon()
 void PythonQtShell_QBoxLayout::addItem(QLayoutItem*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "addItem");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("addItem");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("addItem");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QLayoutItem*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14550,9 +16221,12 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::childEvent(QChildEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -14567,9 +16241,12 @@ if (_wrapper) {
 int  PythonQtShell_QBoxLayout::count() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "count");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("count");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("count");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -14595,9 +16272,12 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14612,9 +16292,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBoxLayout::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -14640,9 +16323,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBoxLayout::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -14668,9 +16354,12 @@ if (_wrapper) {
 Qt::Orientations  PythonQtShell_QBoxLayout::expandingDirections() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "expandingDirections");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("expandingDirections");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("expandingDirections");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"Qt::Orientations"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       Qt::Orientations returnValue;
@@ -14696,9 +16385,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QBoxLayout::geometry() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "geometry");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("geometry");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("geometry");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QRect returnValue;
@@ -14724,9 +16416,12 @@ if (_wrapper) {
 int  PythonQtShell_QBoxLayout::indexOf(QWidget*  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexOf");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexOf");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexOf");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -14752,9 +16447,12 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::invalidate()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "invalidate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("invalidate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("invalidate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -14769,9 +16467,12 @@ if (_wrapper) {
 bool  PythonQtShell_QBoxLayout::isEmpty() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isEmpty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isEmpty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isEmpty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -14797,9 +16498,12 @@ if (_wrapper) {
 QLayoutItem*  PythonQtShell_QBoxLayout::itemAt(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "itemAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("itemAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("itemAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QLayoutItem*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QLayoutItem* returnValue;
@@ -14825,9 +16529,12 @@ if (_wrapper) {
 QLayout*  PythonQtShell_QBoxLayout::layout()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "layout");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("layout");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("layout");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QLayout*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QLayout* returnValue;
@@ -14853,9 +16560,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QBoxLayout::maximumSize() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "maximumSize");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("maximumSize");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("maximumSize");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -14881,9 +16591,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QBoxLayout::minimumSize() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "minimumSize");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("minimumSize");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("minimumSize");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -14909,9 +16622,12 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::setGeometry(const QRect&  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setGeometry");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setGeometry");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setGeometry");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QRect&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14926,9 +16642,12 @@ if (_wrapper) {
 QLayoutItem*  PythonQtShell_QBoxLayout::takeAt(int  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "takeAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("takeAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("takeAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QLayoutItem*" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QLayoutItem* returnValue;
@@ -14954,9 +16673,12 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15137,9 +16859,12 @@ QLayoutItem*  PythonQtWrapper_QBoxLayout::takeAt(QBoxLayout* theWrappedObject, i
 void PythonQtShell_QButtonGroup::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15154,9 +16879,12 @@ if (_wrapper) {
 void PythonQtShell_QButtonGroup::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15171,9 +16899,12 @@ if (_wrapper) {
 bool  PythonQtShell_QButtonGroup::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -15199,9 +16930,12 @@ if (_wrapper) {
 bool  PythonQtShell_QButtonGroup::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -15227,9 +16961,12 @@ if (_wrapper) {
 void PythonQtShell_QButtonGroup::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15305,9 +17042,12 @@ void PythonQtWrapper_QButtonGroup::setId(QButtonGroup* theWrappedObject, QAbstra
 void PythonQtShell_QCDEStyle::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15322,9 +17062,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15339,9 +17082,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::drawComplexControl(QStyle::ComplexControl  cc, const QStyleOptionComplex*  opt, QPainter*  p, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawComplexControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawComplexControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawComplexControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&cc, (void*)&opt, (void*)&p, (void*)&w};
@@ -15356,9 +17102,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::drawControl(QStyle::ControlElement  element, const QStyleOption*  opt, QPainter*  p, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::ControlElement" , "const QStyleOption*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&element, (void*)&opt, (void*)&p, (void*)&w};
@@ -15373,9 +17122,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::drawItemPixmap(QPainter*  painter, const QRect&  rect, int  alignment, const QPixmap&  pixmap) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawItemPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawItemPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawItemPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QRect&" , "int" , "const QPixmap&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&painter, (void*)&rect, (void*)&alignment, (void*)&pixmap};
@@ -15390,9 +17142,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::drawItemText(QPainter*  painter, const QRect&  rect, int  flags, const QPalette&  pal, bool  enabled, const QString&  text, QPalette::ColorRole  textRole) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawItemText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawItemText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawItemText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QRect&" , "int" , "const QPalette&" , "bool" , "const QString&" , "QPalette::ColorRole"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(8, argumentList);
     void* args[8] = {NULL, (void*)&painter, (void*)&rect, (void*)&flags, (void*)&pal, (void*)&enabled, (void*)&text, (void*)&textRole};
@@ -15407,9 +17162,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::drawPrimitive(QStyle::PrimitiveElement  pe, const QStyleOption*  opt, QPainter*  p, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawPrimitive");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawPrimitive");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawPrimitive");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::PrimitiveElement" , "const QStyleOption*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&pe, (void*)&opt, (void*)&p, (void*)&w};
@@ -15424,9 +17182,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCDEStyle::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -15452,9 +17213,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCDEStyle::eventFilter(QObject*  o, QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -15480,9 +17244,12 @@ if (_wrapper) {
 QPixmap  PythonQtShell_QCDEStyle::generatedIconPixmap(QIcon::Mode  iconMode, const QPixmap&  pixmap, const QStyleOption*  opt) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "generatedIconPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("generatedIconPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("generatedIconPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPixmap" , "QIcon::Mode" , "const QPixmap&" , "const QStyleOption*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QPixmap returnValue;
@@ -15508,9 +17275,12 @@ if (_wrapper) {
 QStyle::SubControl  PythonQtShell_QCDEStyle::hitTestComplexControl(QStyle::ComplexControl  cc, const QStyleOptionComplex*  opt, const QPoint&  pt, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hitTestComplexControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hitTestComplexControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hitTestComplexControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStyle::SubControl" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "const QPoint&" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QStyle::SubControl returnValue;
@@ -15536,9 +17306,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCDEStyle::itemPixmapRect(const QRect&  r, int  flags, const QPixmap&  pixmap) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "itemPixmapRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("itemPixmapRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("itemPixmapRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "const QRect&" , "int" , "const QPixmap&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QRect returnValue;
@@ -15564,9 +17337,12 @@ if (_wrapper) {
 int  PythonQtShell_QCDEStyle::pixelMetric(QStyle::PixelMetric  metric, const QStyleOption*  option, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pixelMetric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pixelMetric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pixelMetric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QStyle::PixelMetric" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -15592,9 +17368,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::polish(QApplication*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QApplication*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15609,9 +17388,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::polish(QPalette&  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPalette&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15626,9 +17408,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::polish(QWidget*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15643,9 +17428,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QCDEStyle::sizeFromContents(QStyle::ContentsType  ct, const QStyleOption*  opt, const QSize&  contentsSize, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sizeFromContents");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sizeFromContents");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sizeFromContents");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize" , "QStyle::ContentsType" , "const QStyleOption*" , "const QSize&" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QSize returnValue;
@@ -15671,9 +17459,12 @@ if (_wrapper) {
 QPalette  PythonQtShell_QCDEStyle::standardPalette() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "standardPalette");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("standardPalette");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("standardPalette");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPalette"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPalette returnValue;
@@ -15699,9 +17490,12 @@ if (_wrapper) {
 QPixmap  PythonQtShell_QCDEStyle::standardPixmap(QStyle::StandardPixmap  standardPixmap, const QStyleOption*  opt, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "standardPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("standardPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("standardPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPixmap" , "QStyle::StandardPixmap" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QPixmap returnValue;
@@ -15727,9 +17521,12 @@ if (_wrapper) {
 int  PythonQtShell_QCDEStyle::styleHint(QStyle::StyleHint  hint, const QStyleOption*  opt, const QWidget*  widget, QStyleHintReturn*  returnData) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "styleHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("styleHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("styleHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QStyle::StyleHint" , "const QStyleOption*" , "const QWidget*" , "QStyleHintReturn*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       int returnValue;
@@ -15755,9 +17552,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCDEStyle::subControlRect(QStyle::ComplexControl  cc, const QStyleOptionComplex*  opt, QStyle::SubControl  sc, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "subControlRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("subControlRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("subControlRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "QStyle::SubControl" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QRect returnValue;
@@ -15783,9 +17583,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCDEStyle::subElementRect(QStyle::SubElement  r, const QStyleOption*  opt, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "subElementRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("subElementRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("subElementRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "QStyle::SubElement" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QRect returnValue;
@@ -15811,9 +17614,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -15828,9 +17634,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::unpolish(QApplication*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unpolish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unpolish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unpolish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QApplication*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15845,9 +17654,12 @@ if (_wrapper) {
 void PythonQtShell_QCDEStyle::unpolish(QWidget*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unpolish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unpolish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unpolish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15888,9 +17700,12 @@ QPalette  PythonQtWrapper_QCDEStyle::standardPalette(QCDEStyle* theWrappedObject
 void PythonQtShell_QCalendarWidget::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15905,9 +17720,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15922,9 +17740,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15939,9 +17760,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15956,9 +17780,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15973,9 +17800,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15990,9 +17820,12 @@ if (_wrapper) {
 int  PythonQtShell_QCalendarWidget::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -16018,9 +17851,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16035,9 +17871,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16052,9 +17891,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16069,9 +17911,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16086,9 +17931,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16103,9 +17951,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCalendarWidget::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -16131,9 +17982,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCalendarWidget::eventFilter(QObject*  watched, QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -16159,9 +18013,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16176,9 +18033,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCalendarWidget::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -16204,9 +18064,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16221,9 +18084,12 @@ if (_wrapper) {
 int  PythonQtShell_QCalendarWidget::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -16249,9 +18115,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16266,9 +18135,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16283,9 +18155,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QCalendarWidget::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -16311,9 +18186,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::keyPressEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -16328,9 +18206,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16345,9 +18226,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -16362,9 +18246,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16379,9 +18266,12 @@ if (_wrapper) {
 int  PythonQtShell_QCalendarWidget::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -16407,9 +18297,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QCalendarWidget::minimumSizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getMinimumSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getMinimumSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getMinimumSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -16435,9 +18328,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16452,9 +18348,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16469,9 +18368,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::mousePressEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -16486,9 +18388,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16503,9 +18408,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16520,9 +18428,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::paintCell(QPainter*  painter, const QRect&  rect, const QDate&  date) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintCell");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintCell");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintCell");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QRect&" , "const QDate&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&painter, (void*)&rect, (void*)&date};
@@ -16537,9 +18448,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QCalendarWidget::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -16565,9 +18479,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16582,9 +18499,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::resizeEvent(QResizeEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -16599,9 +18519,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16616,9 +18539,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QCalendarWidget::sizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -16644,9 +18570,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16661,9 +18590,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -16678,9 +18610,12 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -80,9 +80,12 @@
 void PythonQtShell_QCheckBox::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -97,9 +100,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::changeEvent(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -114,9 +120,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::checkStateSet()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "checkStateSet");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("checkStateSet");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("checkStateSet");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -131,9 +140,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -148,9 +160,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -165,9 +180,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -182,9 +200,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -199,9 +220,12 @@ if (_wrapper) {
 int  PythonQtShell_QCheckBox::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -227,9 +251,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -244,9 +271,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -261,9 +291,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -278,9 +311,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -295,9 +331,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -312,9 +351,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -340,9 +382,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -368,9 +413,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::focusInEvent(QFocusEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -385,9 +433,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -413,9 +464,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::focusOutEvent(QFocusEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -430,9 +484,12 @@ if (_wrapper) {
 int  PythonQtShell_QCheckBox::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -458,9 +515,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -475,9 +535,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::hitButton(const QPoint&  pos) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hitButton");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hitButton");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hitButton");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QPoint&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -503,9 +566,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -520,9 +586,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QCheckBox::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -548,9 +617,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::keyPressEvent(QKeyEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -565,9 +637,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::keyReleaseEvent(QKeyEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -582,9 +657,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -599,9 +677,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -616,9 +697,12 @@ if (_wrapper) {
 int  PythonQtShell_QCheckBox::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -644,9 +728,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QCheckBox::minimumSizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getMinimumSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getMinimumSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getMinimumSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -672,9 +759,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -689,9 +779,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -706,9 +799,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::mousePressEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -723,9 +819,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::mouseReleaseEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -740,9 +839,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -757,9 +859,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::nextCheckState()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "nextCheckState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("nextCheckState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("nextCheckState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -774,9 +879,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QCheckBox::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -802,9 +910,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -819,9 +930,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -836,9 +950,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -853,9 +970,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -870,9 +990,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::timerEvent(QTimerEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -887,9 +1010,12 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -969,9 +1095,12 @@ QSize  PythonQtWrapper_QCheckBox::sizeHint(QCheckBox* theWrappedObject) const
 void PythonQtShell_QCleanlooksStyle::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -986,9 +1115,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1003,9 +1135,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::drawComplexControl(QStyle::ComplexControl  control, const QStyleOptionComplex*  option, QPainter*  painter, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawComplexControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawComplexControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawComplexControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&control, (void*)&option, (void*)&painter, (void*)&widget};
@@ -1020,9 +1155,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::drawControl(QStyle::ControlElement  ce, const QStyleOption*  option, QPainter*  painter, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::ControlElement" , "const QStyleOption*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&ce, (void*)&option, (void*)&painter, (void*)&widget};
@@ -1037,9 +1175,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::drawItemPixmap(QPainter*  painter, const QRect&  rect, int  alignment, const QPixmap&  pixmap) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawItemPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawItemPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawItemPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QRect&" , "int" , "const QPixmap&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&painter, (void*)&rect, (void*)&alignment, (void*)&pixmap};
@@ -1054,9 +1195,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::drawItemText(QPainter*  painter, const QRect&  rect, int  flags, const QPalette&  pal, bool  enabled, const QString&  text, QPalette::ColorRole  textRole) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawItemText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawItemText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawItemText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QRect&" , "int" , "const QPalette&" , "bool" , "const QString&" , "QPalette::ColorRole"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(8, argumentList);
     void* args[8] = {NULL, (void*)&painter, (void*)&rect, (void*)&flags, (void*)&pal, (void*)&enabled, (void*)&text, (void*)&textRole};
@@ -1071,9 +1215,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::drawPrimitive(QStyle::PrimitiveElement  elem, const QStyleOption*  option, QPainter*  painter, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawPrimitive");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawPrimitive");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawPrimitive");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::PrimitiveElement" , "const QStyleOption*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&elem, (void*)&option, (void*)&painter, (void*)&widget};
@@ -1088,9 +1235,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCleanlooksStyle::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1116,9 +1266,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCleanlooksStyle::eventFilter(QObject*  o, QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1144,9 +1297,12 @@ if (_wrapper) {
 QPixmap  PythonQtShell_QCleanlooksStyle::generatedIconPixmap(QIcon::Mode  iconMode, const QPixmap&  pixmap, const QStyleOption*  opt) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "generatedIconPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("generatedIconPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("generatedIconPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPixmap" , "QIcon::Mode" , "const QPixmap&" , "const QStyleOption*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QPixmap returnValue;
@@ -1172,9 +1328,12 @@ if (_wrapper) {
 QStyle::SubControl  PythonQtShell_QCleanlooksStyle::hitTestComplexControl(QStyle::ComplexControl  cc, const QStyleOptionComplex*  opt, const QPoint&  pt, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hitTestComplexControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hitTestComplexControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hitTestComplexControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStyle::SubControl" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "const QPoint&" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QStyle::SubControl returnValue;
@@ -1200,9 +1359,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCleanlooksStyle::itemPixmapRect(const QRect&  r, int  flags, const QPixmap&  pixmap) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "itemPixmapRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("itemPixmapRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("itemPixmapRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "const QRect&" , "int" , "const QPixmap&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QRect returnValue;
@@ -1228,9 +1390,12 @@ if (_wrapper) {
 int  PythonQtShell_QCleanlooksStyle::pixelMetric(QStyle::PixelMetric  metric, const QStyleOption*  option, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pixelMetric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pixelMetric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pixelMetric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QStyle::PixelMetric" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -1256,9 +1421,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::polish(QApplication*  app)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QApplication*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&app};
@@ -1273,9 +1441,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::polish(QPalette&  pal)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPalette&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&pal};
@@ -1290,9 +1461,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::polish(QWidget*  widget)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&widget};
@@ -1307,9 +1481,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QCleanlooksStyle::sizeFromContents(QStyle::ContentsType  type, const QStyleOption*  option, const QSize&  size, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sizeFromContents");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sizeFromContents");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sizeFromContents");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize" , "QStyle::ContentsType" , "const QStyleOption*" , "const QSize&" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QSize returnValue;
@@ -1335,9 +1512,12 @@ if (_wrapper) {
 QPalette  PythonQtShell_QCleanlooksStyle::standardPalette() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "standardPalette");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("standardPalette");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("standardPalette");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPalette"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPalette returnValue;
@@ -1363,9 +1543,12 @@ if (_wrapper) {
 QPixmap  PythonQtShell_QCleanlooksStyle::standardPixmap(QStyle::StandardPixmap  standardPixmap, const QStyleOption*  opt, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "standardPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("standardPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("standardPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPixmap" , "QStyle::StandardPixmap" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QPixmap returnValue;
@@ -1391,9 +1574,12 @@ if (_wrapper) {
 int  PythonQtShell_QCleanlooksStyle::styleHint(QStyle::StyleHint  hint, const QStyleOption*  option, const QWidget*  widget, QStyleHintReturn*  returnData) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "styleHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("styleHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("styleHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QStyle::StyleHint" , "const QStyleOption*" , "const QWidget*" , "QStyleHintReturn*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       int returnValue;
@@ -1419,9 +1605,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCleanlooksStyle::subControlRect(QStyle::ComplexControl  cc, const QStyleOptionComplex*  opt, QStyle::SubControl  sc, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "subControlRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("subControlRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("subControlRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "QStyle::SubControl" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QRect returnValue;
@@ -1447,9 +1636,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCleanlooksStyle::subElementRect(QStyle::SubElement  r, const QStyleOption*  opt, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "subElementRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("subElementRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("subElementRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "QStyle::SubElement" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QRect returnValue;
@@ -1475,9 +1667,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1492,9 +1687,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::unpolish(QApplication*  app)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unpolish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unpolish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unpolish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QApplication*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&app};
@@ -1509,9 +1707,12 @@ if (_wrapper) {
 void PythonQtShell_QCleanlooksStyle::unpolish(QWidget*  widget)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unpolish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unpolish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unpolish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&widget};
@@ -1717,9 +1918,12 @@ return new QCloseEvent(); }
 void PythonQtShell_QColorDialog::accept()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "accept");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("accept");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("accept");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -1734,9 +1938,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1751,9 +1958,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::changeEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -1768,9 +1978,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1785,9 +1998,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1802,9 +2018,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1819,9 +2038,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1836,9 +2058,12 @@ if (_wrapper) {
 int  PythonQtShell_QColorDialog::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -1864,9 +2089,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::done(int  result)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "done");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("done");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("done");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&result};
@@ -1881,9 +2109,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1898,9 +2129,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1915,9 +2149,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1932,9 +2169,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1949,9 +2189,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1966,9 +2209,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColorDialog::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1994,9 +2240,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColorDialog::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2022,9 +2271,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2039,9 +2291,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColorDialog::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2067,9 +2322,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2084,9 +2342,12 @@ if (_wrapper) {
 int  PythonQtShell_QColorDialog::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -2112,9 +2373,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2129,9 +2393,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2146,9 +2413,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QColorDialog::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -2174,9 +2444,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2191,9 +2464,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2208,9 +2484,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2225,9 +2504,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2242,9 +2524,12 @@ if (_wrapper) {
 int  PythonQtShell_QColorDialog::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -2270,9 +2555,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2287,9 +2575,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2304,9 +2595,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2321,9 +2615,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2338,9 +2635,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2355,9 +2655,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QColorDialog::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -2383,9 +2686,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2400,9 +2706,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::reject()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reject");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reject");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reject");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2417,9 +2726,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2434,9 +2746,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2451,9 +2766,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2468,9 +2786,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2485,9 +2806,12 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2607,9 +2931,12 @@ bool  PythonQtWrapper_QColorDialog::testOption(QColorDialog* theWrappedObject, Q
 void PythonQtShell_QColumnView::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2624,9 +2951,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2641,9 +2971,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2658,9 +2991,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::closeEditor(QWidget*  editor, QAbstractItemDelegate::EndEditHint  hint)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEditor");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEditor");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEditor");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*" , "QAbstractItemDelegate::EndEditHint"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&editor, (void*)&hint};
@@ -2675,9 +3011,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2692,9 +3031,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::commitData(QWidget*  editor)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "commitData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("commitData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("commitData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&editor};
@@ -2709,9 +3051,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2726,9 +3071,12 @@ if (_wrapper) {
 QAbstractItemView*  PythonQtShell_QColumnView::createColumn(const QModelIndex&  rootIndex)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "createColumn");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("createColumn");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("createColumn");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAbstractItemView*" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QAbstractItemView* returnValue;
@@ -2754,9 +3102,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::currentChanged(const QModelIndex&  current, const QModelIndex&  previous)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "currentChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("currentChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("currentChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&current, (void*)&previous};
@@ -2771,9 +3122,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2788,9 +3142,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dataChanged(const QModelIndex&  topLeft, const QModelIndex&  bottomRight)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dataChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dataChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dataChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&topLeft, (void*)&bottomRight};
@@ -2805,9 +3162,12 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -2833,9 +3193,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::doItemsLayout()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "doItemsLayout");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("doItemsLayout");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("doItemsLayout");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2850,9 +3213,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dragEnterEvent(QDragEnterEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2867,9 +3233,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dragLeaveEvent(QDragLeaveEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2884,9 +3253,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dragMoveEvent(QDragMoveEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2901,9 +3273,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dropEvent(QDropEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -2918,9 +3293,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::edit(const QModelIndex&  index, QAbstractItemView::EditTrigger  trigger, QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "edit");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("edit");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("edit");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&" , "QAbstractItemView::EditTrigger" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2946,9 +3324,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::editorDestroyed(QObject*  editor)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "editorDestroyed");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("editorDestroyed");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("editorDestroyed");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QObject*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&editor};
@@ -2963,9 +3344,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -2980,9 +3364,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3008,9 +3395,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3036,9 +3426,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::focusInEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3053,9 +3446,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3081,9 +3477,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::focusOutEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3098,9 +3497,12 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -3126,9 +3528,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3143,9 +3548,12 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::horizontalOffset() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "horizontalOffset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("horizontalOffset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("horizontalOffset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -3171,9 +3579,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::horizontalScrollbarAction(int  action)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "horizontalScrollbarAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("horizontalScrollbarAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("horizontalScrollbarAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&action};
@@ -3188,9 +3599,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::horizontalScrollbarValueChanged(int  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "horizontalScrollbarValueChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("horizontalScrollbarValueChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("horizontalScrollbarValueChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&value};
@@ -3205,9 +3619,12 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QColumnView::indexAt(const QPoint&  point) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "indexAt");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("indexAt");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("indexAt");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QModelIndex" , "const QPoint&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QModelIndex returnValue;
@@ -3233,9 +3650,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::inputMethodEvent(QInputMethodEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3250,9 +3670,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QColumnView::inputMethodQuery(Qt::InputMethodQuery  query) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -3278,9 +3701,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::isIndexHidden(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "isIndexHidden");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("isIndexHidden");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("isIndexHidden");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3306,9 +3732,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::keyPressEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3323,9 +3752,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3340,9 +3772,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::keyboardSearch(const QString&  search)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyboardSearch");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyboardSearch");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyboardSearch");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&search};
@@ -3357,9 +3792,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3374,9 +3812,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3391,9 +3832,12 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -3419,9 +3863,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::mouseDoubleClickEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3436,9 +3883,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::mouseMoveEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3453,9 +3903,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::mousePressEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3470,9 +3923,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::mouseReleaseEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3487,9 +3943,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3504,9 +3963,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QColumnView::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -3532,9 +3994,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3549,9 +4014,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3566,9 +4034,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::resizeEvent(QResizeEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3583,9 +4054,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::rowsAboutToBeRemoved(const QModelIndex&  parent, int  start, int  end)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowsAboutToBeRemoved");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowsAboutToBeRemoved");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowsAboutToBeRemoved");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&parent, (void*)&start, (void*)&end};
@@ -3600,9 +4074,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::rowsInserted(const QModelIndex&  parent, int  start, int  end)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "rowsInserted");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("rowsInserted");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("rowsInserted");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&parent, (void*)&start, (void*)&end};
@@ -3617,9 +4094,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::scrollContentsBy(int  dx, int  dy)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "scrollContentsBy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("scrollContentsBy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("scrollContentsBy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&dx, (void*)&dy};
@@ -3634,9 +4114,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::scrollTo(const QModelIndex&  index, QAbstractItemView::ScrollHint  hint)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "scrollTo");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("scrollTo");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("scrollTo");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&" , "QAbstractItemView::ScrollHint"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&index, (void*)&hint};
@@ -3651,9 +4134,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::selectAll()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectAll");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectAll");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectAll");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3668,9 +4154,12 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QColumnView::selectedIndexes() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectedIndexes");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectedIndexes");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectedIndexes");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QList<QModelIndex >"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QList<QModelIndex > returnValue;
@@ -3696,9 +4185,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::selectionChanged(const QItemSelection&  selected, const QItemSelection&  deselected)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectionChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectionChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectionChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QItemSelection&" , "const QItemSelection&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&selected, (void*)&deselected};
@@ -3713,9 +4205,12 @@ if (_wrapper) {
 QItemSelectionModel::SelectionFlags  PythonQtShell_QColumnView::selectionCommand(const QModelIndex&  index, const QEvent*  event) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "selectionCommand");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("selectionCommand");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("selectionCommand");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QItemSelectionModel::SelectionFlags" , "const QModelIndex&" , "const QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QItemSelectionModel::SelectionFlags returnValue;
@@ -3741,9 +4236,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setModel(QAbstractItemModel*  model)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setModel");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setModel");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setModel");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QAbstractItemModel*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&model};
@@ -3758,9 +4256,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setRootIndex(const QModelIndex&  index)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setRootIndex");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setRootIndex");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setRootIndex");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&index};
@@ -3775,9 +4276,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setSelection(const QRect&  rect, QItemSelectionModel::SelectionFlags  command)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setSelection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setSelection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setSelection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QRect&" , "QItemSelectionModel::SelectionFlags"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&rect, (void*)&command};
@@ -3792,9 +4296,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setSelectionModel(QItemSelectionModel*  selectionModel)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setSelectionModel");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setSelectionModel");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setSelectionModel");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QItemSelectionModel*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&selectionModel};
@@ -3809,9 +4316,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3826,9 +4336,12 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::sizeHintForColumn(int  column) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sizeHintForColumn");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sizeHintForColumn");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sizeHintForColumn");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -3854,9 +4367,12 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::sizeHintForRow(int  row) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sizeHintForRow");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sizeHintForRow");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sizeHintForRow");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -3882,9 +4398,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::startDrag(Qt::DropActions  supportedActions)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDrag");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDrag");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDrag");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "Qt::DropActions"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&supportedActions};
@@ -3899,9 +4418,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -3916,9 +4438,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -3933,9 +4458,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::updateEditorData()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateEditorData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateEditorData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateEditorData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3950,9 +4478,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::updateEditorGeometries()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateEditorGeometries");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateEditorGeometries");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateEditorGeometries");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3967,9 +4498,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::updateGeometries()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "updateGeometries");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("updateGeometries");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("updateGeometries");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -3984,9 +4518,12 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::verticalOffset() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "verticalOffset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("verticalOffset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("verticalOffset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -4012,9 +4549,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::verticalScrollbarAction(int  action)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "verticalScrollbarAction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("verticalScrollbarAction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("verticalScrollbarAction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&action};
@@ -4029,9 +4569,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::verticalScrollbarValueChanged(int  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "verticalScrollbarValueChanged");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("verticalScrollbarValueChanged");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("verticalScrollbarValueChanged");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&value};
@@ -4046,9 +4589,12 @@ if (_wrapper) {
 QStyleOptionViewItem  PythonQtShell_QColumnView::viewOptions() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "viewOptions");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("viewOptions");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("viewOptions");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStyleOptionViewItem"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QStyleOptionViewItem returnValue;
@@ -4074,9 +4620,12 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::viewportEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "viewportEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("viewportEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("viewportEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4102,9 +4651,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QColumnView::visualRect(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "visualRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("visualRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("visualRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRect returnValue;
@@ -4130,9 +4682,12 @@ if (_wrapper) {
 QRegion  PythonQtShell_QColumnView::visualRegionForSelection(const QItemSelection&  selection) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "visualRegionForSelection");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("visualRegionForSelection");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("visualRegionForSelection");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRegion" , "const QItemSelection&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QRegion returnValue;
@@ -4158,9 +4713,12 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4301,9 +4859,12 @@ QRegion  PythonQtWrapper_QColumnView::visualRegionForSelection(QColumnView* theW
 void PythonQtShell_QComboBox::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4318,9 +4879,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::changeEvent(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4335,9 +4899,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4352,9 +4919,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4369,9 +4939,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::contextMenuEvent(QContextMenuEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4386,9 +4959,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4403,9 +4979,12 @@ if (_wrapper) {
 int  PythonQtShell_QComboBox::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -4431,9 +5010,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4448,9 +5030,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4465,9 +5050,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4482,9 +5070,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4499,9 +5090,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4516,9 +5110,12 @@ if (_wrapper) {
 bool  PythonQtShell_QComboBox::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4544,9 +5141,12 @@ if (_wrapper) {
 bool  PythonQtShell_QComboBox::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -4572,9 +5172,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::focusInEvent(QFocusEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4589,9 +5192,12 @@ if (_wrapper) {
 bool  PythonQtShell_QComboBox::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4617,9 +5223,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::focusOutEvent(QFocusEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4634,9 +5243,12 @@ if (_wrapper) {
 int  PythonQtShell_QComboBox::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -4662,9 +5274,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::hideEvent(QHideEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4679,9 +5294,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::hidePopup()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hidePopup");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hidePopup");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hidePopup");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -4696,9 +5314,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4713,9 +5334,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QComboBox::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -4741,9 +5365,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::keyPressEvent(QKeyEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4758,9 +5385,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::keyReleaseEvent(QKeyEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4775,9 +5405,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -4792,9 +5425,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4809,9 +5445,12 @@ if (_wrapper) {
 int  PythonQtShell_QComboBox::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -4837,9 +5476,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4854,9 +5496,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4871,9 +5516,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::mousePressEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4888,9 +5536,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::mouseReleaseEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4905,9 +5556,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -4922,9 +5576,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QComboBox::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -4950,9 +5607,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::paintEvent(QPaintEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4967,9 +5627,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::resizeEvent(QResizeEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -4984,9 +5647,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::showEvent(QShowEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -5001,9 +5667,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::showPopup()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showPopup");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showPopup");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showPopup");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -5018,9 +5687,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5035,9 +5707,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5052,9 +5727,12 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::wheelEvent(QWheelEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -5440,9 +6118,12 @@ void PythonQtWrapper_QComboBox::wheelEvent(QComboBox* theWrappedObject, QWheelEv
 void PythonQtShell_QCommandLinkButton::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5457,9 +6138,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::changeEvent(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -5474,9 +6158,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::checkStateSet()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "checkStateSet");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("checkStateSet");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("checkStateSet");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -5491,9 +6178,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5508,9 +6198,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5525,9 +6218,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5542,9 +6238,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5559,9 +6258,12 @@ if (_wrapper) {
 int  PythonQtShell_QCommandLinkButton::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -5587,9 +6289,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5604,9 +6309,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5621,9 +6329,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5638,9 +6349,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5655,9 +6369,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5672,9 +6389,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5700,9 +6420,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -5728,9 +6451,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5745,9 +6471,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5773,9 +6502,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5790,9 +6522,12 @@ if (_wrapper) {
 int  PythonQtShell_QCommandLinkButton::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -5818,9 +6553,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5835,9 +6573,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::hitButton(const QPoint&  pos) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hitButton");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hitButton");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hitButton");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QPoint&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -5863,9 +6604,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5880,9 +6624,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QCommandLinkButton::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -5908,9 +6655,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5925,9 +6675,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::keyReleaseEvent(QKeyEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -5942,9 +6695,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -5959,9 +6715,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -5976,9 +6735,12 @@ if (_wrapper) {
 int  PythonQtShell_QCommandLinkButton::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -6004,9 +6766,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6021,9 +6786,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::mouseMoveEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -6038,9 +6806,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::mousePressEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -6055,9 +6826,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::mouseReleaseEvent(QMouseEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -6072,9 +6846,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6089,9 +6866,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::nextCheckState()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "nextCheckState");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("nextCheckState");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("nextCheckState");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -6106,9 +6886,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QCommandLinkButton::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -6134,9 +6917,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6151,9 +6937,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6168,9 +6957,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6185,9 +6977,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6202,9 +6997,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::timerEvent(QTimerEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -6219,9 +7017,12 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6275,9 +7076,12 @@ void PythonQtWrapper_QCommandLinkButton::setDescription(QCommandLinkButton* theW
 void PythonQtShell_QCommonStyle::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6292,9 +7096,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6309,9 +7116,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawComplexControl(QStyle::ComplexControl  cc, const QStyleOptionComplex*  opt, QPainter*  p, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawComplexControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawComplexControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawComplexControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&cc, (void*)&opt, (void*)&p, (void*)&w};
@@ -6326,9 +7136,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawControl(QStyle::ControlElement  element, const QStyleOption*  opt, QPainter*  p, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::ControlElement" , "const QStyleOption*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&element, (void*)&opt, (void*)&p, (void*)&w};
@@ -6343,9 +7156,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawItemPixmap(QPainter*  painter, const QRect&  rect, int  alignment, const QPixmap&  pixmap) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawItemPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawItemPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawItemPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QRect&" , "int" , "const QPixmap&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&painter, (void*)&rect, (void*)&alignment, (void*)&pixmap};
@@ -6360,9 +7176,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawItemText(QPainter*  painter, const QRect&  rect, int  flags, const QPalette&  pal, bool  enabled, const QString&  text, QPalette::ColorRole  textRole) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawItemText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawItemText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawItemText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPainter*" , "const QRect&" , "int" , "const QPalette&" , "bool" , "const QString&" , "QPalette::ColorRole"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(8, argumentList);
     void* args[8] = {NULL, (void*)&painter, (void*)&rect, (void*)&flags, (void*)&pal, (void*)&enabled, (void*)&text, (void*)&textRole};
@@ -6377,9 +7196,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawPrimitive(QStyle::PrimitiveElement  pe, const QStyleOption*  opt, QPainter*  p, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "drawPrimitive");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("drawPrimitive");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("drawPrimitive");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QStyle::PrimitiveElement" , "const QStyleOption*" , "QPainter*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
     void* args[5] = {NULL, (void*)&pe, (void*)&opt, (void*)&p, (void*)&w};
@@ -6394,9 +7216,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCommonStyle::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6422,9 +7247,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCommonStyle::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -6450,9 +7278,12 @@ if (_wrapper) {
 QPixmap  PythonQtShell_QCommonStyle::generatedIconPixmap(QIcon::Mode  iconMode, const QPixmap&  pixmap, const QStyleOption*  opt) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "generatedIconPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("generatedIconPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("generatedIconPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPixmap" , "QIcon::Mode" , "const QPixmap&" , "const QStyleOption*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QPixmap returnValue;
@@ -6478,9 +7309,12 @@ if (_wrapper) {
 QStyle::SubControl  PythonQtShell_QCommonStyle::hitTestComplexControl(QStyle::ComplexControl  cc, const QStyleOptionComplex*  opt, const QPoint&  pt, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hitTestComplexControl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hitTestComplexControl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hitTestComplexControl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStyle::SubControl" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "const QPoint&" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QStyle::SubControl returnValue;
@@ -6506,9 +7340,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCommonStyle::itemPixmapRect(const QRect&  r, int  flags, const QPixmap&  pixmap) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "itemPixmapRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("itemPixmapRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("itemPixmapRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "const QRect&" , "int" , "const QPixmap&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QRect returnValue;
@@ -6534,9 +7371,12 @@ if (_wrapper) {
 int  PythonQtShell_QCommonStyle::pixelMetric(QStyle::PixelMetric  m, const QStyleOption*  opt, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pixelMetric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pixelMetric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pixelMetric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QStyle::PixelMetric" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       int returnValue;
@@ -6562,9 +7402,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::polish(QApplication*  app)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QApplication*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&app};
@@ -6579,9 +7422,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::polish(QPalette&  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPalette&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6596,9 +7442,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::polish(QWidget*  widget)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "polish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("polish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("polish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&widget};
@@ -6613,9 +7462,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QCommonStyle::sizeFromContents(QStyle::ContentsType  ct, const QStyleOption*  opt, const QSize&  contentsSize, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "sizeFromContents");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("sizeFromContents");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("sizeFromContents");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize" , "QStyle::ContentsType" , "const QStyleOption*" , "const QSize&" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QSize returnValue;
@@ -6641,9 +7493,12 @@ if (_wrapper) {
 QPalette  PythonQtShell_QCommonStyle::standardPalette() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "standardPalette");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("standardPalette");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("standardPalette");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPalette"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPalette returnValue;
@@ -6669,9 +7524,12 @@ if (_wrapper) {
 QPixmap  PythonQtShell_QCommonStyle::standardPixmap(QStyle::StandardPixmap  standardPixmap, const QStyleOption*  opt, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "standardPixmap");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("standardPixmap");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("standardPixmap");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPixmap" , "QStyle::StandardPixmap" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QPixmap returnValue;
@@ -6697,9 +7555,12 @@ if (_wrapper) {
 int  PythonQtShell_QCommonStyle::styleHint(QStyle::StyleHint  sh, const QStyleOption*  opt, const QWidget*  w, QStyleHintReturn*  shret) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "styleHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("styleHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("styleHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QStyle::StyleHint" , "const QStyleOption*" , "const QWidget*" , "QStyleHintReturn*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       int returnValue;
@@ -6725,9 +7586,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCommonStyle::subControlRect(QStyle::ComplexControl  cc, const QStyleOptionComplex*  opt, QStyle::SubControl  sc, const QWidget*  w) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "subControlRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("subControlRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("subControlRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "QStyle::ComplexControl" , "const QStyleOptionComplex*" , "QStyle::SubControl" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       QRect returnValue;
@@ -6753,9 +7617,12 @@ if (_wrapper) {
 QRect  PythonQtShell_QCommonStyle::subElementRect(QStyle::SubElement  r, const QStyleOption*  opt, const QWidget*  widget) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "subElementRect");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("subElementRect");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("subElementRect");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QRect" , "QStyle::SubElement" , "const QStyleOption*" , "const QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       QRect returnValue;
@@ -6781,9 +7648,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6798,9 +7668,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::unpolish(QApplication*  application)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unpolish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unpolish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unpolish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QApplication*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&application};
@@ -6815,9 +7688,12 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::unpolish(QWidget*  widget)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unpolish");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unpolish");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unpolish");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWidget*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&widget};
@@ -6913,9 +7789,12 @@ void PythonQtWrapper_QCommonStyle::unpolish(QCommonStyle* theWrappedObject, QWid
 void PythonQtShell_QCompleter::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6930,9 +7809,12 @@ if (_wrapper) {
 void PythonQtShell_QCompleter::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -6947,9 +7829,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCompleter::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -6975,9 +7860,12 @@ if (_wrapper) {
 bool  PythonQtShell_QCompleter::eventFilter(QObject*  o, QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -7003,9 +7891,12 @@ if (_wrapper) {
 QString  PythonQtShell_QCompleter::pathFromIndex(const QModelIndex&  index) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "pathFromIndex");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("pathFromIndex");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("pathFromIndex");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const QModelIndex&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QString returnValue;
@@ -7031,9 +7922,12 @@ if (_wrapper) {
 QStringList  PythonQtShell_QCompleter::splitPath(const QString&  path) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "splitPath");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("splitPath");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("splitPath");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QStringList" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QStringList returnValue;
@@ -7059,9 +7953,12 @@ if (_wrapper) {
 void PythonQtShell_QCompleter::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7328,9 +8225,12 @@ int  PythonQtWrapper_QContextMenuEvent::y(QContextMenuEvent* theWrappedObject) c
 void PythonQtShell_QDataWidgetMapper::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7345,9 +8245,12 @@ if (_wrapper) {
 void PythonQtShell_QDataWidgetMapper::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7362,9 +8265,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDataWidgetMapper::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -7390,9 +8296,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDataWidgetMapper::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -7418,9 +8327,12 @@ if (_wrapper) {
 void PythonQtShell_QDataWidgetMapper::setCurrentIndex(int  index)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setCurrentIndex");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setCurrentIndex");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setCurrentIndex");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&index};
@@ -7435,9 +8347,12 @@ if (_wrapper) {
 void PythonQtShell_QDataWidgetMapper::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7548,9 +8463,12 @@ QDataWidgetMapper::SubmitPolicy  PythonQtWrapper_QDataWidgetMapper::submitPolicy
 void PythonQtShell_QDateEdit::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7565,9 +8483,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::changeEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7582,9 +8503,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7599,9 +8523,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::clear()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "clear");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("clear");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("clear");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -7616,9 +8543,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::closeEvent(QCloseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7633,9 +8563,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::contextMenuEvent(QContextMenuEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7650,9 +8583,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7667,9 +8603,12 @@ if (_wrapper) {
 QDateTime  PythonQtShell_QDateEdit::dateTimeFromText(const QString&  text) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dateTimeFromText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dateTimeFromText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dateTimeFromText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QDateTime" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QDateTime returnValue;
@@ -7695,9 +8634,12 @@ if (_wrapper) {
 int  PythonQtShell_QDateEdit::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -7723,9 +8665,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7740,9 +8685,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7757,9 +8705,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7774,9 +8725,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7791,9 +8745,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -7808,9 +8765,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDateEdit::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -7836,9 +8796,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDateEdit::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -7864,9 +8827,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::fixup(QString&  input) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fixup");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fixup");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fixup");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&input};
@@ -7881,9 +8847,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::focusInEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7898,9 +8867,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDateEdit::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -7926,9 +8898,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::focusOutEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7943,9 +8918,12 @@ if (_wrapper) {
 int  PythonQtShell_QDateEdit::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -7971,9 +8949,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::hideEvent(QHideEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -7988,9 +8969,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8005,9 +8989,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QDateEdit::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -8033,9 +9020,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::keyPressEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8050,9 +9040,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::keyReleaseEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8067,9 +9060,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -8084,9 +9080,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8101,9 +9100,12 @@ if (_wrapper) {
 int  PythonQtShell_QDateEdit::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -8129,9 +9131,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8146,9 +9151,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::mouseMoveEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8163,9 +9171,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::mousePressEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8180,9 +9191,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::mouseReleaseEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8197,9 +9211,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8214,9 +9231,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QDateEdit::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -8242,9 +9262,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::paintEvent(QPaintEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8259,9 +9282,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::resizeEvent(QResizeEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8276,9 +9302,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::showEvent(QShowEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8293,9 +9322,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::stepBy(int  steps)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "stepBy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("stepBy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("stepBy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&steps};
@@ -8310,9 +9342,12 @@ if (_wrapper) {
 QAbstractSpinBox::StepEnabled  PythonQtShell_QDateEdit::stepEnabled() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "stepEnabled");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("stepEnabled");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("stepEnabled");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAbstractSpinBox::StepEnabled"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAbstractSpinBox::StepEnabled returnValue;
@@ -8338,9 +9373,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8355,9 +9393,12 @@ if (_wrapper) {
 QString  PythonQtShell_QDateEdit::textFromDateTime(const QDateTime&  dt) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "textFromDateTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("textFromDateTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("textFromDateTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const QDateTime&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QString returnValue;
@@ -8383,9 +9424,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8400,9 +9444,12 @@ if (_wrapper) {
 QValidator::State  PythonQtShell_QDateEdit::validate(QString&  input, int&  pos) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "validate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("validate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("validate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QValidator::State" , "QString&" , "int&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QValidator::State returnValue;
@@ -8428,9 +9475,12 @@ if (_wrapper) {
 void PythonQtShell_QDateEdit::wheelEvent(QWheelEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8455,9 +9505,12 @@ return new PythonQtShell_QDateEdit(date, parent); }
 void PythonQtShell_QDateTimeEdit::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8472,9 +9525,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::changeEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8489,9 +9545,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8506,9 +9565,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::clear()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "clear");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("clear");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("clear");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -8523,9 +9585,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::closeEvent(QCloseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8540,9 +9605,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::contextMenuEvent(QContextMenuEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8557,9 +9625,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8574,9 +9645,12 @@ if (_wrapper) {
 QDateTime  PythonQtShell_QDateTimeEdit::dateTimeFromText(const QString&  text) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dateTimeFromText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dateTimeFromText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dateTimeFromText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QDateTime" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QDateTime returnValue;
@@ -8602,9 +9676,12 @@ if (_wrapper) {
 int  PythonQtShell_QDateTimeEdit::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -8630,9 +9707,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8647,9 +9727,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8664,9 +9747,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8681,9 +9767,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8698,9 +9787,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8715,9 +9807,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDateTimeEdit::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -8743,9 +9838,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDateTimeEdit::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -8771,9 +9869,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::fixup(QString&  input) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fixup");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fixup");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fixup");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&input};
@@ -8788,9 +9889,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::focusInEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8805,9 +9909,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDateTimeEdit::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -8833,9 +9940,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::focusOutEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8850,9 +9960,12 @@ if (_wrapper) {
 int  PythonQtShell_QDateTimeEdit::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -8878,9 +9991,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::hideEvent(QHideEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8895,9 +10011,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -8912,9 +10031,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QDateTimeEdit::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -8940,9 +10062,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::keyPressEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8957,9 +10082,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::keyReleaseEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -8974,9 +10102,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -8991,9 +10122,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9008,9 +10142,12 @@ if (_wrapper) {
 int  PythonQtShell_QDateTimeEdit::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -9036,9 +10173,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9053,9 +10193,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::mouseMoveEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -9070,9 +10213,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::mousePressEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -9087,9 +10233,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::mouseReleaseEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -9104,9 +10253,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9121,9 +10273,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QDateTimeEdit::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -9149,9 +10304,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::paintEvent(QPaintEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -9166,9 +10324,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::resizeEvent(QResizeEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -9183,9 +10344,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::showEvent(QShowEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -9200,9 +10364,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::stepBy(int  steps)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "stepBy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("stepBy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("stepBy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&steps};
@@ -9217,9 +10384,12 @@ if (_wrapper) {
 QAbstractSpinBox::StepEnabled  PythonQtShell_QDateTimeEdit::stepEnabled() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "stepEnabled");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("stepEnabled");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("stepEnabled");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAbstractSpinBox::StepEnabled"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAbstractSpinBox::StepEnabled returnValue;
@@ -9245,9 +10415,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9262,9 +10435,12 @@ if (_wrapper) {
 QString  PythonQtShell_QDateTimeEdit::textFromDateTime(const QDateTime&  dt) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "textFromDateTime");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("textFromDateTime");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("textFromDateTime");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const QDateTime&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QString returnValue;
@@ -9290,9 +10466,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -9307,9 +10486,12 @@ if (_wrapper) {
 QValidator::State  PythonQtShell_QDateTimeEdit::validate(QString&  input, int&  pos) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "validate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("validate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("validate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QValidator::State" , "QString&" , "int&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QValidator::State returnValue;
@@ -9335,9 +10517,12 @@ if (_wrapper) {
 void PythonQtShell_QDateTimeEdit::wheelEvent(QWheelEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -9681,9 +10866,12 @@ void PythonQtWrapper_QDesktopServices::static_QDesktopServices_unsetUrlHandler(c
 void PythonQtShell_QDesktopWidget::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9698,9 +10886,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9715,9 +10906,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9732,9 +10926,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9749,9 +10946,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9766,9 +10966,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9783,9 +10986,12 @@ if (_wrapper) {
 int  PythonQtShell_QDesktopWidget::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -9811,9 +11017,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9828,9 +11037,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9845,9 +11057,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9862,9 +11077,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9879,9 +11097,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9896,9 +11117,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDesktopWidget::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -9924,9 +11148,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDesktopWidget::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -9952,9 +11179,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -9969,9 +11199,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDesktopWidget::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -9997,9 +11230,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10014,9 +11250,12 @@ if (_wrapper) {
 int  PythonQtShell_QDesktopWidget::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -10042,9 +11281,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10059,9 +11301,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10076,9 +11321,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QDesktopWidget::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -10104,9 +11352,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10121,9 +11372,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10138,9 +11392,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -10155,9 +11412,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10172,9 +11432,12 @@ if (_wrapper) {
 int  PythonQtShell_QDesktopWidget::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -10200,9 +11463,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QDesktopWidget::minimumSizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getMinimumSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getMinimumSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getMinimumSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -10228,9 +11494,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10245,9 +11514,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10262,9 +11534,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10279,9 +11554,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10296,9 +11574,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10313,9 +11594,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QDesktopWidget::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -10341,9 +11625,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10358,9 +11645,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::resizeEvent(QResizeEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -10375,9 +11665,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10392,9 +11685,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QDesktopWidget::sizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -10420,9 +11716,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10437,9 +11736,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10454,9 +11756,12 @@ if (_wrapper) {
 void PythonQtShell_QDesktopWidget::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10547,9 +11852,12 @@ int  PythonQtWrapper_QDesktopWidget::screenNumber(QDesktopWidget* theWrappedObje
 void PythonQtShell_QDial::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10564,9 +11872,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::changeEvent(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -10581,9 +11892,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10598,9 +11912,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10615,9 +11932,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10632,9 +11952,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10649,9 +11972,12 @@ if (_wrapper) {
 int  PythonQtShell_QDial::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -10677,9 +12003,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10694,9 +12023,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10711,9 +12043,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10728,9 +12063,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10745,9 +12083,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10762,9 +12103,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDial::event(QEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -10790,9 +12134,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDial::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -10818,9 +12165,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10835,9 +12185,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDial::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -10863,9 +12216,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10880,9 +12236,12 @@ if (_wrapper) {
 int  PythonQtShell_QDial::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -10908,9 +12267,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10925,9 +12287,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -10942,9 +12307,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QDial::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -10970,9 +12338,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::keyPressEvent(QKeyEvent*  ev)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&ev};
@@ -10987,9 +12358,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11004,9 +12378,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -11021,9 +12398,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11038,9 +12418,12 @@ if (_wrapper) {
 int  PythonQtShell_QDial::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -11066,9 +12449,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11083,9 +12469,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::mouseMoveEvent(QMouseEvent*  me)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&me};
@@ -11100,9 +12489,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::mousePressEvent(QMouseEvent*  me)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&me};
@@ -11117,9 +12509,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::mouseReleaseEvent(QMouseEvent*  me)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&me};
@@ -11134,9 +12529,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11151,9 +12549,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QDial::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -11179,9 +12580,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::paintEvent(QPaintEvent*  pe)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&pe};
@@ -11196,9 +12600,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::resizeEvent(QResizeEvent*  re)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&re};
@@ -11213,9 +12620,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11230,9 +12640,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11247,9 +12660,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11264,9 +12680,12 @@ if (_wrapper) {
 void PythonQtShell_QDial::wheelEvent(QWheelEvent*  e)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&e};
@@ -11352,9 +12771,12 @@ bool  PythonQtWrapper_QDial::wrapping(QDial* theWrappedObject) const
 void PythonQtShell_QDialog::accept()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "accept");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("accept");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("accept");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -11369,9 +12791,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11386,9 +12811,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11403,9 +12831,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11420,9 +12851,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11437,9 +12871,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11454,9 +12891,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11471,9 +12911,12 @@ if (_wrapper) {
 int  PythonQtShell_QDialog::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -11499,9 +12942,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::done(int  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "done");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("done");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("done");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11516,9 +12962,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11533,9 +12982,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11550,9 +13002,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11567,9 +13022,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11584,9 +13042,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11601,9 +13062,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDialog::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -11629,9 +13093,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDialog::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -11657,9 +13124,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11674,9 +13144,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDialog::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -11702,9 +13175,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11719,9 +13195,12 @@ if (_wrapper) {
 int  PythonQtShell_QDialog::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -11747,9 +13226,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11764,9 +13246,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11781,9 +13266,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QDialog::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -11809,9 +13297,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11826,9 +13317,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11843,9 +13337,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -11860,9 +13357,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11877,9 +13377,12 @@ if (_wrapper) {
 int  PythonQtShell_QDialog::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -11905,9 +13408,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11922,9 +13428,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11939,9 +13448,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11956,9 +13468,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11973,9 +13488,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -11990,9 +13508,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QDialog::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -12018,9 +13539,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12035,9 +13559,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::reject()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reject");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reject");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reject");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -12052,9 +13579,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12069,9 +13599,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12086,9 +13619,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12103,9 +13639,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12120,9 +13659,12 @@ if (_wrapper) {
 void PythonQtShell_QDialog::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12213,9 +13755,12 @@ QSize  PythonQtWrapper_QDialog::sizeHint(QDialog* theWrappedObject) const
 void PythonQtShell_QDialogButtonBox::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12230,9 +13775,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::changeEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -12247,9 +13795,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12264,9 +13815,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12281,9 +13835,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12298,9 +13855,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12315,9 +13875,12 @@ if (_wrapper) {
 int  PythonQtShell_QDialogButtonBox::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -12343,9 +13906,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12360,9 +13926,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12377,9 +13946,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12394,9 +13966,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12411,9 +13986,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12428,9 +14006,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDialogButtonBox::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -12456,9 +14037,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDialogButtonBox::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -12484,9 +14068,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12501,9 +14088,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDialogButtonBox::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -12529,9 +14119,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12546,9 +14139,12 @@ if (_wrapper) {
 int  PythonQtShell_QDialogButtonBox::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -12574,9 +14170,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12591,9 +14190,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12608,9 +14210,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QDialogButtonBox::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -12636,9 +14241,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12653,9 +14261,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12670,9 +14281,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -12687,9 +14301,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12704,9 +14321,12 @@ if (_wrapper) {
 int  PythonQtShell_QDialogButtonBox::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -12732,9 +14352,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QDialogButtonBox::minimumSizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getMinimumSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getMinimumSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getMinimumSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -12760,9 +14383,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12777,9 +14403,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12794,9 +14423,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12811,9 +14443,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12828,9 +14463,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12845,9 +14483,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QDialogButtonBox::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -12873,9 +14514,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12890,9 +14534,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12907,9 +14554,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12924,9 +14574,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QDialogButtonBox::sizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -12952,9 +14605,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12969,9 +14625,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -12986,9 +14645,12 @@ if (_wrapper) {
 void PythonQtShell_QDialogButtonBox::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13102,9 +14764,12 @@ QDialogButtonBox::StandardButtons  PythonQtWrapper_QDialogButtonBox::standardBut
 void PythonQtShell_QDockWidget::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13119,9 +14784,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::changeEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -13136,9 +14804,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13153,9 +14824,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::closeEvent(QCloseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -13170,9 +14844,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13187,9 +14864,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13204,9 +14884,12 @@ if (_wrapper) {
 int  PythonQtShell_QDockWidget::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -13232,9 +14915,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13249,9 +14935,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13266,9 +14955,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13283,9 +14975,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13300,9 +14995,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13317,9 +15015,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDockWidget::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -13345,9 +15046,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDockWidget::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -13373,9 +15077,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13390,9 +15097,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDockWidget::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -13418,9 +15128,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13435,9 +15148,12 @@ if (_wrapper) {
 int  PythonQtShell_QDockWidget::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -13463,9 +15179,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::hideEvent(QHideEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13480,9 +15199,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13497,9 +15219,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QDockWidget::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -13525,9 +15250,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13542,9 +15270,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::keyReleaseEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13559,9 +15290,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -13576,9 +15310,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13593,9 +15330,12 @@ if (_wrapper) {
 int  PythonQtShell_QDockWidget::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -13621,9 +15361,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QDockWidget::minimumSizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getMinimumSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getMinimumSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getMinimumSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -13649,9 +15392,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13666,9 +15412,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13683,9 +15432,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13700,9 +15452,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13717,9 +15472,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13734,9 +15492,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QDockWidget::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -13762,9 +15523,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::paintEvent(QPaintEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -13779,9 +15543,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13796,9 +15563,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13813,9 +15583,12 @@ if (_wrapper) {
 QSize  PythonQtShell_QDockWidget::sizeHint() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "getSizeHint");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("getSizeHint");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("getSizeHint");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QSize"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QSize returnValue;
@@ -13841,9 +15614,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13858,9 +15634,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13875,9 +15654,12 @@ if (_wrapper) {
 void PythonQtShell_QDockWidget::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13982,9 +15764,12 @@ QWidget*  PythonQtWrapper_QDockWidget::widget(QDockWidget* theWrappedObject) con
 void PythonQtShell_QDoubleSpinBox::actionEvent(QActionEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "actionEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("actionEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("actionEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QActionEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -13999,9 +15784,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::changeEvent(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "changeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("changeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("changeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14016,9 +15804,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14033,9 +15824,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::clear()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "clear");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("clear");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("clear");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -14050,9 +15844,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::closeEvent(QCloseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "closeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("closeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("closeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QCloseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14067,9 +15864,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::contextMenuEvent(QContextMenuEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contextMenuEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contextMenuEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contextMenuEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QContextMenuEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14084,9 +15884,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14101,9 +15904,12 @@ if (_wrapper) {
 int  PythonQtShell_QDoubleSpinBox::devType() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "devType");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("devType");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("devType");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -14129,9 +15935,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragEnterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragEnterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragEnterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragEnterEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14146,9 +15955,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragLeaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragLeaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragLeaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragLeaveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14163,9 +15975,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dragMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dragMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dragMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDragMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14180,9 +15995,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "dropEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("dropEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("dropEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QDropEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14197,9 +16015,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::enterEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "enterEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("enterEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("enterEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14214,9 +16035,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDoubleSpinBox::event(QEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -14242,9 +16066,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDoubleSpinBox::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -14270,9 +16097,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::fixup(QString&  str) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fixup");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fixup");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fixup");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&str};
@@ -14287,9 +16117,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::focusInEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusInEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusInEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusInEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14304,9 +16137,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDoubleSpinBox::focusNextPrevChild(bool  next)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusNextPrevChild");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusNextPrevChild");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusNextPrevChild");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -14332,9 +16168,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::focusOutEvent(QFocusEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "focusOutEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("focusOutEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("focusOutEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QFocusEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14349,9 +16188,12 @@ if (_wrapper) {
 int  PythonQtShell_QDoubleSpinBox::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "heightForWidth");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("heightForWidth");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("heightForWidth");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -14377,9 +16219,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::hideEvent(QHideEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hideEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hideEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hideEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QHideEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14394,9 +16239,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QInputMethodEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14411,9 +16259,12 @@ if (_wrapper) {
 QVariant  PythonQtShell_QDoubleSpinBox::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "inputMethodQuery");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("inputMethodQuery");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("inputMethodQuery");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QVariant" , "Qt::InputMethodQuery"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QVariant returnValue;
@@ -14439,9 +16290,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::keyPressEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyPressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyPressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyPressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14456,9 +16310,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::keyReleaseEvent(QKeyEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "keyReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("keyReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("keyReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QKeyEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14473,9 +16330,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::languageChange()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "languageChange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("languageChange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("languageChange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -14490,9 +16350,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::leaveEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "leaveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("leaveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("leaveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14507,9 +16370,12 @@ if (_wrapper) {
 int  PythonQtShell_QDoubleSpinBox::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "metric");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("metric");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("metric");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int" , "QPaintDevice::PaintDeviceMetric"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       int returnValue;
@@ -14535,9 +16401,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseDoubleClickEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseDoubleClickEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14552,9 +16421,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::mouseMoveEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseMoveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseMoveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseMoveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14569,9 +16441,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::mousePressEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mousePressEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mousePressEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mousePressEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14586,9 +16461,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::mouseReleaseEvent(QMouseEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "mouseReleaseEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("mouseReleaseEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("mouseReleaseEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMouseEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14603,9 +16481,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::moveEvent(QMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "moveEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("moveEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("moveEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QMoveEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14620,9 +16501,12 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QDoubleSpinBox::paintEngine() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEngine");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEngine");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEngine");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QPaintEngine*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QPaintEngine* returnValue;
@@ -14648,9 +16532,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::paintEvent(QPaintEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "paintEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("paintEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("paintEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QPaintEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14665,9 +16552,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::resizeEvent(QResizeEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resizeEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resizeEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resizeEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QResizeEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14682,9 +16572,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::showEvent(QShowEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "showEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("showEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("showEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QShowEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14699,9 +16592,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::stepBy(int  steps)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "stepBy");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("stepBy");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("stepBy");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&steps};
@@ -14716,9 +16612,12 @@ if (_wrapper) {
 QAbstractSpinBox::StepEnabled  PythonQtShell_QDoubleSpinBox::stepEnabled() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "stepEnabled");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("stepEnabled");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("stepEnabled");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QAbstractSpinBox::StepEnabled"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QAbstractSpinBox::StepEnabled returnValue;
@@ -14744,9 +16643,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::tabletEvent(QTabletEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "tabletEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("tabletEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("tabletEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTabletEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14761,9 +16663,12 @@ if (_wrapper) {
 QString  PythonQtShell_QDoubleSpinBox::textFromValue(double  val) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "textFromValue");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("textFromValue");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("textFromValue");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "double"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       QString returnValue;
@@ -14789,9 +16694,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::timerEvent(QTimerEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14806,9 +16714,12 @@ if (_wrapper) {
 QValidator::State  PythonQtShell_QDoubleSpinBox::validate(QString&  input, int&  pos) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "validate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("validate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("validate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QValidator::State" , "QString&" , "int&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QValidator::State returnValue;
@@ -14834,9 +16745,12 @@ if (_wrapper) {
 double  PythonQtShell_QDoubleSpinBox::valueFromText(const QString&  text) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "valueFromText");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("valueFromText");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("valueFromText");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"double" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       double returnValue;
@@ -14862,9 +16776,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleSpinBox::wheelEvent(QWheelEvent*  event)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "wheelEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("wheelEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("wheelEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QWheelEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&event};
@@ -14980,9 +16897,12 @@ double  PythonQtWrapper_QDoubleSpinBox::valueFromText(QDoubleSpinBox* theWrapped
 void PythonQtShell_QDoubleValidator::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -14997,9 +16917,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleValidator::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15014,9 +16937,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDoubleValidator::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -15042,9 +16968,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDoubleValidator::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -15070,9 +16999,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleValidator::fixup(QString&  arg__1) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fixup");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fixup");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fixup");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15087,9 +17019,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleValidator::setRange(double  bottom, double  top, int  decimals)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setRange");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setRange");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setRange");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "double" , "double" , "int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
     void* args[4] = {NULL, (void*)&bottom, (void*)&top, (void*)&decimals};
@@ -15104,9 +17039,12 @@ if (_wrapper) {
 void PythonQtShell_QDoubleValidator::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15121,9 +17059,12 @@ if (_wrapper) {
 QValidator::State  PythonQtShell_QDoubleValidator::validate(QString&  arg__1, int&  arg__2) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "validate");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("validate");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("validate");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QValidator::State" , "QString&" , "int&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QValidator::State returnValue;
@@ -15209,9 +17150,12 @@ QValidator::State  PythonQtWrapper_QDoubleValidator::validate(QDoubleValidator*
 void PythonQtShell_QDrag::childEvent(QChildEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "childEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("childEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("childEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QChildEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15226,9 +17170,12 @@ if (_wrapper) {
 void PythonQtShell_QDrag::customEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "customEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("customEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("customEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -15243,9 +17190,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDrag::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "event");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("event");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("event");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -15271,9 +17221,12 @@ if (_wrapper) {
 bool  PythonQtShell_QDrag::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "eventFilter");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("eventFilter");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("eventFilter");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "QObject*" , "QEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -15299,9 +17252,12 @@ if (_wrapper) {
 void PythonQtShell_QDrag::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "timerEvent");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("timerEvent");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("timerEvent");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QTimerEvent*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&arg__1};
@@ -1162,9 +1162,12 @@ QString  PythonQtWrapper_QXmlAttributes::value(QXmlAttributes* theWrappedObject,
 bool  PythonQtShell_QXmlContentHandler::characters(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "characters");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("characters");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("characters");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1190,9 +1193,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::endDocument()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endDocument");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endDocument");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endDocument");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1218,9 +1224,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::endElement(const QString&  namespaceURI, const QString&  localName, const QString&  qName)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endElement");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endElement");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endElement");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1246,9 +1255,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::endPrefixMapping(const QString&  prefix)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endPrefixMapping");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endPrefixMapping");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endPrefixMapping");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1274,9 +1286,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlContentHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -1302,9 +1317,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::ignorableWhitespace(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "ignorableWhitespace");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("ignorableWhitespace");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("ignorableWhitespace");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1330,9 +1348,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::processingInstruction(const QString&  target, const QString&  data)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "processingInstruction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("processingInstruction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("processingInstruction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1358,9 +1379,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlContentHandler::setDocumentLocator(QXmlLocator*  locator)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDocumentLocator");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDocumentLocator");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDocumentLocator");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlLocator*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&locator};
@@ -1375,9 +1399,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::skippedEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "skippedEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("skippedEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("skippedEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1403,9 +1430,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::startDocument()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDocument");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDocument");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDocument");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1431,9 +1461,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::startElement(const QString&  namespaceURI, const QString&  localName, const QString&  qName, const QXmlAttributes&  atts)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startElement");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startElement");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startElement");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QXmlAttributes&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -1459,9 +1492,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::startPrefixMapping(const QString&  prefix, const QString&  uri)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startPrefixMapping");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startPrefixMapping");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startPrefixMapping");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1493,9 +1529,12 @@ return new PythonQtShell_QXmlContentHandler(); }
 QString  PythonQtShell_QXmlDTDHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -1521,9 +1560,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDTDHandler::notationDecl(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "notationDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("notationDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("notationDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1549,9 +1591,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDTDHandler::unparsedEntityDecl(const QString&  name, const QString&  publicId, const QString&  systemId, const QString&  notationName)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unparsedEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unparsedEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unparsedEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -1583,9 +1628,12 @@ return new PythonQtShell_QXmlDTDHandler(); }
 bool  PythonQtShell_QXmlDeclHandler::attributeDecl(const QString&  eName, const QString&  aName, const QString&  type, const QString&  valueDefault, const QString&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "attributeDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("attributeDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("attributeDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       bool returnValue;
@@ -1611,9 +1659,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlDeclHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -1639,9 +1690,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDeclHandler::externalEntityDecl(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "externalEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("externalEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("externalEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1667,9 +1721,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDeclHandler::internalEntityDecl(const QString&  name, const QString&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "internalEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("internalEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("internalEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1701,9 +1758,12 @@ return new PythonQtShell_QXmlDeclHandler(); }
 bool  PythonQtShell_QXmlDefaultHandler::attributeDecl(const QString&  eName, const QString&  aName, const QString&  type, const QString&  valueDefault, const QString&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "attributeDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("attributeDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("attributeDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       bool returnValue;
@@ -1729,9 +1789,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::characters(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "characters");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("characters");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("characters");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1757,9 +1820,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::comment(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "comment");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("comment");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("comment");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1785,9 +1851,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endCDATA()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endCDATA");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endCDATA");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endCDATA");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1813,9 +1882,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endDTD()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endDTD");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endDTD");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endDTD");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1841,9 +1913,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endDocument()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endDocument");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endDocument");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endDocument");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1869,9 +1944,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endElement(const QString&  namespaceURI, const QString&  localName, const QString&  qName)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endElement");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endElement");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endElement");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1897,9 +1975,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1925,9 +2006,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endPrefixMapping(const QString&  prefix)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endPrefixMapping");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endPrefixMapping");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endPrefixMapping");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1953,9 +2037,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::error(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "error");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("error");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("error");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1981,9 +2068,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlDefaultHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -2009,9 +2099,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::externalEntityDecl(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "externalEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("externalEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("externalEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2037,9 +2130,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::fatalError(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fatalError");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fatalError");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fatalError");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2065,9 +2161,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::ignorableWhitespace(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "ignorableWhitespace");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("ignorableWhitespace");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("ignorableWhitespace");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2093,9 +2192,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::internalEntityDecl(const QString&  name, const QString&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "internalEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("internalEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("internalEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2121,9 +2223,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::notationDecl(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "notationDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("notationDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("notationDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2149,9 +2254,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::processingInstruction(const QString&  target, const QString&  data)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "processingInstruction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("processingInstruction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("processingInstruction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2177,9 +2285,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::resolveEntity(const QString&  publicId, const QString&  systemId, QXmlInputSource*&  ret)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resolveEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resolveEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resolveEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "QXmlInputSource*&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2205,9 +2316,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlDefaultHandler::setDocumentLocator(QXmlLocator*  locator)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDocumentLocator");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDocumentLocator");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDocumentLocator");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlLocator*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&locator};
@@ -2222,9 +2336,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::skippedEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "skippedEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("skippedEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("skippedEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2250,9 +2367,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startCDATA()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startCDATA");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startCDATA");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startCDATA");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -2278,9 +2398,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startDTD(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDTD");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDTD");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDTD");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2306,9 +2429,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startDocument()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDocument");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDocument");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDocument");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -2334,9 +2460,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startElement(const QString&  namespaceURI, const QString&  localName, const QString&  qName, const QXmlAttributes&  atts)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startElement");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startElement");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startElement");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QXmlAttributes&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -2362,9 +2491,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2390,9 +2522,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startPrefixMapping(const QString&  prefix, const QString&  uri)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startPrefixMapping");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startPrefixMapping");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startPrefixMapping");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2418,9 +2553,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::unparsedEntityDecl(const QString&  name, const QString&  publicId, const QString&  systemId, const QString&  notationName)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unparsedEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unparsedEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unparsedEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -2446,9 +2584,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::warning(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "warning");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("warning");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("warning");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2620,9 +2761,12 @@ bool  PythonQtWrapper_QXmlDefaultHandler::warning(QXmlDefaultHandler* theWrapped
 QString  PythonQtShell_QXmlEntityResolver::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -2648,9 +2792,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlEntityResolver::resolveEntity(const QString&  publicId, const QString&  systemId, QXmlInputSource*&  ret)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resolveEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resolveEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resolveEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "QXmlInputSource*&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2682,9 +2829,12 @@ return new PythonQtShell_QXmlEntityResolver(); }
 bool  PythonQtShell_QXmlErrorHandler::error(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "error");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("error");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("error");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2710,9 +2860,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlErrorHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -2738,9 +2891,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlErrorHandler::fatalError(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fatalError");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fatalError");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fatalError");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2766,9 +2922,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlErrorHandler::warning(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "warning");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("warning");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("warning");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2800,9 +2959,12 @@ return new PythonQtShell_QXmlErrorHandler(); }
 QString  PythonQtShell_QXmlInputSource::data() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "data");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("data");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("data");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -2828,9 +2990,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlInputSource::fetchData()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fetchData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fetchData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fetchData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2845,9 +3010,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlInputSource::fromRawData(const QByteArray&  data, bool  beginning)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fromRawData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fromRawData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fromRawData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const QByteArray&" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -2873,9 +3041,12 @@ if (_wrapper) {
 QChar  PythonQtShell_QXmlInputSource::next()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "next");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("next");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("next");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QChar"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QChar returnValue;
@@ -2901,9 +3072,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlInputSource::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2918,9 +3092,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlInputSource::setData(const QByteArray&  dat)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QByteArray&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&dat};
@@ -2935,9 +3112,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlInputSource::setData(const QString&  dat)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&dat};
@@ -2997,9 +3177,12 @@ void PythonQtWrapper_QXmlInputSource::setData(QXmlInputSource* theWrappedObject,
 bool  PythonQtShell_QXmlLexicalHandler::comment(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "comment");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("comment");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("comment");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3025,9 +3208,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::endCDATA()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endCDATA");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endCDATA");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endCDATA");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3053,9 +3239,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::endDTD()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endDTD");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endDTD");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endDTD");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3081,9 +3270,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::endEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3109,9 +3301,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlLexicalHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -3137,9 +3332,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::startCDATA()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startCDATA");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startCDATA");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startCDATA");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3165,9 +3363,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::startDTD(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDTD");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDTD");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDTD");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -3193,9 +3394,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::startEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3227,9 +3431,12 @@ return new PythonQtShell_QXmlLexicalHandler(); }
 int  PythonQtShell_QXmlLocator::columnNumber() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnNumber");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnNumber");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnNumber");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -3255,9 +3462,12 @@ if (_wrapper) {
 int  PythonQtShell_QXmlLocator::lineNumber() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "lineNumber");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("lineNumber");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("lineNumber");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -3324,9 +3534,12 @@ QString  PythonQtWrapper_QXmlParseException::systemId(QXmlParseException* theWra
 QXmlDTDHandler*  PythonQtShell_QXmlReader::DTDHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "DTDHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("DTDHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("DTDHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlDTDHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlDTDHandler* returnValue;
@@ -3352,9 +3565,12 @@ if (_wrapper) {
 QXmlContentHandler*  PythonQtShell_QXmlReader::contentHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contentHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contentHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contentHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlContentHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlContentHandler* returnValue;
@@ -3380,9 +3596,12 @@ if (_wrapper) {
 QXmlDeclHandler*  PythonQtShell_QXmlReader::declHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "declHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("declHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("declHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlDeclHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlDeclHandler* returnValue;
@@ -3408,9 +3627,12 @@ if (_wrapper) {
 QXmlEntityResolver*  PythonQtShell_QXmlReader::entityResolver() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "entityResolver");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("entityResolver");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("entityResolver");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlEntityResolver*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlEntityResolver* returnValue;
@@ -3436,9 +3658,12 @@ if (_wrapper) {
 QXmlErrorHandler*  PythonQtShell_QXmlReader::errorHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlErrorHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlErrorHandler* returnValue;
@@ -3464,9 +3689,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::feature(const QString&  name, bool*  ok) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "feature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("feature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("feature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3492,9 +3720,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::hasFeature(const QString&  name) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasFeature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasFeature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasFeature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3520,9 +3751,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::hasProperty(const QString&  name) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasProperty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasProperty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasProperty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3548,9 +3782,12 @@ if (_wrapper) {
 QXmlLexicalHandler*  PythonQtShell_QXmlReader::lexicalHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "lexicalHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("lexicalHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("lexicalHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlLexicalHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlLexicalHandler* returnValue;
@@ -3576,9 +3813,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::parse(const QXmlInputSource&  input)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3604,9 +3844,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::parse(const QXmlInputSource*  input)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3632,9 +3875,12 @@ if (_wrapper) {
 void*  PythonQtShell_QXmlReader::property(const QString&  name, bool*  ok) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "property");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("property");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("property");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"void*" , "const QString&" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       void* returnValue;
@@ -3660,9 +3906,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setContentHandler(QXmlContentHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setContentHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setContentHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setContentHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlContentHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3677,9 +3926,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setDTDHandler(QXmlDTDHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDTDHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDTDHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDTDHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlDTDHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3694,9 +3946,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setDeclHandler(QXmlDeclHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDeclHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDeclHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDeclHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlDeclHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3711,9 +3966,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setEntityResolver(QXmlEntityResolver*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setEntityResolver");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setEntityResolver");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setEntityResolver");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlEntityResolver*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3728,9 +3986,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setErrorHandler(QXmlErrorHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setErrorHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setErrorHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setErrorHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlErrorHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3745,9 +4006,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setFeature(const QString&  name, bool  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setFeature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setFeature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setFeature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&name, (void*)&value};
@@ -3762,9 +4026,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setLexicalHandler(QXmlLexicalHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setLexicalHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setLexicalHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setLexicalHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlLexicalHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3779,9 +4046,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setProperty(const QString&  name, void*  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setProperty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setProperty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setProperty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&" , "void*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&name, (void*)&value};
@@ -3802,9 +4072,12 @@ return new PythonQtShell_QXmlReader(); }
 QXmlDTDHandler*  PythonQtShell_QXmlSimpleReader::DTDHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "DTDHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("DTDHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("DTDHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlDTDHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlDTDHandler* returnValue;
@@ -3830,9 +4103,12 @@ if (_wrapper) {
 QXmlContentHandler*  PythonQtShell_QXmlSimpleReader::contentHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contentHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contentHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contentHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlContentHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlContentHandler* returnValue;
@@ -3858,9 +4134,12 @@ if (_wrapper) {
 QXmlDeclHandler*  PythonQtShell_QXmlSimpleReader::declHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "declHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("declHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("declHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlDeclHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlDeclHandler* returnValue;
@@ -3886,9 +4165,12 @@ if (_wrapper) {
 QXmlEntityResolver*  PythonQtShell_QXmlSimpleReader::entityResolver() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "entityResolver");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("entityResolver");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("entityResolver");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlEntityResolver*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlEntityResolver* returnValue;
@@ -3914,9 +4196,12 @@ if (_wrapper) {
 QXmlErrorHandler*  PythonQtShell_QXmlSimpleReader::errorHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlErrorHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlErrorHandler* returnValue;
@@ -3942,9 +4227,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::feature(const QString&  name, bool*  ok) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "feature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("feature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("feature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3970,9 +4258,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::hasFeature(const QString&  name) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasFeature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasFeature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasFeature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3998,9 +4289,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::hasProperty(const QString&  name) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasProperty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasProperty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasProperty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4026,9 +4320,12 @@ if (_wrapper) {
 QXmlLexicalHandler*  PythonQtShell_QXmlSimpleReader::lexicalHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "lexicalHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("lexicalHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("lexicalHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlLexicalHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlLexicalHandler* returnValue;
@@ -4054,9 +4351,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::parse(const QXmlInputSource&  input)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4082,9 +4382,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::parse(const QXmlInputSource*  input)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4110,9 +4413,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::parse(const QXmlInputSource*  input, bool  incremental)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource*" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -4138,9 +4444,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::parseContinue()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parseContinue");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parseContinue");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parseContinue");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -4166,9 +4475,12 @@ if (_wrapper) {
 void*  PythonQtShell_QXmlSimpleReader::property(const QString&  name, bool*  ok) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "property");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("property");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("property");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"void*" , "const QString&" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       void* returnValue;
@@ -4194,9 +4506,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setContentHandler(QXmlContentHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setContentHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setContentHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setContentHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlContentHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4211,9 +4526,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setDTDHandler(QXmlDTDHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDTDHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDTDHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDTDHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlDTDHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4228,9 +4546,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setDeclHandler(QXmlDeclHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDeclHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDeclHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDeclHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlDeclHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4245,9 +4566,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setEntityResolver(QXmlEntityResolver*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setEntityResolver");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setEntityResolver");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setEntityResolver");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlEntityResolver*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4262,9 +4586,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setErrorHandler(QXmlErrorHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setErrorHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setErrorHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setErrorHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlErrorHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4279,9 +4606,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setFeature(const QString&  name, bool  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setFeature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setFeature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setFeature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&name, (void*)&value};
@@ -4296,9 +4626,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setLexicalHandler(QXmlLexicalHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setLexicalHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setLexicalHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setLexicalHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlLexicalHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4313,9 +4646,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setProperty(const QString&  name, void*  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setProperty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setProperty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setProperty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&" , "void*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&name, (void*)&value};
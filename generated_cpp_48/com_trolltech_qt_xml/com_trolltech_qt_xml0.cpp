@@ -1170,9 +1170,12 @@ PythonQtShell_QXmlContentHandler::~PythonQtShell_QXmlContentHandler() {
 bool  PythonQtShell_QXmlContentHandler::characters(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "characters");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("characters");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("characters");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1198,9 +1201,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::endDocument()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endDocument");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endDocument");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endDocument");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1226,9 +1232,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::endElement(const QString&  namespaceURI, const QString&  localName, const QString&  qName)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endElement");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endElement");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endElement");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1254,9 +1263,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::endPrefixMapping(const QString&  prefix)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endPrefixMapping");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endPrefixMapping");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endPrefixMapping");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1282,9 +1294,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlContentHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -1310,9 +1325,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::ignorableWhitespace(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "ignorableWhitespace");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("ignorableWhitespace");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("ignorableWhitespace");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1338,9 +1356,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::processingInstruction(const QString&  target, const QString&  data)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "processingInstruction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("processingInstruction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("processingInstruction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1366,9 +1387,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlContentHandler::setDocumentLocator(QXmlLocator*  locator)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDocumentLocator");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDocumentLocator");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDocumentLocator");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlLocator*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&locator};
@@ -1383,9 +1407,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::skippedEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "skippedEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("skippedEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("skippedEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1411,9 +1438,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::startDocument()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDocument");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDocument");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDocument");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1439,9 +1469,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::startElement(const QString&  namespaceURI, const QString&  localName, const QString&  qName, const QXmlAttributes&  atts)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startElement");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startElement");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startElement");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QXmlAttributes&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -1467,9 +1500,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlContentHandler::startPrefixMapping(const QString&  prefix, const QString&  uri)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startPrefixMapping");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startPrefixMapping");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startPrefixMapping");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1505,9 +1541,12 @@ PythonQtShell_QXmlDTDHandler::~PythonQtShell_QXmlDTDHandler() {
 QString  PythonQtShell_QXmlDTDHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -1533,9 +1572,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDTDHandler::notationDecl(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "notationDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("notationDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("notationDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1561,9 +1603,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDTDHandler::unparsedEntityDecl(const QString&  name, const QString&  publicId, const QString&  systemId, const QString&  notationName)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unparsedEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unparsedEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unparsedEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -1599,9 +1644,12 @@ PythonQtShell_QXmlDeclHandler::~PythonQtShell_QXmlDeclHandler() {
 bool  PythonQtShell_QXmlDeclHandler::attributeDecl(const QString&  eName, const QString&  aName, const QString&  type, const QString&  valueDefault, const QString&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "attributeDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("attributeDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("attributeDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       bool returnValue;
@@ -1627,9 +1675,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlDeclHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -1655,9 +1706,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDeclHandler::externalEntityDecl(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "externalEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("externalEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("externalEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1683,9 +1737,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDeclHandler::internalEntityDecl(const QString&  name, const QString&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "internalEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("internalEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("internalEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -1721,9 +1778,12 @@ PythonQtShell_QXmlDefaultHandler::~PythonQtShell_QXmlDefaultHandler() {
 bool  PythonQtShell_QXmlDefaultHandler::attributeDecl(const QString&  eName, const QString&  aName, const QString&  type, const QString&  valueDefault, const QString&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "attributeDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("attributeDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("attributeDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(6, argumentList);
       bool returnValue;
@@ -1749,9 +1809,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::characters(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "characters");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("characters");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("characters");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1777,9 +1840,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::comment(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "comment");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("comment");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("comment");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1805,9 +1871,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endCDATA()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endCDATA");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endCDATA");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endCDATA");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1833,9 +1902,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endDTD()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endDTD");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endDTD");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endDTD");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1861,9 +1933,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endDocument()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endDocument");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endDocument");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endDocument");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -1889,9 +1964,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endElement(const QString&  namespaceURI, const QString&  localName, const QString&  qName)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endElement");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endElement");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endElement");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -1917,9 +1995,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1945,9 +2026,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::endPrefixMapping(const QString&  prefix)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endPrefixMapping");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endPrefixMapping");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endPrefixMapping");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -1973,9 +2057,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::error(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "error");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("error");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("error");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2001,9 +2088,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlDefaultHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -2029,9 +2119,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::externalEntityDecl(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "externalEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("externalEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("externalEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2057,9 +2150,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::fatalError(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fatalError");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fatalError");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fatalError");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2085,9 +2181,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::ignorableWhitespace(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "ignorableWhitespace");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("ignorableWhitespace");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("ignorableWhitespace");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2113,9 +2212,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::internalEntityDecl(const QString&  name, const QString&  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "internalEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("internalEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("internalEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2141,9 +2243,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::notationDecl(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "notationDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("notationDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("notationDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2169,9 +2274,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::processingInstruction(const QString&  target, const QString&  data)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "processingInstruction");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("processingInstruction");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("processingInstruction");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2197,9 +2305,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::resolveEntity(const QString&  publicId, const QString&  systemId, QXmlInputSource*&  ret)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resolveEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resolveEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resolveEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "QXmlInputSource*&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2225,9 +2336,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlDefaultHandler::setDocumentLocator(QXmlLocator*  locator)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDocumentLocator");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDocumentLocator");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDocumentLocator");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlLocator*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&locator};
@@ -2242,9 +2356,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::skippedEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "skippedEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("skippedEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("skippedEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2270,9 +2387,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startCDATA()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startCDATA");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startCDATA");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startCDATA");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -2298,9 +2418,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startDTD(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDTD");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDTD");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDTD");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2326,9 +2449,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startDocument()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDocument");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDocument");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDocument");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -2354,9 +2480,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startElement(const QString&  namespaceURI, const QString&  localName, const QString&  qName, const QXmlAttributes&  atts)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startElement");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startElement");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startElement");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QXmlAttributes&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -2382,9 +2511,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2410,9 +2542,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::startPrefixMapping(const QString&  prefix, const QString&  uri)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startPrefixMapping");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startPrefixMapping");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startPrefixMapping");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -2438,9 +2573,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::unparsedEntityDecl(const QString&  name, const QString&  publicId, const QString&  systemId, const QString&  notationName)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "unparsedEntityDecl");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("unparsedEntityDecl");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("unparsedEntityDecl");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(5, argumentList);
       bool returnValue;
@@ -2466,9 +2604,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlDefaultHandler::warning(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "warning");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("warning");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("warning");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2644,9 +2785,12 @@ PythonQtShell_QXmlEntityResolver::~PythonQtShell_QXmlEntityResolver() {
 QString  PythonQtShell_QXmlEntityResolver::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -2672,9 +2816,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlEntityResolver::resolveEntity(const QString&  publicId, const QString&  systemId, QXmlInputSource*&  ret)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "resolveEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("resolveEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("resolveEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "QXmlInputSource*&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -2710,9 +2857,12 @@ PythonQtShell_QXmlErrorHandler::~PythonQtShell_QXmlErrorHandler() {
 bool  PythonQtShell_QXmlErrorHandler::error(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "error");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("error");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("error");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2738,9 +2888,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlErrorHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -2766,9 +2919,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlErrorHandler::fatalError(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fatalError");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fatalError");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fatalError");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2794,9 +2950,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlErrorHandler::warning(const QXmlParseException&  exception)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "warning");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("warning");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("warning");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlParseException&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -2832,9 +2991,12 @@ PythonQtShell_QXmlInputSource::~PythonQtShell_QXmlInputSource() {
 QString  PythonQtShell_QXmlInputSource::data() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "data");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("data");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("data");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -2860,9 +3022,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlInputSource::fetchData()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fetchData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fetchData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fetchData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2877,9 +3042,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlInputSource::fromRawData(const QByteArray&  data, bool  beginning)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "fromRawData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("fromRawData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("fromRawData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString" , "const QByteArray&" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       QString returnValue;
@@ -2905,9 +3073,12 @@ if (_wrapper) {
 QChar  PythonQtShell_QXmlInputSource::next()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "next");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("next");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("next");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QChar"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QChar returnValue;
@@ -2933,9 +3104,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlInputSource::reset()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "reset");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("reset");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("reset");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={""};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
     void* args[1] = {NULL};
@@ -2950,9 +3124,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlInputSource::setData(const QByteArray&  dat)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QByteArray&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&dat};
@@ -2967,9 +3144,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlInputSource::setData(const QString&  dat)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setData");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setData");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setData");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&dat};
@@ -3033,9 +3213,12 @@ PythonQtShell_QXmlLexicalHandler::~PythonQtShell_QXmlLexicalHandler() {
 bool  PythonQtShell_QXmlLexicalHandler::comment(const QString&  ch)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "comment");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("comment");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("comment");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3061,9 +3244,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::endCDATA()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endCDATA");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endCDATA");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endCDATA");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3089,9 +3275,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::endDTD()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endDTD");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endDTD");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endDTD");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3117,9 +3306,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::endEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "endEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("endEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("endEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3145,9 +3337,12 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlLexicalHandler::errorString() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorString");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorString");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorString");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QString"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QString returnValue;
@@ -3173,9 +3368,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::startCDATA()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startCDATA");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startCDATA");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startCDATA");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -3201,9 +3399,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::startDTD(const QString&  name, const QString&  publicId, const QString&  systemId)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startDTD");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startDTD");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startDTD");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "const QString&" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, argumentList);
       bool returnValue;
@@ -3229,9 +3430,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlLexicalHandler::startEntity(const QString&  name)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "startEntity");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("startEntity");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("startEntity");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3267,9 +3471,12 @@ PythonQtShell_QXmlLocator::~PythonQtShell_QXmlLocator() {
 int  PythonQtShell_QXmlLocator::columnNumber() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "columnNumber");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("columnNumber");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("columnNumber");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -3295,9 +3502,12 @@ if (_wrapper) {
 int  PythonQtShell_QXmlLocator::lineNumber() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "lineNumber");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("lineNumber");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("lineNumber");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"int"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       int returnValue;
@@ -3368,9 +3578,12 @@ PythonQtShell_QXmlReader::~PythonQtShell_QXmlReader() {
 QXmlDTDHandler*  PythonQtShell_QXmlReader::DTDHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "DTDHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("DTDHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("DTDHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlDTDHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlDTDHandler* returnValue;
@@ -3396,9 +3609,12 @@ if (_wrapper) {
 QXmlContentHandler*  PythonQtShell_QXmlReader::contentHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contentHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contentHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contentHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlContentHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlContentHandler* returnValue;
@@ -3424,9 +3640,12 @@ if (_wrapper) {
 QXmlDeclHandler*  PythonQtShell_QXmlReader::declHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "declHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("declHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("declHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlDeclHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlDeclHandler* returnValue;
@@ -3452,9 +3671,12 @@ if (_wrapper) {
 QXmlEntityResolver*  PythonQtShell_QXmlReader::entityResolver() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "entityResolver");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("entityResolver");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("entityResolver");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlEntityResolver*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlEntityResolver* returnValue;
@@ -3480,9 +3702,12 @@ if (_wrapper) {
 QXmlErrorHandler*  PythonQtShell_QXmlReader::errorHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlErrorHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlErrorHandler* returnValue;
@@ -3508,9 +3733,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::feature(const QString&  name, bool*  ok) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "feature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("feature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("feature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -3536,9 +3764,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::hasFeature(const QString&  name) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasFeature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasFeature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasFeature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3564,9 +3795,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::hasProperty(const QString&  name) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasProperty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasProperty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasProperty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3592,9 +3826,12 @@ if (_wrapper) {
 QXmlLexicalHandler*  PythonQtShell_QXmlReader::lexicalHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "lexicalHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("lexicalHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("lexicalHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlLexicalHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlLexicalHandler* returnValue;
@@ -3620,9 +3857,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::parse(const QXmlInputSource&  input)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3648,9 +3888,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlReader::parse(const QXmlInputSource*  input)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -3676,9 +3919,12 @@ if (_wrapper) {
 void*  PythonQtShell_QXmlReader::property(const QString&  name, bool*  ok) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "property");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("property");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("property");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"void*" , "const QString&" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       void* returnValue;
@@ -3704,9 +3950,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setContentHandler(QXmlContentHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setContentHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setContentHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setContentHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlContentHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3721,9 +3970,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setDTDHandler(QXmlDTDHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDTDHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDTDHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDTDHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlDTDHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3738,9 +3990,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setDeclHandler(QXmlDeclHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDeclHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDeclHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDeclHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlDeclHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3755,9 +4010,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setEntityResolver(QXmlEntityResolver*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setEntityResolver");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setEntityResolver");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setEntityResolver");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlEntityResolver*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3772,9 +4030,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setErrorHandler(QXmlErrorHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setErrorHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setErrorHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setErrorHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlErrorHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3789,9 +4050,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setFeature(const QString&  name, bool  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setFeature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setFeature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setFeature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&name, (void*)&value};
@@ -3806,9 +4070,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setLexicalHandler(QXmlLexicalHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setLexicalHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setLexicalHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setLexicalHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlLexicalHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -3823,9 +4090,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlReader::setProperty(const QString&  name, void*  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setProperty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setProperty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setProperty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&" , "void*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&name, (void*)&value};
@@ -3850,9 +4120,12 @@ PythonQtShell_QXmlSimpleReader::~PythonQtShell_QXmlSimpleReader() {
 QXmlDTDHandler*  PythonQtShell_QXmlSimpleReader::DTDHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "DTDHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("DTDHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("DTDHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlDTDHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlDTDHandler* returnValue;
@@ -3878,9 +4151,12 @@ if (_wrapper) {
 QXmlContentHandler*  PythonQtShell_QXmlSimpleReader::contentHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "contentHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("contentHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("contentHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlContentHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlContentHandler* returnValue;
@@ -3906,9 +4182,12 @@ if (_wrapper) {
 QXmlDeclHandler*  PythonQtShell_QXmlSimpleReader::declHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "declHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("declHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("declHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlDeclHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlDeclHandler* returnValue;
@@ -3934,9 +4213,12 @@ if (_wrapper) {
 QXmlEntityResolver*  PythonQtShell_QXmlSimpleReader::entityResolver() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "entityResolver");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("entityResolver");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("entityResolver");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlEntityResolver*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlEntityResolver* returnValue;
@@ -3962,9 +4244,12 @@ if (_wrapper) {
 QXmlErrorHandler*  PythonQtShell_QXmlSimpleReader::errorHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "errorHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("errorHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("errorHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlErrorHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlErrorHandler* returnValue;
@@ -3990,9 +4275,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::feature(const QString&  name, bool*  ok) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "feature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("feature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("feature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -4018,9 +4306,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::hasFeature(const QString&  name) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasFeature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasFeature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasFeature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4046,9 +4337,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::hasProperty(const QString&  name) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "hasProperty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("hasProperty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("hasProperty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QString&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4074,9 +4368,12 @@ if (_wrapper) {
 QXmlLexicalHandler*  PythonQtShell_QXmlSimpleReader::lexicalHandler() const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "lexicalHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("lexicalHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("lexicalHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"QXmlLexicalHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       QXmlLexicalHandler* returnValue;
@@ -4102,9 +4399,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::parse(const QXmlInputSource&  input)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource&"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4130,9 +4430,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::parse(const QXmlInputSource*  input)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
       bool returnValue;
@@ -4158,9 +4461,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::parse(const QXmlInputSource*  input, bool  incremental)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parse");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parse");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parse");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool" , "const QXmlInputSource*" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       bool returnValue;
@@ -4186,9 +4492,12 @@ if (_wrapper) {
 bool  PythonQtShell_QXmlSimpleReader::parseContinue()
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "parseContinue");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("parseContinue");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("parseContinue");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(1, argumentList);
       bool returnValue;
@@ -4214,9 +4523,12 @@ if (_wrapper) {
 void*  PythonQtShell_QXmlSimpleReader::property(const QString&  name, bool*  ok) const
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "property");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("property");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("property");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"void*" , "const QString&" , "bool*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
       void* returnValue;
@@ -4242,9 +4554,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setContentHandler(QXmlContentHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setContentHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setContentHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setContentHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlContentHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4259,9 +4574,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setDTDHandler(QXmlDTDHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDTDHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDTDHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDTDHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlDTDHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4276,9 +4594,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setDeclHandler(QXmlDeclHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setDeclHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setDeclHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setDeclHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlDeclHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4293,9 +4614,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setEntityResolver(QXmlEntityResolver*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setEntityResolver");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setEntityResolver");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setEntityResolver");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlEntityResolver*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4310,9 +4634,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setErrorHandler(QXmlErrorHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setErrorHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setErrorHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setErrorHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlErrorHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4327,9 +4654,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setFeature(const QString&  name, bool  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setFeature");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setFeature");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setFeature");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&" , "bool"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&name, (void*)&value};
@@ -4344,9 +4674,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setLexicalHandler(QXmlLexicalHandler*  handler)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setLexicalHandler");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setLexicalHandler");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setLexicalHandler");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "QXmlLexicalHandler*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(2, argumentList);
     void* args[2] = {NULL, (void*)&handler};
@@ -4361,9 +4694,12 @@ if (_wrapper) {
 void PythonQtShell_QXmlSimpleReader::setProperty(const QString&  name, void*  value)
 {
 if (_wrapper) {
-  PyObject* obj = PyObject_GetAttrString((PyObject*)_wrapper, "setProperty");
+  PYTHONQT_GIL_SCOPE
+  static PyObject* name = PyString_FromString("setProperty");
+  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex("setProperty");
+  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;
   PyErr_Clear();
-  if (obj && !PythonQtSlotFunction_Check(obj)) {
+  if (obj) {
     static const char* argumentList[] ={"" , "const QString&" , "void*"};
     static const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, argumentList);
     void* args[3] = {NULL, (void*)&name, (void*)&value};
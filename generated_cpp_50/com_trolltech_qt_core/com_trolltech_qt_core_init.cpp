@@ -9,32 +9,37 @@ static void* polymorphichandler_QEvent(const void *ptr, const char **class_name)
 {
     Q_ASSERT(ptr != 0);
     QEvent *object = (QEvent *)ptr;
-    if (object->type() == QEvent::ChildAdded || object->type() == QEvent::ChildPolished || object->type() == QEvent::ChildRemoved) {
+    switch (object->type()) {
+    case QEvent::ChildAdded:
+    case QEvent::ChildPolished:
+    case QEvent::ChildRemoved:
         *class_name = "QChildEvent";
         return (QChildEvent*)object;
-    }
-    if (object->type() == QEvent::DynamicPropertyChange) {
+    case QEvent::DynamicPropertyChange:
         *class_name = "QDynamicPropertyChangeEvent";
         return (QDynamicPropertyChangeEvent*)object;
-    }
-    if (object->type() == QEvent::None) {
+    case QEvent::None:
         *class_name = "QEvent";
         return (QEvent*)object;
-    }
-    if (object->type() == QEvent::StateMachineSignal) {
+    case QEvent::StateMachineSignal:
         *class_name = "QStateMachine__SignalEvent";
         return (QStateMachine::SignalEvent*)object;
-    }
-    if (object->type() == QEvent::StateMachineWrapped) {
+    case QEvent::StateMachineWrapped:
         *class_name = "QStateMachine__WrappedEvent";
         return (QStateMachine::WrappedEvent*)object;
-    }
-    if (object->type() == QEvent::Timer) {
+    case QEvent::Timer:
         *class_name = "QTimerEvent";
         return (QTimerEvent*)object;
+    default:
+        break;
     }
     return NULL;
 }
+static int polymorphicdiscriminator_QEvent(const void *ptr)
+{
+    QEvent *object = (QEvent *)ptr;
+    return (int)(object->type());
+}
 
 void PythonQt_init_QtCore(PyObject* module) {
 PythonQt::priv()->registerClass(&QAbstractAnimation::staticMetaObject, "QtCore", PythonQtCreateObject<PythonQtWrapper_QAbstractAnimation>, PythonQtSetInstanceWrapperOnShell<PythonQtShell_QAbstractAnimation>, module, 0);
@@ -133,7 +138,7 @@ PythonQt::priv()->registerClass(&QVariantAnimation::staticMetaObject, "QtCore",
 PythonQt::priv()->registerCPPClass("QWaitCondition", "", "QtCore", PythonQtCreateObject<PythonQtWrapper_QWaitCondition>, NULL, module, 0);
 PythonQt::priv()->registerCPPClass("QXmlStreamEntityResolver", "", "QtCore", PythonQtCreateObject<PythonQtWrapper_QXmlStreamEntityResolver>, PythonQtSetInstanceWrapperOnShell<PythonQtShell_QXmlStreamEntityResolver>, module, 0);
 
-PythonQt::self()->addPolymorphicHandler("QEvent", polymorphichandler_QEvent);
+PythonQt::self()->addPolymorphicHandler("QEvent", polymorphichandler_QEvent, polymorphicdiscriminator_QEvent);
 
 PythonQtRegisterListTemplateConverterForKnownClass(QList, QFileInfo);
 PythonQtRegisterListTemplateConverterForKnownClass(QList, QMimeType);
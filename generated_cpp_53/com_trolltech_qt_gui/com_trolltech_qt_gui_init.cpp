@@ -18,202 +18,196 @@ static void* polymorphichandler_QEvent(const void *ptr, const char **class_name)
 {
     Q_ASSERT(ptr != 0);
     QEvent *object = (QEvent *)ptr;
-    if (object->type() == QEvent::ActionAdded || object->type() == QEvent::ActionRemoved || object->type() == QEvent::ActionChanged) {
+    switch (object->type()) {
+    case QEvent::ActionAdded:
+    case QEvent::ActionRemoved:
+    case QEvent::ActionChanged:
         *class_name = "QActionEvent";
         return (QActionEvent*)object;
-    }
-    if (object->type() == QEvent::Close) {
+    case QEvent::Close:
         *class_name = "QCloseEvent";
         return (QCloseEvent*)object;
-    }
-    if (object->type() == QEvent::ContextMenu) {
+    case QEvent::ContextMenu:
         *class_name = "QContextMenuEvent";
         return (QContextMenuEvent*)object;
-    }
-    if (object->type() == QEvent::DragEnter) {
+    case QEvent::DragEnter:
         *class_name = "QDragEnterEvent";
         return (QDragEnterEvent*)object;
-    }
-    if (object->type() == QEvent::DragLeave) {
+    case QEvent::DragLeave:
         *class_name = "QDragLeaveEvent";
         return (QDragLeaveEvent*)object;
-    }
-    if (object->type() == QEvent::DragMove) {
+    case QEvent::DragMove:
         *class_name = "QDragMoveEvent";
         return (QDragMoveEvent*)object;
-    }
-    if (object->type() == QEvent::Drop) {
+    case QEvent::Drop:
         *class_name = "QDropEvent";
         return (QDropEvent*)object;
-    }
-    if (object->type() == QEvent::Enter) {
+    case QEvent::Enter:
         *class_name = "QEnterEvent";
         return (QEnterEvent*)object;
-    }
-    if (object->type() == QEvent::Expose) {
+    case QEvent::Expose:
         *class_name = "QExposeEvent";
         return (QExposeEvent*)object;
-    }
-    if (object->type() == QEvent::FileOpen) {
+    case QEvent::FileOpen:
         *class_name = "QFileOpenEvent";
         return (QFileOpenEvent*)object;
-    }
-    if (object->type() == QEvent::FocusIn || object->type() == QEvent::FocusOut) {
+    case QEvent::FocusIn:
+    case QEvent::FocusOut:
         *class_name = "QFocusEvent";
         return (QFocusEvent*)object;
-    }
-    if (object->type() == QEvent::Gesture || object->type() == QEvent::GestureOverride) {
+    case QEvent::Gesture:
+    case QEvent::GestureOverride:
         *class_name = "QGestureEvent";
         return (QGestureEvent*)object;
-    }
-    if (object->type() == QEvent::GraphicsSceneContextMenu) {
+    case QEvent::GraphicsSceneContextMenu:
         *class_name = "QGraphicsSceneContextMenuEvent";
         return (QGraphicsSceneContextMenuEvent*)object;
-    }
-    if (object->type() == QEvent::GraphicsSceneDragEnter || object->type() == QEvent::GraphicsSceneDragLeave || object->type() == QEvent::GraphicsSceneDragMove || object->type() == QEvent::GraphicsSceneDrop) {
+    case QEvent::GraphicsSceneDragEnter:
+    case QEvent::GraphicsSceneDragLeave:
+    case QEvent::GraphicsSceneDragMove:
+    case QEvent::GraphicsSceneDrop:
         *class_name = "QGraphicsSceneDragDropEvent";
         return (QGraphicsSceneDragDropEvent*)object;
-    }
-    if (object->type() == QEvent::GraphicsSceneHelp) {
+    case QEvent::GraphicsSceneHelp:
         *class_name = "QGraphicsSceneHelpEvent";
         return (QGraphicsSceneHelpEvent*)object;
-    }
-    if (object->type() == QEvent::GraphicsSceneHoverEnter || object->type() == QEvent::GraphicsSceneHoverLeave || object->type() == QEvent::GraphicsSceneHoverMove) {
+    case QEvent::GraphicsSceneHoverEnter:
+    case QEvent::GraphicsSceneHoverLeave:
+    case QEvent::GraphicsSceneHoverMove:
         *class_name = "QGraphicsSceneHoverEvent";
         return (QGraphicsSceneHoverEvent*)object;
-    }
-    if (object->type() == QEvent::GraphicsSceneMouseDoubleClick || object->type() == QEvent::GraphicsSceneMouseMove || object->type() == QEvent::GraphicsSceneMousePress || object->type() == QEvent::GraphicsSceneMouseRelease) {
+    case QEvent::GraphicsSceneMouseDoubleClick:
+    case QEvent::GraphicsSceneMouseMove:
+    case QEvent::GraphicsSceneMousePress:
+    case QEvent::GraphicsSceneMouseRelease:
         *class_name = "QGraphicsSceneMouseEvent";
         return (QGraphicsSceneMouseEvent*)object;
-    }
-    if (object->type() == QEvent::GraphicsSceneMove) {
+    case QEvent::GraphicsSceneMove:
         *class_name = "QGraphicsSceneMoveEvent";
         return (QGraphicsSceneMoveEvent*)object;
-    }
-    if (object->type() == QEvent::GraphicsSceneResize) {
+    case QEvent::GraphicsSceneResize:
         *class_name = "QGraphicsSceneResizeEvent";
         return (QGraphicsSceneResizeEvent*)object;
-    }
-    if (object->type() == QEvent::GraphicsSceneWheel) {
+    case QEvent::GraphicsSceneWheel:
         *class_name = "QGraphicsSceneWheelEvent";
         return (QGraphicsSceneWheelEvent*)object;
-    }
-    if (object->type() == QEvent::ToolTip || object->type() == QEvent::WhatsThis) {
+    case QEvent::ToolTip:
+    case QEvent::WhatsThis:
         *class_name = "QHelpEvent";
         return (QHelpEvent*)object;
-    }
-    if (object->type() == QEvent::Hide) {
+    case QEvent::Hide:
         *class_name = "QHideEvent";
         return (QHideEvent*)object;
-    }
-    if (object->type() == QEvent::HoverEnter || object->type() == QEvent::HoverLeave || object->type() == QEvent::HoverMove) {
+    case QEvent::HoverEnter:
+    case QEvent::HoverLeave:
+    case QEvent::HoverMove:
         *class_name = "QHoverEvent";
         return (QHoverEvent*)object;
-    }
-    if (object->type() == QEvent::IconDrag) {
+    case QEvent::IconDrag:
         *class_name = "QIconDragEvent";
         return (QIconDragEvent*)object;
-    }
-    if (object->type() == QEvent::InputMethod) {
+    case QEvent::InputMethod:
         *class_name = "QInputMethodEvent";
         return (QInputMethodEvent*)object;
-    }
-    if (object->type() == QEvent::InputMethodQuery) {
+    case QEvent::InputMethodQuery:
         *class_name = "QInputMethodQueryEvent";
         return (QInputMethodQueryEvent*)object;
-    }
-    if (object->type() == QEvent::KeyPress || object->type() == QEvent::KeyRelease) {
+    case QEvent::KeyPress:
+    case QEvent::KeyRelease:
         *class_name = "QKeyEvent";
         return (QKeyEvent*)object;
-    }
-    if (object->type() == QEvent::MouseButtonDblClick || object->type() == QEvent::MouseButtonPress || object->type() == QEvent::MouseButtonRelease || object->type() == QEvent::MouseMove) {
+    case QEvent::MouseButtonDblClick:
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+    case QEvent::MouseMove:
         *class_name = "QMouseEvent";
         return (QMouseEvent*)object;
-    }
-    if (object->type() == QEvent::Move) {
+    case QEvent::Move:
         *class_name = "QMoveEvent";
         return (QMoveEvent*)object;
-    }
-    if (object->type() == QEvent::NativeGesture) {
+    case QEvent::NativeGesture:
         *class_name = "QNativeGestureEvent";
         return (QNativeGestureEvent*)object;
-    }
-    if (object->type() == QEvent::Paint) {
+    case QEvent::Paint:
         *class_name = "QPaintEvent";
         return (QPaintEvent*)object;
-    }
-    if (object->type() == QEvent::Resize) {
+    case QEvent::Resize:
         *class_name = "QResizeEvent";
         return (QResizeEvent*)object;
-    }
-    if (object->type() == QEvent::Scroll) {
+    case QEvent::Scroll:
         *class_name = "QScrollEvent";
         return (QScrollEvent*)object;
-    }
-    if (object->type() == QEvent::ScrollPrepare) {
+    case QEvent::ScrollPrepare:
         *class_name = "QScrollPrepareEvent";
         return (QScrollPrepareEvent*)object;
-    }
-    if (object->type() == QEvent::Shortcut) {
+    case QEvent::Shortcut:
         *class_name = "QShortcutEvent";
         return (QShortcutEvent*)object;
-    }
-    if (object->type() == QEvent::Show) {
+    case QEvent::Show:
         *class_name = "QShowEvent";
         return (QShowEvent*)object;
-    }
-    if (object->type() == QEvent::StatusTip) {
+    case QEvent::StatusTip:
         *class_name = "QStatusTipEvent";
         return (QStatusTipEvent*)object;
-    }
-    if (object->type() == QEvent::TabletMove || object->type() == QEvent::TabletPress || object->type() == QEvent::TabletRelease) {
+    case QEvent::TabletMove:
+    case QEvent::TabletPress:
+    case QEvent::TabletRelease:
         *class_name = "QTabletEvent";
         return (QTabletEvent*)object;
-    }
-    if (object->type() == QEvent::ToolBarChange) {
+    case QEvent::ToolBarChange:
         *class_name = "QToolBarChangeEvent";
         return (QToolBarChangeEvent*)object;
-    }
-    if (object->type() == QEvent::TouchBegin || object->type() == QEvent::TouchUpdate || object->type() == QEvent::TouchEnd) {
+    case QEvent::TouchBegin:
+    case QEvent::TouchUpdate:
+    case QEvent::TouchEnd:
         *class_name = "QTouchEvent";
         return (QTouchEvent*)object;
-    }
-    if (object->type() == QEvent::WhatsThisClicked) {
+    case QEvent::WhatsThisClicked:
         *class_name = "QWhatsThisClickedEvent";
         return (QWhatsThisClickedEvent*)object;
-    }
-    if (object->type() == QEvent::Wheel) {
+    case QEvent::Wheel:
         *class_name = "QWheelEvent";
         return (QWheelEvent*)object;
-    }
-    if (object->type() == QEvent::WindowStateChange) {
+    case QEvent::WindowStateChange:
         *class_name = "QWindowStateChangeEvent";
         return (QWindowStateChangeEvent*)object;
+    default:
+        break;
     }
     return NULL;
 }
+static int polymorphicdiscriminator_QEvent(const void *ptr)
+{
+    QEvent *object = (QEvent *)ptr;
+    return (int)(object->type());
+}
 static void* polymorphichandler_QGradient(const void *ptr, const char **class_name)
 {
     Q_ASSERT(ptr != 0);
     QGradient *object = (QGradient *)ptr;
-    if (object->type() == QGradient::ConicalGradient) {
+    switch (object->type()) {
+    case QGradient::ConicalGradient:
         *class_name = "QConicalGradient";
         return (QConicalGradient*)object;
-    }
-    if (object->type() == QGradient::NoGradient) {
+    case QGradient::NoGradient:
         *class_name = "QGradient";
         return (QGradient*)object;
-    }
-    if (object->type() == QGradient::LinearGradient) {
+    case QGradient::LinearGradient:
         *class_name = "QLinearGradient";
         return (QLinearGradient*)object;
-    }
-    if (object->type() == QGradient::RadialGradient) {
+    case QGradient::RadialGradient:
         *class_name = "QRadialGradient";
         return (QRadialGradient*)object;
+    default:
+        break;
     }
     return NULL;
 }
+static int polymorphicdiscriminator_QGradient(const void *ptr)
+{
+    QGradient *object = (QGradient *)ptr;
+    return (int)(object->type());
+}
 static void* polymorphichandler_QGraphicsItem(const void *ptr, const char **class_name)
 {
     Q_ASSERT(ptr != 0);
@@ -798,8 +792,8 @@ PythonQt::priv()->registerCPPClass("QWindowStateChangeEvent", "QEvent", "QtGui",
 PythonQt::priv()->registerClass(&QWizard::staticMetaObject, "QtGui", PythonQtCreateObject<PythonQtWrapper_QWizard>, PythonQtSetInstanceWrapperOnShell<PythonQtShell_QWizard>, module, 0);
 PythonQt::priv()->registerClass(&QWizardPage::staticMetaObject, "QtGui", PythonQtCreateObject<PythonQtWrapper_QWizardPage>, PythonQtSetInstanceWrapperOnShell<PythonQtShell_QWizardPage>, module, 0);
 
-PythonQt::self()->addPolymorphicHandler("QEvent", polymorphichandler_QEvent);
-PythonQt::self()->addPolymorphicHandler("QGradient", polymorphichandler_QGradient);
+PythonQt::self()->addPolymorphicHandler("QEvent", polymorphichandler_QEvent, polymorphicdiscriminator_QEvent);
+PythonQt::self()->addPolymorphicHandler("QGradient", polymorphichandler_QGradient, polymorphicdiscriminator_QGradient);
 PythonQt::self()->addPolymorphicHandler("QGraphicsItem", polymorphichandler_QGraphicsItem);
 PythonQt::self()->addPolymorphicHandler("QStyleOption", polymorphichandler_QStyleOption);
 
@@ -52,6 +52,7 @@ Generator::Generator()
     m_num_generated = 0;
     m_num_generated_written = 0;
     m_out_dir = ".";
+    m_generate_direct_calls = false;
 }
 
 void Generator::generate()
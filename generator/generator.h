@@ -119,6 +119,10 @@ public:
     QSet<QString> qtMetaTypeDeclaredTypeNames() const
         { return m_qmetatype_declared_typenames; }
 
+    // PythonQt: generate typed direct calls for the wrapper slots
+    void setGenerateDirectCalls(bool generate) { m_generate_direct_calls = generate; }
+    bool generateDirectCalls() const { return m_generate_direct_calls; }
+
 protected:
     void verifyDirectoryFor(const QFile &file);
 
@@ -129,6 +133,9 @@ protected:
 
     // QtScript
     QSet<QString> m_qmetatype_declared_typenames;
+
+    // PythonQt
+    bool m_generate_direct_calls;
 };
 
 class Indentor {
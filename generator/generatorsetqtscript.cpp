@@ -48,18 +48,21 @@ GeneratorSet *GeneratorSet::getInstance() {
     return new GeneratorSetQtScript();
 }
 
-GeneratorSetQtScript::GeneratorSetQtScript() 
+GeneratorSetQtScript::GeneratorSetQtScript() :
+    directCalls(false)
 {}
 
 QString GeneratorSetQtScript::usage() {
     QString usage =
         "QtScript:\n" 
-        "  --nothing-to-report-yet                   \n";
+        "  --direct-calls                            \n"
+        "      generate typed calls for the wrapper slots, which PythonQt uses instead of qt_metacall\n";
 
     return usage;
 }
 
 bool GeneratorSetQtScript::readParameters(const QMap<QString, QString> args) {
+    directCalls = args.contains("direct-calls");
     return GeneratorSet::readParameters(args);
 }
 
@@ -85,16 +88,19 @@ QString GeneratorSetQtScript::generate() {
     setupGenerator.setOutputDirectory(outDir);
     setupGenerator.setQtMetaTypeDeclaredTypeNames(declaredTypeNames);
     setupGenerator.setClasses(classes);
+    setupGenerator.setGenerateDirectCalls(directCalls);
 
     ShellImplGenerator shellImplGenerator(&priGenerator);
     shellImplGenerator.setOutputDirectory(outDir);
     shellImplGenerator.setClasses(classes);
     shellImplGenerator.setQtMetaTypeDeclaredTypeNames(declaredTypeNames);
+    shellImplGenerator.setGenerateDirectCalls(directCalls);
     shellImplGenerator.generate();
 
     ShellHeaderGenerator shellHeaderGenerator(&priGenerator, &setupGenerator);
     shellHeaderGenerator.setOutputDirectory(outDir);
     shellHeaderGenerator.setClasses(classes);
+    shellHeaderGenerator.setGenerateDirectCalls(directCalls);
     shellHeaderGenerator.generate();
 
     priGenerator.generate();
@@ -62,6 +62,7 @@ public:
 
 private:
     MetaQtScriptBuilder builder;
+    bool directCalls;
   
 };
 
@@ -260,8 +260,9 @@ void SetupGenerator::generate()
       s << endl;
 
       QStringList polymorphicHandlers;
+      QStringList discriminatedHandlers;
       if (!packName.endsWith("_builtin")) {
-        polymorphicHandlers = writePolymorphicHandler(s, list.at(0)->package(), classes_with_polymorphic_id, list);
+        polymorphicHandlers = writePolymorphicHandler(s, list.at(0)->package(), classes_with_polymorphic_id, list, discriminatedHandlers);
         s << endl;
       }
 
@@ -310,6 +311,9 @@ void SetupGenerator::generate()
           QString baseName = cls->baseClass()?cls->baseClass()->qualifiedCppName():"";
           s << "PythonQt::priv()->registerCPPClass(\""<< cls->qualifiedCppName() << "\", \"" << baseName << "\", \"" << shortPackName <<"\", PythonQtCreateObject<PythonQtWrapper_" << cls->name() << ">" << shellCreator << ", module, " << operatorCodes <<");" << endl;
         }
+        if (generateDirectCalls()) {
+          s << "PythonQt::priv()->registerDirectCalls(&PythonQtWrapper_" << cls->name() << "::staticMetaObject, PythonQtWrapper_" << cls->name() << "::directCalls());" << endl;
+        }
         foreach(AbstractMetaClass* interface, cls->interfaces()) {
           // the interface might be our own class... (e.g. QPaintDevice)
           if (interface->qualifiedCppName() != cls->qualifiedCppName()) {
@@ -322,7 +326,11 @@ void SetupGenerator::generate()
       }
       s << endl;
       foreach (QString handler, polymorphicHandlers) {
-        s << "PythonQt::self()->addPolymorphicHandler(\""<< handler << "\", polymorphichandler_" << handler << ");" << endl;
+        s << "PythonQt::self()->addPolymorphicHandler(\""<< handler << "\", polymorphichandler_" << handler;
+        if (discriminatedHandlers.contains(handler)) {
+          s << ", polymorphicdiscriminator_" << handler;
+        }
+        s << ");" << endl;
       }
       s << endl;
 
@@ -344,8 +352,34 @@ void SetupGenerator::generate()
   }
 }
 
+//! splits a polymorphic id expression of the form "%1->type() == A || %1->type() == B" into
+//! its discriminator and values, returns false if the expression has another form
+static bool parsePolymorphicIdValues(const QString& polyId, QString& discriminator, QStringList& values)
+{
+  QRegExp valueExpression("[A-Za-z_][A-Za-z0-9_:]*");
+  foreach (QString test, polyId.split("||")) {
+    QStringList sides = test.split("==");
+    if (sides.size() != 2) {
+      return false;
+    }
+    QString left = sides.at(0).trimmed();
+    QString right = sides.at(1).trimmed();
+    if (!left.startsWith("%1") || left.contains('&') || left.contains('|') || !valueExpression.exactMatch(right)) {
+      return false;
+    }
+    if (discriminator.isEmpty()) {
+      discriminator = left;
+    } else if (discriminator != left) {
+      return false;
+    }
+    values << right;
+  }
+  return !values.isEmpty();
+}
+
 QStringList SetupGenerator::writePolymorphicHandler(QTextStream &s, const QString &package,
-                                                    const AbstractMetaClassList &polybase, QList<const AbstractMetaClass*>& allClasses)
+                                                    const AbstractMetaClassList &polybase, QList<const AbstractMetaClass*>& allClasses,
+                                                    QStringList& discriminatedHandlers)
 {
   QStringList handlers;
   foreach (AbstractMetaClass *cls, polybase) {
@@ -354,7 +388,7 @@ QStringList SetupGenerator::writePolymorphicHandler(QTextStream &s, const QStrin
       continue;
     bool isGraphicsItem = (cls->qualifiedCppName()=="QGraphicsItem");
 
-    bool first = true;
+    QList<const AbstractMetaClass*> polymorphicClasses;
     foreach (const AbstractMetaClass *clazz, allClasses) {
       bool inherits = false;
       if (isGraphicsItem) {
@@ -373,29 +407,7 @@ QStringList SetupGenerator::writePolymorphicHandler(QTextStream &s, const QStrin
       }
       if (clazz->package() == package && inherits) {
         if (!clazz->typeEntry()->polymorphicIdValue().isEmpty()) {
-          // On first find, open the function
-          if (first) {
-            first = false;
-
-            QString handler = cls->name();
-            handlers.append(handler);
-
-            s << "static void* polymorphichandler_" << handler
-              << "(const void *ptr, const char **class_name)" << endl
-              << "{" << endl
-              << "    Q_ASSERT(ptr != 0);" << endl
-              << "    " << cls->qualifiedCppName() << " *object = ("
-              << cls->qualifiedCppName() << " *)ptr;" << endl;
-          }
-
-          // For each, add case label
-          QString polyId = clazz->typeEntry()->polymorphicIdValue();
-          s << "    if ("
-            << polyId.replace("%1", "object")
-            << ") {" << endl
-            << "        *class_name = \"" << clazz->name() << "\";" << endl
-            << "        return (" << clazz->qualifiedCppName() << "*)object;" << endl
-            << "    }" << endl;
+          polymorphicClasses.append(clazz);
         } else {
           QString warning = QString("class '%1' inherits from polymorphic class '%2', but has no polymorphic id set")
             .arg(clazz->name())
@@ -405,10 +417,78 @@ QStringList SetupGenerator::writePolymorphicHandler(QTextStream &s, const QStrin
         }
       }
     }
+    if (polymorphicClasses.isEmpty()) {
+      continue;
+    }
+
+    // if all ids compare the same discriminator with constants, a switch is generated
+    // instead of testing the ids one after the other
+    QString discriminator;
+    QList<QStringList> switchValues;
+    foreach (const AbstractMetaClass *clazz, polymorphicClasses) {
+      QStringList values;
+      if (!parsePolymorphicIdValues(clazz->typeEntry()->polymorphicIdValue(), discriminator, values)) {
+        switchValues.clear();
+        break;
+      }
+      switchValues.append(values);
+    }
+
+    QString handler = cls->name();
+    handlers.append(handler);
+
+    s << "static void* polymorphichandler_" << handler
+      << "(const void *ptr, const char **class_name)" << endl
+      << "{" << endl
+      << "    Q_ASSERT(ptr != 0);" << endl
+      << "    " << cls->qualifiedCppName() << " *object = ("
+      << cls->qualifiedCppName() << " *)ptr;" << endl;
+
+    if (!switchValues.isEmpty()) {
+      s << "    switch (" << QString(discriminator).replace("%1", "object") << ") {" << endl;
+      QSet<QString> usedValues;
+      for (int i = 0; i < polymorphicClasses.size(); i++) {
+        const AbstractMetaClass *clazz = polymorphicClasses.at(i);
+        bool hasCase = false;
+        foreach (const QString& value, switchValues.at(i)) {
+          // the first class with a value wins, as it did in the sequence of tests
+          if (!usedValues.contains(value)) {
+            usedValues.insert(value);
+            s << "    case " << value << ":" << endl;
+            hasCase = true;
+          }
+        }
+        if (hasCase) {
+          s << "        *class_name = \"" << clazz->name() << "\";" << endl
+            << "        return (" << clazz->qualifiedCppName() << "*)object;" << endl;
+        }
+      }
+      s << "    default:" << endl
+        << "        break;" << endl
+        << "    }" << endl;
+    } else {
+      foreach (const AbstractMetaClass *clazz, polymorphicClasses) {
+        QString polyId = clazz->typeEntry()->polymorphicIdValue();
+        s << "    if ("
+          << polyId.replace("%1", "object")
+          << ") {" << endl
+          << "        *class_name = \"" << clazz->name() << "\";" << endl
+          << "        return (" << clazz->qualifiedCppName() << "*)object;" << endl
+          << "    }" << endl;
+      }
+    }
 
-    // Close the function if it has been opened
-    if (!first) {
-      s << "    return NULL;" << endl
+    s << "    return NULL;" << endl
+      << "}" << endl;
+
+    if (!switchValues.isEmpty()) {
+      // the result of the switch only depends on the discriminator, so PythonQt can cache it per value
+      discriminatedHandlers.append(handler);
+      s << "static int polymorphicdiscriminator_" << handler << "(const void *ptr)" << endl
+        << "{" << endl
+        << "    " << cls->qualifiedCppName() << " *object = ("
+        << cls->qualifiedCppName() << " *)ptr;" << endl
+        << "    return (int)(" << QString(discriminator).replace("%1", "object") << ");" << endl
         << "}" << endl;
     }
   }
@@ -60,7 +60,8 @@ class SetupGenerator : public Generator
   
  private:
    QStringList writePolymorphicHandler(QTextStream &s, const QString &package,
-     const AbstractMetaClassList &polyBaseClasses, QList<const AbstractMetaClass*>& allClasses);
+     const AbstractMetaClassList &polyBaseClasses, QList<const AbstractMetaClass*>& allClasses,
+     QStringList& discriminatedHandlers);
 
    QHash<QString, QList<const AbstractMetaClass*> > packHash;
 };
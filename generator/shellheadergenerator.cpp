@@ -193,6 +193,9 @@ void ShellHeaderGenerator::write(QTextStream &s, const AbstractMetaClass *meta_c
     << "{ Q_OBJECT" << endl;
 
   s << "public:" << endl;
+  if (generateDirectCalls()) {
+    s << "  static const PythonQtDirectCallEntry* directCalls();" << endl;
+  }
 
   AbstractMetaEnumList enums1 = meta_class->enums();
   qSort(enums1.begin(), enums1.end(), enum_lessThan);
@@ -75,6 +75,9 @@ void ShellImplGenerator::write(QTextStream &s, const AbstractMetaClass *meta_cla
   s << "#include <PythonQtSignalReceiver.h>" << endl;
   s << "#include <PythonQtMethodInfo.h>" << endl;
   s << "#include <PythonQtConversion.h>" << endl;
+  if (generateDirectCalls()) {
+    s << "#include <PythonQtDirectCall.h>" << endl;
+  }
 
   //if (!meta_class->generateShellClass())
   //    return;
@@ -124,9 +127,12 @@ void ShellImplGenerator::write(QTextStream &s, const AbstractMetaClass *meta_cla
       Option typeOptions = Option(OriginalName | UnderscoreSpaces | SkipName);
       AbstractMetaArgumentList args = fun->arguments();
 
-      s << "if (_wrapper && (((PyObject*)_wrapper)->ob_refcnt > 0)) {" << endl;
+      // the reference count of the wrapper may only be read while holding the GIL
+      s << "if (_wrapper) {" << endl;
+      s << "  PYTHONQT_GIL_SCOPE" << endl;
       s << "  static PyObject* name = PyString_FromString(\"" << fun->name() << "\");" << endl;
-      s << "  PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);" << endl;
+      s << "  static int overrideIndex = PythonQtInstanceWrapper_overrideIndex(\"" << fun->name() << "\");" << endl;
+      s << "  PyObject* obj = (((PyObject*)_wrapper)->ob_refcnt > 0) ? PythonQtInstanceWrapper_findOverride(_wrapper, overrideIndex, name) : NULL;" << endl;
       s << "  if (obj) {" << endl;
       s << "    static const char* argumentList[] ={\"";
       if (hasReturnValue) {
@@ -314,6 +320,10 @@ void ShellImplGenerator::write(QTextStream &s, const AbstractMetaClass *meta_cla
     s << "}" << endl << endl;
   }
 
+  if (generateDirectCalls()) {
+    writeDirectCalls(s, meta_class, functions);
+  }
+
   writeInjectedCode(s, meta_class);
 
   if (meta_class->qualifiedCppName().contains("Ssl")) {
@@ -321,6 +331,126 @@ void ShellImplGenerator::write(QTextStream &s, const AbstractMetaClass *meta_cla
   }
 }
 
+void ShellImplGenerator::writeDirectCalls(QTextStream &s, const AbstractMetaClass *meta_class, const AbstractMetaFunctionList &functions)
+{
+  // Each direct call converts the Python arguments to typed C++ values (see PythonQtDirectCall.h),
+  // calls the wrapper slot as a normal method and converts the result, so PythonQt does not need qt_metacall.
+  // It returns NULL without an exception if the arguments do not match, so that the next overload is tried.
+  QString wrapperName = wrapperClassName(meta_class);
+  QStringList entries;
+  foreach (const AbstractMetaFunction *fun, functions) {
+    bool needsWrapping = (!fun->isSlot() || fun->isVirtual());
+    if (!needsWrapping) {
+      continue;
+    }
+    AbstractMetaArgumentList args = fun->arguments();
+    bool supported = true;
+    foreach (const AbstractMetaArgument *arg, args) {
+      if (arg->type()->isArray()) {
+        supported = false;
+      }
+    }
+    if (!supported) {
+      continue;
+    }
+    // moc creates a slot for each number of arguments if there are default arguments
+    int minArgs = args.size();
+    while (minArgs > 0 && !args.at(minArgs-1)->defaultValueExpression().isEmpty()) {
+      minArgs--;
+    }
+    bool hasWrappedObject = fun->ownerClass() && !fun->isStatic();
+
+    for (int numArgs = minArgs; numArgs <= args.size(); numArgs++) {
+      QString signature;
+      {
+        QTextStream ss(&signature);
+        writeFunctionSignature(ss, fun, 0, QString(),
+          Option(FirstArgIsWrappedObject | OriginalName | ShowStatic | UnderscoreSpaces | SkipReturnType | SkipName),
+          QString(), QStringList(), numArgs);
+      }
+      signature = signature.left(signature.lastIndexOf(')') + 1);
+      signature.replace(" theWrappedObject", "");
+      QString slotName = signature.left(signature.indexOf('('));
+
+      QString callName = QString("PythonQtDirectCall_%1_%2").arg(meta_class->name()).arg(entries.size());
+      entries << QString("{\"%1\", %2}").arg(signature, callName);
+
+      s << "static PyObject* " << callName << "(PythonQtDirectCallContext& context, QObject* decorator, void* object, PyObject* args)" << endl;
+      s << "{" << endl;
+      if (!hasWrappedObject) {
+        s << "  Q_UNUSED(object);" << endl;
+      }
+      if (numArgs == 0) {
+        s << "  Q_UNUSED(args);" << endl;
+      }
+      for (int i = 0; i < numArgs; ++i) {
+        s << "  PythonQtDirectArgument<";
+        writeTypeInfo(s, args.at(i)->type(), Option(ExcludeConst | ExcludeReference | SkipName));
+        s << " > a" << i << ";" << endl;
+        s << "  if (!a" << i << ".convert(context, args, " << i << ")) return NULL;" << endl;
+      }
+
+      QString call;
+      {
+        QTextStream cs(&call);
+        cs << "static_cast<" << wrapperName << "*>(decorator)->" << slotName << "(";
+        if (hasWrappedObject) {
+          cs << "static_cast<" << fun->ownerClass()->qualifiedCppName() << "*>(object)";
+        }
+        for (int i = 0; i < numArgs; ++i) {
+          if (i > 0 || hasWrappedObject) {
+            cs << ", ";
+          }
+          cs << "a" << i << ".value()";
+        }
+        cs << ")";
+      }
+
+      s << "  PyObject* result = NULL;" << endl;
+      s << "  context.enter();" << endl;
+      s << "  try {" << endl;
+      s << "    PythonQtThreadStateSaver threadStateSaver(context.releaseGIL());" << endl;
+      AbstractMetaType *type = fun->type();
+      if (type) {
+        // the wrapper slots return pointers instead of references
+        Option returnOptions = Option(ConvertReferenceToPtr | SkipName);
+        if (!type->isReference() && type->indirections() == 0) {
+          returnOptions = Option(returnOptions | ExcludeConst);
+        }
+        s << "    ";
+        writeTypeInfo(s, type, returnOptions);
+        s << " r = " << call << ";" << endl;
+        s << "    threadStateSaver.restore();" << endl;
+        s << "    context.leave();" << endl;
+        s << "    result = PythonQtDirectReturnValue(context, r);" << endl;
+      } else {
+        s << "    " << call << ";" << endl;
+        s << "    threadStateSaver.restore();" << endl;
+        s << "    context.leave();" << endl;
+        s << "    Py_INCREF(Py_None);" << endl;
+        s << "    result = Py_None;" << endl;
+      }
+      s << "  } catch (std::exception& e) {" << endl;
+      s << "    context.leave();" << endl;
+      s << "    context.setException(e);" << endl;
+      s << "  }" << endl;
+      s << "  return result;" << endl;
+      s << "}" << endl << endl;
+    }
+  }
+
+  s << "const PythonQtDirectCallEntry* " << wrapperName << "::directCalls()" << endl;
+  s << "{" << endl;
+  s << "  static const PythonQtDirectCallEntry entries[] = {" << endl;
+  foreach (const QString &entry, entries) {
+    s << "    " << entry << "," << endl;
+  }
+  s << "    {NULL, NULL}" << endl;
+  s << "  };" << endl;
+  s << "  return entries;" << endl;
+  s << "}" << endl << endl;
+}
+
 void ShellImplGenerator::writeInjectedCode(QTextStream &s, const AbstractMetaClass *meta_class)
 {
   CodeSnipList code_snips = meta_class->typeEntry()->codeSnips();
@@ -59,6 +59,7 @@ public:
 
     void write(QTextStream &s, const AbstractMetaClass *meta_class);
     void writeInjectedCode(QTextStream &s, const AbstractMetaClass *meta_class);
+    void writeDirectCalls(QTextStream &s, const AbstractMetaClass *meta_class, const AbstractMetaFunctionList &functions);
 
 };
 
@@ -53,12 +53,19 @@
 #include "PythonQtStdDecorators.h"
 #include "PythonQtQFileImporter.h"
 #include "PythonQtBoolResult.h"
+#include "PythonQtByteArrayBuffer.h"
+#include "PythonQtSequenceView.h"
+#include "PythonQtNumericBuffer.h"
+#include "PythonQtEventLoop.h"
 #include <pydebug.h>
 #include <vector>
+#include <QTimer>
 
 PythonQt* PythonQt::_self = NULL;
 int       PythonQt::_uniqueModuleCount = 0;
 
+bool PythonQtThreadSupport::_enabled = false;
+
 void PythonQt_init_QtGuiBuiltin(PyObject*);
 void PythonQt_init_QtCoreBuiltin(PyObject*);
 
@@ -261,6 +268,18 @@ PythonQt::PythonQt(int flags, const QByteArray& pythonQtModuleName)
     Py_Initialize();
   }
 
+  if (flags & ThreadSupport) {
+#if PY_VERSION_HEX < 0x03070000
+    // make sure that the GIL exists, so that we can release and acquire it (always the case since Python 3.7)
+    PyEval_InitThreads();
+#endif
+    PythonQtThreadSupport::setEnabled(true);
+  }
+
+  if (flags & LazyClassRegistration) {
+    setLazyClassRegistrationEnabled(true);
+  }
+
   // add our own python object types for qt object slots
   if (PyType_Ready(&PythonQtSlotFunction_Type) < 0) {
     std::cerr << "could not initialize PythonQtSlotFunction_Type" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
@@ -278,6 +297,21 @@ PythonQt::PythonQt(int flags, const QByteArray& pythonQtModuleName)
   }
   Py_INCREF(&PythonQtBoolResult_Type);
 
+  if (PyType_Ready(&PythonQtByteArrayBuffer_Type) < 0) {
+    std::cerr << "could not initialize PythonQtByteArrayBuffer_Type" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
+  }
+  Py_INCREF(&PythonQtByteArrayBuffer_Type);
+
+  if (PyType_Ready(&PythonQtSequenceView_Type) < 0) {
+    std::cerr << "could not initialize PythonQtSequenceView_Type" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
+  }
+  Py_INCREF(&PythonQtSequenceView_Type);
+
+  if (PyType_Ready(&PythonQtNumericBuffer_Type) < 0) {
+    std::cerr << "could not initialize PythonQtNumericBuffer_Type" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
+  }
+  Py_INCREF(&PythonQtNumericBuffer_Type);
+
   // according to Python docs, set the type late here, since it can not safely be stored in the struct when declaring it
   PythonQtClassWrapper_Type.tp_base = &PyType_Type;
   // add our own python object types for classes
@@ -310,14 +344,23 @@ PythonQt::PythonQt(int flags, const QByteArray& pythonQtModuleName)
 }
 
 PythonQt::~PythonQt() {
+  flushStdOut();
   delete _p;
   _p = NULL;
+  PythonQtProfiler::setEnabled(false);
+  PythonQtProfiler::clear();
+  PythonQtThreadSupport::setEnabled(false);
+  PythonQtImport::setDirectoryCacheEnabled(false);
+  PythonQtImport::setBytecodeCacheDirectory(QString());
 }
 
 PythonQtPrivate::~PythonQtPrivate() {
   delete _defaultImporter;
   _defaultImporter = NULL;
 
+  delete _eventLoopHelper;
+  _eventLoopHelper = NULL;
+
   {
     QHashIterator<QByteArray, PythonQtClassInfo *> i(_knownClassInfos);
     while (i.hasNext()) {
@@ -398,7 +441,7 @@ void PythonQtPrivate::registerClass(const QMetaObject* metaobject, const char* p
   bool first = true;
   while (m) {
     PythonQtClassInfo* info = lookupClassInfoAndCreateIfNotPresent(m->className());
-    if (!info->pythonQtClassWrapper()) {
+    if (!info->hasPythonQtClassWrapper()) {
       info->setTypeSlots(typeSlots);
       info->setupQObject(m);
       createPythonQtClassWrapper(info, package, module);
@@ -410,10 +453,18 @@ void PythonQtPrivate::registerClass(const QMetaObject* metaobject, const char* p
       // There is a wrapper already, but if we got a module, we want to place the wrapper into that module as well,
       // since it might have been placed into "private" earlier on.
       // If the wrapper was already added to module before, it is just readded, which does no harm.
-      PyObject* classWrapper = info->pythonQtClassWrapper();
-      // AddObject steals a reference, so we need to INCREF
-      Py_INCREF(classWrapper);
-      PyModule_AddObject(module, info->className(), classWrapper);
+      if (info->isPythonQtClassWrapperPending()) {
+        PendingClassWrapper& pending = _pendingClassWrappers[info];
+        if (!pending.packages.contains(module)) {
+          pending.packages << module;
+          addPendingClassWrapper(module, info);
+        }
+      } else {
+        PyObject* classWrapper = info->pythonQtClassWrapper();
+        // AddObject steals a reference, so we need to INCREF
+        Py_INCREF(classWrapper);
+        PyModule_AddObject(module, info->className(), classWrapper);
+      }
     }
     if (first) {
       first = false;
@@ -430,29 +481,54 @@ void PythonQtPrivate::registerClass(const QMetaObject* metaobject, const char* p
 
 void PythonQtPrivate::createPythonQtClassWrapper(PythonQtClassInfo* info, const char* package, PyObject* module)
 {
-  QByteArray pythonClassName = info->className();
-  int nestedClassIndex = pythonClassName.indexOf("::");
-  bool isNested = false;
-  if (nestedClassIndex>0) {
-    pythonClassName = pythonClassName.mid(nestedClassIndex + 2);
-    isNested = true;
-  }
+  QByteArray className = info->className();
+  int nestedClassIndex = className.indexOf("::");
+  bool isNested = nestedClassIndex>0;
 
   PyObject* pack = module?module:packageByName(package);
-  PyObject* pyobj = (PyObject*)createNewPythonQtClassWrapper(info, pack, pythonClassName);
-
+  QList<PyObject*> packages;
   if (isNested) {
-    QByteArray outerClass = QByteArray(info->className()).mid(0, nestedClassIndex);
+    QByteArray outerClass = className.mid(0, nestedClassIndex);
     PythonQtClassInfo* outerClassInfo = lookupClassInfoAndCreateIfNotPresent(outerClass);
     outerClassInfo->addNestedClass(info);
   } else {
-    PyModule_AddObject(pack, info->className(), pyobj);
+    packages << pack;
   }
   if (!module && package && strncmp(package, "Qt", 2) == 0) {
-    // since PyModule_AddObject steals the reference, we need a incref once more...
-    Py_INCREF(pyobj);
     // put all qt objects into Qt as well
-    PyModule_AddObject(packageByName("Qt"), info->className(), pyobj);
+    packages << packageByName("Qt");
+  }
+
+  if (_lazyClassRegistration) {
+    // only record where the wrapper belongs, it is created by PythonQtClassInfo::pythonQtClassWrapper() on first use
+    PendingClassWrapper pending;
+    pending.parentModule = pack;
+    pending.packages = packages;
+    _pendingClassWrappers.insert(info, pending);
+    info->setPythonQtClassWrapperPending(true);
+    Q_FOREACH(PyObject* package, packages) {
+      addPendingClassWrapper(package, info);
+    }
+  } else {
+    createPythonQtClassWrapperInPackages(info, pack, packages);
+  }
+}
+
+void PythonQtPrivate::createPythonQtClassWrapperInPackages(PythonQtClassInfo* info, PyObject* parentModule, const QList<PyObject*>& packages)
+{
+  QByteArray pythonClassName = info->className();
+  int nestedClassIndex = pythonClassName.indexOf("::");
+  if (nestedClassIndex>0) {
+    pythonClassName = pythonClassName.mid(nestedClassIndex + 2);
+  }
+
+  PyObject* pyobj = (PyObject*)createNewPythonQtClassWrapper(info, parentModule, pythonClassName);
+  for (int i = 0; i < packages.count(); i++) {
+    if (i>0) {
+      // since PyModule_AddObject steals the reference, we need a incref once more...
+      Py_INCREF(pyobj);
+    }
+    PyModule_AddObject(packages.at(i), info->className(), pyobj);
   }
   info->setPythonQtClassWrapper(pyobj);
 }
@@ -474,7 +550,7 @@ PyObject* PythonQtPrivate::wrapQObject(QObject* obj)
   if (!wrap) {
     // smuggling it in...
     PythonQtClassInfo* classInfo = _knownClassInfos.value(obj->metaObject()->className());
-    if (!classInfo || classInfo->pythonQtClassWrapper()==NULL) {
+    if (!classInfo || !classInfo->hasPythonQtClassWrapper()) {
       registerClass(obj->metaObject());
       classInfo = _knownClassInfos.value(obj->metaObject()->className());
     }
@@ -575,7 +651,7 @@ PyObject* PythonQtPrivate::wrapPtr(void* ptr, const QByteArray& name)
       }
     }
 
-    if (!info || info->pythonQtClassWrapper()==NULL) {
+    if (!info || !info->hasPythonQtClassWrapper()) {
       // still unknown, register as CPP class
       registerCPPClass(name.constData());
       info = _knownClassInfos.value(name);
@@ -634,6 +710,67 @@ PythonQtInstanceWrapper* PythonQtPrivate::createNewPythonQtInstanceWrapper(QObje
   return result;
 }
 
+PyObject* PythonQtPrivate::createInlineCopyFromMetaType(int type, const void* data)
+{
+#if( QT_VERSION >= QT_VERSION_CHECK(5,0,0) )
+  int size = QMetaType::sizeOf(type);
+  if (size <= 0 || size > PYTHONQT_INSTANCEWRAPPER_INLINE_STORAGE_SIZE) {
+    return NULL;
+  }
+#if( QT_VERSION >= QT_VERSION_CHECK(6,0,0) )
+  int alignment = QMetaType(type).alignOf();
+#else
+  // the alignment is not available from QMetaType, but it always divides the size, so we assume the
+  // largest power of two that divides the size (at most 16, which is all that a heap copy guarantees as well)
+  int alignment = qMin(size & -size, 16);
+#endif
+  QByteArray name = QMetaType::typeName(type);
+  PythonQtClassInfo* info = _knownClassInfos.value(name);
+  if (!info || !info->hasPythonQtClassWrapper() || info->isQObject() || info->metaTypeId() != type) {
+    return NULL;
+  }
+  // a polymorphic handler might want to wrap the object with another class info,
+  // which is handled by wrapPtr()
+  PythonQtClassInfo* castInfo = info;
+  info->castDownIfPossible(const_cast<void*>(data), &castInfo);
+  if (castInfo != info) {
+    return NULL;
+  }
+
+  PythonQtInstanceWrapper* result = (PythonQtInstanceWrapper*)PyObject_Call(info->pythonQtClassWrapper(), dummyTuple(), NULL);
+  if (!result) {
+    return NULL;
+  }
+  if (((quintptr)&result->_inlineStorage) % alignment == 0) {
+    result->_wrappedPtr = QMetaType::construct(type, &result->_inlineStorage, data);
+    result->_useInlineStorage = true;
+  } else {
+    // the storage of this wrapper is not aligned well enough for the type, so we use a heap copy instead
+    result->_wrappedPtr = QMetaType::create(type, data);
+    result->_useQMetaTypeDestroy = true;
+  }
+  result->_ownedByPythonQt = true;
+  _wrappedObjects.insert(result->_wrappedPtr, result);
+
+  // as in wrapPtr(), a cpp wrapper factory may provide a QObject wrapper for the copy
+  for (int i=0; i<_cppWrapperFactories.size(); i++) {
+    QObject* wrapper = _cppWrapperFactories.at(i)->create(name, result->_wrappedPtr);
+    if (wrapper) {
+      if (info->metaObject() != wrapper->metaObject()) {
+        info->setMetaObject(wrapper->metaObject());
+      }
+      result->setQObject(wrapper);
+      break;
+    }
+  }
+  return (PyObject*)result;
+#else
+  Q_UNUSED(type);
+  Q_UNUSED(data);
+  return NULL;
+#endif
+}
+
 PythonQtClassWrapper* PythonQtPrivate::createNewPythonQtClassWrapper(PythonQtClassInfo* info, PyObject* parentModule, const QByteArray& pythonClassName) {
   PythonQtClassWrapper* result;
 
@@ -782,17 +919,13 @@ PythonQtObjectPtr PythonQt::lookupCallable(PyObject* module, const QString& name
 
 PythonQtObjectPtr PythonQt::lookupObject(PyObject* module, const QString& name)
 {
-  QStringList l = name.split('.');
+  QList<PythonQtObjectPtr> l = _p->_codeCache.attributePath(name);
   PythonQtObjectPtr p = module;
-  PythonQtObjectPtr prev;
-  QByteArray b;
-  for (QStringList::ConstIterator i = l.begin(); i!=l.end() && p; ++i) {
-    prev = p;
-    b = (*i).toLatin1();
+  for (QList<PythonQtObjectPtr>::ConstIterator i = l.constBegin(); i!=l.constEnd() && p; ++i) {
     if (PyDict_Check(p)) {
-      p = PyDict_GetItemString(p, b.data());
+      p = PyDict_GetItem(p, *i);
     } else {
-      p.setNewRef(PyObject_GetAttrString(p, b.data()));
+      p.setNewRef(PyObject_GetAttr(p, *i));
     }
   }
   PyErr_Clear();
@@ -814,6 +947,7 @@ PythonQtObjectPtr PythonQt::importModule(const QString& name)
 
 
 QVariant PythonQt::evalCode(PyObject* object, PyObject* pycode) {
+  PYTHONQT_GIL_SCOPE
   QVariant result;
   clearError();
   if (pycode) {
@@ -857,6 +991,7 @@ QVariant PythonQt::evalCode(PyObject* object, PyObject* pycode) {
 
 QVariant PythonQt::evalScript(PyObject* object, const QString& script, int start)
 {
+  PYTHONQT_GIL_SCOPE
   QVariant result;
   PythonQtObjectPtr p;
   PyObject* dict = NULL;
@@ -867,7 +1002,17 @@ QVariant PythonQt::evalScript(PyObject* object, const QString& script, int start
     dict = object;
   }
   if (dict) {
-    p.setNewRef(PyRun_String(script.toLatin1().data(), start, dict, dict));
+    PythonQtObjectPtr code = _p->_codeCache.code(script, start);
+    if (code) {
+      if (!PyDict_GetItemString(dict, "__builtins__")) {
+        PyDict_SetItemString(dict, "__builtins__", PyEval_GetBuiltins());
+      }
+#ifdef PY3K
+      p.setNewRef(PyEval_EvalCode(code, dict, dict));
+#else
+      p.setNewRef(PyEval_EvalCode((PyCodeObject*)code.object(), dict, dict));
+#endif
+    }
   }
   if (p) {
     result = PythonQtConv::PyObjToQVariant(p);
@@ -879,6 +1024,7 @@ QVariant PythonQt::evalScript(PyObject* object, const QString& script, int start
 
 void PythonQt::evalFile(PyObject* module, const QString& filename)
 {
+  PYTHONQT_GIL_SCOPE
   PythonQtObjectPtr code = parseFile(filename);
   clearError();
   if (code) {
@@ -890,6 +1036,7 @@ void PythonQt::evalFile(PyObject* module, const QString& filename)
 
 PythonQtObjectPtr PythonQt::parseFile(const QString& filename)
 {
+  PYTHONQT_GIL_SCOPE
   PythonQtObjectPtr p;
   p.setNewRef(PythonQtImport::getCodeFromPyc(filename));
   clearError();
@@ -915,7 +1062,7 @@ PythonQtObjectPtr PythonQt::createModuleFromScript(const QString& name, const QS
     scriptCode = "\n";
   }
   PythonQtObjectPtr pycode;
-  pycode.setNewRef(Py_CompileString((char*)scriptCode.toLatin1().data(), "",  Py_file_input));
+  pycode.setNewRef(Py_CompileString((char*)scriptCode.toUtf8().data(), "",  Py_file_input));
   PythonQtObjectPtr module = _p->createModule(name, pycode);
   return module;
 }
@@ -968,6 +1115,76 @@ QVariant PythonQt::getVariable(PyObject* object, const QString& objectname)
   return result;
 }
 
+QVariantMap PythonQt::getProperties(QObject* object, const QStringList& names)
+{
+  QVariantMap result;
+  if (!object) {
+    return result;
+  }
+  const QMetaObject* meta = object->metaObject();
+  if (names.isEmpty()) {
+    for (int i = 0; i < meta->propertyCount(); i++) {
+      QMetaProperty prop = meta->property(i);
+      if (prop.isReadable()) {
+        result.insert(prop.name(), prop.read(object));
+      }
+    }
+  } else {
+    Q_FOREACH(const QString& name, names) {
+      int index = meta->indexOfProperty(name.toLatin1().constData());
+      if (index >= 0) {
+        result.insert(name, meta->property(index).read(object));
+      }
+    }
+  }
+  return result;
+}
+
+bool PythonQt::setProperties(QObject* object, const QVariantMap& values)
+{
+  if (!object) {
+    return false;
+  }
+  // check and convert all values first, so that nothing is written if one of them is invalid (as in obj.setProperties())
+  const QMetaObject* meta = object->metaObject();
+  QList<QMetaProperty> properties;
+  QList<QVariant> converted;
+  QString error;
+  QMapIterator<QString, QVariant> it(values);
+  while (it.hasNext() && error.isEmpty()) {
+    it.next();
+    int index = meta->indexOfProperty(it.key().toLatin1().constData());
+    if (index < 0) {
+      error = QString(meta->className()) + " has no property named '" + it.key() + "'";
+      break;
+    }
+    QMetaProperty prop = meta->property(index);
+    QVariant v = it.value();
+    if (!prop.isWritable()) {
+      error = "Property '" + it.key() + "' of " + meta->className() + " is not writable";
+    } else if (!prop.isEnumType() && prop.userType() != QMetaType::QVariant &&
+               v.userType() != prop.userType() && !v.convert((QVariant::Type)prop.userType())) {
+      error = "Property '" + it.key() + "' of type '" + prop.typeName() + "' does not accept a value of type '" + it.value().typeName() + "'";
+    }
+    properties << prop;
+    converted << v;
+  }
+  if (error.isEmpty()) {
+    for (int i = 0; i < properties.size(); i++) {
+      if (!properties.at(i).write(object, converted.at(i)) && error.isEmpty()) {
+        error = QString("Property '") + properties.at(i).name() + "' of type '" + properties.at(i).typeName() + "' could not be written";
+      }
+    }
+  }
+  if (!error.isEmpty()) {
+    PYTHONQT_GIL_SCOPE
+    PyErr_SetString(PyExc_AttributeError, error.toLatin1().data());
+    handleError();
+    return false;
+  }
+  return true;
+}
+
 QStringList PythonQt::introspection(PyObject* module, const QString& objectname, PythonQt::ObjectType type)
 {
   QStringList results;
@@ -1180,6 +1397,7 @@ QStringList PythonQt::introspectType(const QString& typeName, ObjectType type)
 
 QVariant PythonQt::call(PyObject* object, const QString& name, const QVariantList& args, const QVariantMap& kwargs)
 {
+  PYTHONQT_GIL_SCOPE
   PythonQtObjectPtr callable = lookupCallable(object, name);
   if (callable) {
     return call(callable, args, kwargs);
@@ -1190,6 +1408,7 @@ QVariant PythonQt::call(PyObject* object, const QString& name, const QVariantLis
 
 QVariant PythonQt::call(PyObject* callable, const QVariantList& args, const QVariantMap& kwargs)
 {
+  PYTHONQT_GIL_SCOPE
   QVariant r;
   PythonQtObjectPtr result;
   result.setNewRef(callAndReturnPyObject(callable, args, kwargs));
@@ -1204,6 +1423,7 @@ QVariant PythonQt::call(PyObject* callable, const QVariantList& args, const QVar
 
 PyObject* PythonQt::callAndReturnPyObject(PyObject* callable, const QVariantList& args, const QVariantMap& kwargs)
 {
+  PYTHONQT_GIL_SCOPE
   PyObject* result = NULL;
   if (callable) {
     bool err = false;
@@ -1278,6 +1498,7 @@ void PythonQt::registerQObjectClassNames(const QStringList& names)
 void PythonQt::setImporter(PythonQtImportFileInterface* importInterface)
 {
   _p->_importInterface = importInterface;
+  PythonQtImport::clearDirectoryCache();
   PythonQtImport::init();
 }
 
@@ -1291,6 +1512,64 @@ const QStringList& PythonQt::getImporterIgnorePaths()
   return _p->_importIgnorePaths;
 }
 
+void PythonQt::setImporterDirectoryCacheEnabled(bool enabled)
+{
+  PythonQtImport::setDirectoryCacheEnabled(enabled);
+}
+
+bool PythonQt::importerDirectoryCacheEnabled()
+{
+  return PythonQtImport::directoryCacheEnabled();
+}
+
+void PythonQt::clearImporterDirectoryCache()
+{
+  PythonQtImport::clearDirectoryCache();
+}
+
+bool PythonQt::installAsyncioEventLoop()
+{
+#ifdef PYTHONQT_SUPPORTS_ASYNCIO
+  if (_p->_asyncioEventLoopModule) {
+    return true;
+  }
+  PYTHONQT_GIL_SCOPE
+  PythonQtObjectPtr module = createModuleFromScript(QString(_p->_pythonQtModuleName) + ".eventloop", PythonQtEventLoopHelper::moduleSource());
+  if (!module) {
+    handleError();
+    return false;
+  }
+  _p->_eventLoopHelper = new PythonQtEventLoopHelper;
+  module.addObject("_helper", _p->_eventLoopHelper);
+  PythonQtObjectPtr loop;
+  loop.setNewRef(PyObject_CallMethod(module, const_cast<char*>("install"), NULL));
+  if (!loop) {
+    handleError();
+    delete _p->_eventLoopHelper;
+    _p->_eventLoopHelper = NULL;
+    return false;
+  }
+  // AddObject steals the reference, so increment it!
+  Py_INCREF(module.object());
+  PyModule_AddObject(_p->_pythonQtModule, "eventloop", module);
+  _p->_asyncioEventLoopModule = module;
+  return true;
+#else
+  std::cerr << "PythonQt::installAsyncioEventLoop - the asyncio event loop requires Python 3.7 or later" << std::endl;
+  return false;
+#endif
+}
+
+void PythonQt::setImporterBytecodeCacheDirectory(const QString& directory)
+{
+  PythonQtImport::setBytecodeCacheDirectory(directory);
+}
+
+QString PythonQt::importerBytecodeCacheDirectory()
+{
+  return PythonQtImport::bytecodeCacheDirectory();
+}
+
 void PythonQt::addWrapperFactory(PythonQtCppWrapperFactory* factory)
 {
   _p->_cppWrapperFactories.append(factory);
@@ -1310,6 +1589,9 @@ PythonQtPrivate::PythonQtPrivate()
   _wrappedCB = NULL;
   _currentClassInfoForClassWrapperCreation = NULL;
   _profilingCB = NULL;
+  _stdOutFlushTimer = NULL;
+  _eventLoopHelper = NULL;
+  _lazyClassRegistration = false;
   _hadError = false;
   _systemExitExceptionHandlerEnabled = false;
 }
@@ -1347,6 +1629,23 @@ PythonQtClassInfo* PythonQtPrivate::currentClassInfoForClassWrapperCreation()
   return info;
 }
 
+void PythonQtPrivate::registerDirectCalls(const QMetaObject* meta, const PythonQtDirectCallEntry* entries)
+{
+  QHash<QByteArray, PythonQtDirectCallCB*>& calls = _directCalls[meta];
+  for (const PythonQtDirectCallEntry* entry = entries; entry->signature; entry++) {
+    calls.insert(QMetaObject::normalizedSignature(entry->signature), entry->call);
+  }
+}
+
+PythonQtDirectCallCB* PythonQtPrivate::directCall(const QMetaObject* meta, const QByteArray& signature) const
+{
+  QHash<const QMetaObject*, QHash<QByteArray, PythonQtDirectCallCB*> >::const_iterator it = _directCalls.constFind(meta);
+  if (it == _directCalls.constEnd()) {
+    return NULL;
+  }
+  return it.value().value(signature);
+}
+
 void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
 {
   o->setParent(this);
@@ -1364,6 +1663,7 @@ void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
           nameOfClass.replace("__", "::");
           PythonQtClassInfo* classInfo = lookupClassInfoAndCreateIfNotPresent(nameOfClass);
           PythonQtSlotInfo* newSlot = new PythonQtSlotInfo(NULL, m, i, o, PythonQtSlotInfo::ClassDecorator);
+          newSlot->setDirectCall(directCall(o->metaObject(), PythonQtUtils::signature(m)));
           classInfo->addConstructor(newSlot);
         }
       } else if (signature.startsWith("delete_")) {
@@ -1379,6 +1679,7 @@ void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
         nameOfClass = nameOfClass.mid(0, nameOfClass.indexOf('_'));
         PythonQtClassInfo* classInfo = lookupClassInfoAndCreateIfNotPresent(nameOfClass);
         PythonQtSlotInfo* newSlot = new PythonQtSlotInfo(NULL, m, i, o, PythonQtSlotInfo::ClassDecorator);
+        newSlot->setDirectCall(directCall(o->metaObject(), PythonQtUtils::signature(m)));
         classInfo->addDecoratorSlot(newSlot);
       } else if (signature.startsWith("doc_")) {
         if ((decoTypes & DocstringDecorator) == 0) continue;
@@ -1410,6 +1711,7 @@ void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
           if (p.pointerCount==1) {
             PythonQtClassInfo* classInfo = lookupClassInfoAndCreateIfNotPresent(p.name);
             PythonQtSlotInfo* newSlot = new PythonQtSlotInfo(NULL, m, i, o, PythonQtSlotInfo::InstanceDecorator);
+            newSlot->setDirectCall(directCall(o->metaObject(), PythonQtUtils::signature(m)));
             classInfo->addDecoratorSlot(newSlot);
           }
         }
@@ -1591,6 +1893,54 @@ void PythonQt::stdErrRedirectCB(const QString& str)
   Q_EMIT PythonQt::self()->pythonStdErr(str);
 }
 
+void PythonQt::setRedirectStdOutBuffering(int bufferSize, int flushThreshold, int flushInterval)
+{
+  {
+    PYTHONQT_GIL_SCOPE
+    if (_p->_stdOutRedirect) {
+      PythonQtStdOutRedirect_setBuffering((PythonQtStdOutRedirect*)_p->_stdOutRedirect.object(), bufferSize, flushThreshold);
+    }
+    if (_p->_stdErrRedirect) {
+      PythonQtStdOutRedirect_setBuffering((PythonQtStdOutRedirect*)_p->_stdErrRedirect.object(), bufferSize, flushThreshold);
+    }
+  }
+  if (bufferSize > 0 && flushInterval > 0) {
+    if (!_p->_stdOutFlushTimer) {
+      _p->_stdOutFlushTimer = new QTimer(this);
+      connect(_p->_stdOutFlushTimer, SIGNAL(timeout()), this, SLOT(flushStdOut()));
+    }
+    _p->_stdOutFlushTimer->start(flushInterval);
+  } else if (_p->_stdOutFlushTimer) {
+    _p->_stdOutFlushTimer->stop();
+  }
+}
+
+void PythonQt::flushStdOut()
+{
+  PYTHONQT_GIL_SCOPE
+  if (_p->_stdOutRedirect) {
+    PythonQtStdOutRedirect_flushBuffer((PythonQtStdOutRedirect*)_p->_stdOutRedirect.object(), false);
+  }
+  if (_p->_stdErrRedirect) {
+    PythonQtStdOutRedirect_flushBuffer((PythonQtStdOutRedirect*)_p->_stdErrRedirect.object(), false);
+  }
+}
+
+qint64 PythonQt::droppedStdOutBytes()
+{
+  qint64 dropped = 0;
+  PythonQtStdOutRedirect* redirects[] = {
+    (PythonQtStdOutRedirect*)_p->_stdOutRedirect.object(),
+    (PythonQtStdOutRedirect*)_p->_stdErrRedirect.object()
+  };
+  for (int i = 0; i < 2; i++) {
+    if (redirects[i] && redirects[i]->_buffer) {
+      dropped += redirects[i]->_buffer->totalDroppedBytes();
+    }
+  }
+  return dropped;
+}
+
 void PythonQt::setQObjectWrappedCallback(PythonQtQObjectWrappedCB* cb)
 {
   _p->_wrappedCB = cb;
@@ -1606,8 +1956,103 @@ void PythonQt::setProfilingCallback(ProfilingCB* cb)
   _p->_profilingCB = cb;
 }
 
+void PythonQt::setCodeCacheSize(int maxEntries)
+{
+  PYTHONQT_GIL_SCOPE
+  _p->_codeCache.setMaxEntries(maxEntries);
+}
+
+int PythonQt::codeCacheSize() const
+{
+  return _p->_codeCache.maxEntries();
+}
+
+int PythonQt::codeCacheHits() const
+{
+  return _p->_codeCache.hits();
+}
+
+int PythonQt::codeCacheMisses() const
+{
+  return _p->_codeCache.misses();
+}
+
+void PythonQt::purgeCodeCache()
+{
+  PYTHONQT_GIL_SCOPE
+  _p->_codeCache.clear();
+}
+
+void PythonQt::setProfilingEnabled(bool enabled)
+{
+  PythonQtProfiler::setEnabled(enabled);
+}
+
+bool PythonQt::profilingEnabled() const
+{
+  return PythonQtProfiler::isEnabled();
+}
+
+QList<PythonQtProfilerStats> PythonQt::profilerStats() const
+{
+  PYTHONQT_GIL_SCOPE
+  return PythonQtProfiler::stats();
+}
+
+void PythonQt::resetProfilerStats()
+{
+  PYTHONQT_GIL_SCOPE
+  PythonQtProfiler::reset();
+}
+
+static PyObject* PythonQt_profilerStats(PyObject* /*self*/, PyObject* /*args*/)
+{
+  QList<PythonQtProfilerStats> stats = PythonQtProfiler::stats();
+  PyObject* result = PyList_New(stats.size());
+  for (int i = 0; i < stats.size(); i++) {
+    const PythonQtProfilerStats& s = stats.at(i);
+    PyObject* dict = PyDict_New();
+    PyObject* value = PyString_FromString(s.name.constData());
+    PyDict_SetItemString(dict, "name", value);
+    Py_DECREF(value);
+    qint64 values[] = { s.calls, s.totalTime, s.maxTime, s.conversionTime, s.cppTime, s.overloadRetries };
+    const char* names[] = { "calls", "totalTime", "maxTime", "conversionTime", "cppTime", "overloadRetries" };
+    for (int j = 0; j < 6; j++) {
+      value = PyLong_FromLongLong(values[j]);
+      PyDict_SetItemString(dict, names[j], value);
+      Py_DECREF(value);
+    }
+    PyList_SET_ITEM(result, i, dict);
+  }
+  return result;
+}
+
+static PyObject* PythonQt_resetProfilerStats(PyObject* /*self*/, PyObject* /*args*/)
+{
+  PythonQtProfiler::reset();
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+static PyObject* PythonQt_setProfilingEnabled(PyObject* /*self*/, PyObject* args)
+{
+  PyObject* enabled = NULL;
+  if (!PyArg_ParseTuple(args, "O:setProfilingEnabled", &enabled)) {
+    return NULL;
+  }
+  PythonQtProfiler::setEnabled(PyObject_IsTrue(enabled) == 1);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
 
 static PyMethodDef PythonQtMethods[] = {
+  {"profilerStats", (PyCFunction)PythonQt_profilerStats, METH_NOARGS,
+  "returns a list of dicts with the statistics of the built-in profiler (times are in nanoseconds)"},
+  {"resetProfilerStats", (PyCFunction)PythonQt_resetProfilerStats, METH_NOARGS,
+  "resets the statistics of the built-in profiler"},
+  {"setProfilingEnabled", (PyCFunction)PythonQt_setProfilingEnabled, METH_VARARGS,
+  "enable/disable the built-in profiler"},
   {NULL, NULL, 0, NULL}
 };
 
@@ -1651,6 +2096,8 @@ void PythonQt::initPythonQtModule(bool redirectStdOut, const QByteArray& pythonQ
     ((PythonQtStdOutRedirect*)out.object())->_cb = stdOutRedirectCB;
     err = PythonQtStdOutRedirectType.tp_new(&PythonQtStdOutRedirectType,NULL, NULL);
     ((PythonQtStdOutRedirect*)err.object())->_cb = stdErrRedirectCB;
+    _p->_stdOutRedirect = out;
+    _p->_stdErrRedirect = err;
     // replace the built in file objects with our own objects
     PyModule_AddObject(sys, "stdout", out);
     PyModule_AddObject(sys, "stderr", err);
@@ -1799,15 +2246,15 @@ PythonQtClassInfo* PythonQtPrivate::lookupClassInfoAndCreateIfNotPresent(const c
   return info;
 }
 
-void PythonQt::addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb)
+void PythonQt::addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb, PythonQtPolymorphicDiscriminatorCB* discriminator)
 {
-  _p->addPolymorphicHandler(typeName, cb);
+  _p->addPolymorphicHandler(typeName, cb, discriminator);
 }
 
-void PythonQtPrivate::addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb)
+void PythonQtPrivate::addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb, PythonQtPolymorphicDiscriminatorCB* discriminator)
 {
   PythonQtClassInfo* info = lookupClassInfoAndCreateIfNotPresent(typeName);
-  info->addPolymorphicHandler(cb);
+  info->addPolymorphicHandler(cb, discriminator);
 }
 
 bool PythonQt::addParentClass(const char* typeName, const char* parentTypeName, int upcastingOffset)
@@ -1830,7 +2277,7 @@ bool PythonQtPrivate::addParentClass(const char* typeName, const char* parentTyp
 void PythonQtPrivate::registerCPPClass(const char* typeName, const char* parentTypeName, const char* package, PythonQtQObjectCreatorFunctionCB* wrapperCreator,  PythonQtShellSetInstanceWrapperCB* shell, PyObject* module, int typeSlots)
 {
   PythonQtClassInfo* info = lookupClassInfoAndCreateIfNotPresent(typeName);
-  if (!info->pythonQtClassWrapper()) {
+  if (!info->hasPythonQtClassWrapper()) {
     info->setTypeSlots(typeSlots);
     info->setupCPPObject(typeName);
     createPythonQtClassWrapper(info, package, module);
@@ -1862,6 +2309,109 @@ PyObject* PythonQtPrivate::packageByName(const char* name)
   return v;
 }
 
+#if defined(PY3K) && PY_VERSION_HEX >= 0x03070000
+// module level __getattr__ and __dir__ (PEP 562) are needed to create lazily registered class wrappers on first access
+#define PYTHONQT_SUPPORTS_LAZY_CLASS_REGISTRATION
+#endif
+
+#ifdef PYTHONQT_SUPPORTS_LAZY_CLASS_REGISTRATION
+static PyObject* PythonQt_pendingClassWrapperGetAttr(PyObject* module, PyObject* name)
+{
+  return PythonQt::priv()->getPendingClassWrapperAttribute(module, name);
+}
+
+static PyObject* PythonQt_pendingClassWrapperDir(PyObject* module, PyObject* /*args*/)
+{
+  PythonQt::priv()->createPendingClassWrappers(module);
+  return PyDict_Keys(PyModule_GetDict(module));
+}
+
+static PyMethodDef PythonQt_pendingClassWrapperGetAttrDef = {
+  "__getattr__", (PyCFunction)PythonQt_pendingClassWrapperGetAttr, METH_O, "Creates lazily registered PythonQt classes on first access"
+};
+
+static PyMethodDef PythonQt_pendingClassWrapperDirDef = {
+  "__dir__", (PyCFunction)PythonQt_pendingClassWrapperDir, METH_NOARGS, "Creates all lazily registered PythonQt classes and lists the module content"
+};
+#endif
+
+void PythonQt::setLazyClassRegistrationEnabled(bool enabled)
+{
+#ifdef PYTHONQT_SUPPORTS_LAZY_CLASS_REGISTRATION
+  _p->_lazyClassRegistration = enabled;
+#else
+  Q_UNUSED(enabled);
+#endif
+}
+
+bool PythonQt::lazyClassRegistrationEnabled() const
+{
+  return _p->_lazyClassRegistration;
+}
+
+void PythonQtPrivate::addPendingClassWrapper(PyObject* pack, PythonQtClassInfo* info)
+{
+#ifdef PYTHONQT_SUPPORTS_LAZY_CLASS_REGISTRATION
+  PyObject* dict = PyModule_GetDict(pack);
+  if (!PyDict_GetItemString(dict, "__getattr__")) {
+    // the functions get the module as self argument
+    PyObject* getAttr = PyCFunction_New(&PythonQt_pendingClassWrapperGetAttrDef, pack);
+    PyDict_SetItemString(dict, "__getattr__", getAttr);
+    Py_DECREF(getAttr);
+    PyObject* dir = PyCFunction_New(&PythonQt_pendingClassWrapperDirDef, pack);
+    PyDict_SetItemString(dict, "__dir__", dir);
+    Py_DECREF(dir);
+  }
+#endif
+  _pendingClassWrappersByModule[pack].insert(info->className(), info);
+}
+
+void PythonQtPrivate::createPendingClassWrapper(PythonQtClassInfo* info)
+{
+  info->setPythonQtClassWrapperPending(false);
+  QHash<PythonQtClassInfo*, PendingClassWrapper>::iterator it = _pendingClassWrappers.find(info);
+  if (it == _pendingClassWrappers.end()) {
+    return;
+  }
+  PendingClassWrapper pending = it.value();
+  _pendingClassWrappers.erase(it);
+  Q_FOREACH(PyObject* package, pending.packages) {
+    _pendingClassWrappersByModule[package].remove(info->className());
+  }
+  createPythonQtClassWrapperInPackages(info, pending.parentModule, pending.packages);
+}
+
+void PythonQtPrivate::createPendingClassWrappers(PyObject* module)
+{
+  // take a copy, since creating the wrappers modifies the hash
+  QList<PythonQtClassInfo*> infos = _pendingClassWrappersByModule.value(module).values();
+  Q_FOREACH(PythonQtClassInfo* info, infos) {
+    info->pythonQtClassWrapper();
+  }
+}
+
+PyObject* PythonQtPrivate::getPendingClassWrapperAttribute(PyObject* module, PyObject* name)
+{
+  const char* attributeName = PyUnicode_AsUTF8(name);
+  if (!attributeName) {
+    return NULL;
+  }
+  if (qstrcmp(attributeName, "__all__")==0) {
+    // "from module import *" asks for __all__ first and falls back to the module dict,
+    // so create all pending wrappers to make them part of the dict
+    createPendingClassWrappers(module);
+  } else {
+    PythonQtClassInfo* info = _pendingClassWrappersByModule.value(module).value(attributeName);
+    if (info) {
+      PyObject* classWrapper = info->pythonQtClassWrapper();
+      Py_XINCREF(classWrapper);
+      return classWrapper;
+    }
+  }
+  PyErr_Format(PyExc_AttributeError, "module '%s' has no attribute '%s'", PyModule_GetName(module), attributeName);
+  return NULL;
+}
+
 void PythonQtPrivate::handleVirtualOverloadReturnError(const char* signature, const PythonQtMethodInfo* methodInfo, PyObject* result)
 {
   QString error = "Return value '" + PythonQtConv::PyObjGetString(result) + "' can not be converted to expected C++ type '" + methodInfo->parameters().at(0).name + "' as return value of virtual method " + signature;
@@ -2138,6 +2688,7 @@ QString PythonQtPrivate::getSignature(PyObject* object)
 
 void PythonQtPrivate::shellClassDeleted( void* shellClass )
 {
+  PYTHONQT_GIL_SCOPE
   PythonQtInstanceWrapper* wrap = _wrappedObjects.value(shellClass);
   if (wrap && wrap->_wrappedPtr) {
     // this is a pure C++ wrapper and the shell has gone, so we need
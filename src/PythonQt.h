@@ -49,6 +49,10 @@
 #include "PythonQtSlot.h"
 #include "PythonQtObjectPtr.h"
 #include "PythonQtStdIn.h"
+#include "PythonQtThreadSupport.h"
+#include "PythonQtProfiler.h"
+#include "PythonQtCodeCache.h"
+#include "PythonQtMethodInfo.h"
 #include <QObject>
 #include <QVariant>
 #include <QList>
@@ -67,10 +71,14 @@ class PythonQtImportFileInterface;
 class PythonQtCppWrapperFactory;
 class PythonQtForeignWrapperFactory;
 class PythonQtQFileImporter;
+class PythonQtEventLoopHelper;
+class QTimer;
 
 typedef void  PythonQtQObjectWrappedCB(QObject* object);
 typedef void  PythonQtQObjectNoLongerWrappedCB(QObject* object);
 typedef void* PythonQtPolymorphicHandlerCB(const void *ptr, const char **class_name);
+//! returns the value that a polymorphic handler decides on (e.g. QEvent::type()), see PythonQt::addPolymorphicHandler()
+typedef int   PythonQtPolymorphicDiscriminatorCB(const void *ptr);
 
 typedef void PythonQtShellSetInstanceWrapperCB(void* object, PythonQtInstanceWrapper* wrapper);
 
@@ -110,7 +118,9 @@ public:
     RedirectStdOut = 1,   //!<< sets if the std out/err is redirected to pythonStdOut() and pythonStdErr() signals
     IgnoreSiteModule = 2, //!<< sets if Python should ignore the site module
     ExternalHelp = 4,     //!<< sets if help() calls on PythonQt modules are forwarded to the pythonHelpRequest() signal
-    PythonAlreadyInitialized = 8 //!<< sets that PythonQt should not can PyInitialize, since it is already done
+    PythonAlreadyInitialized = 8, //!<< sets that PythonQt should not can PyInitialize, since it is already done
+    ThreadSupport = 16,   //!<< sets that PythonQt releases the GIL while calling C++ slots/properties and acquires it when calling into Python (see PythonQtThreadSupport.h)
+    LazyClassRegistration = 32 //!<< sets that the Python class wrappers of registered classes are created on first use (see setLazyClassRegistrationEnabled())
   };
 
   //! flags that tell PythonQt which operators to expect on the registered type
@@ -274,8 +284,20 @@ public:
   //! Returns false if the typeName was not yet registered.
   bool addParentClass(const char* typeName, const char* parentTypeName, int upcastingOffset=0);
 
-  //! add a handler for polymorphic downcasting
-  void addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb);
+  //! add a handler for polymorphic downcasting.
+  //! If the result of the handler only depends on the value returned by \c discriminator (e.g. a switch on
+  //! QEvent::type()), the discriminator can be passed as well. When all handlers of a class have one (which must
+  //! return the same values), the downcast results are cached per value and the handlers only run once per value.
+  void addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb, PythonQtPolymorphicDiscriminatorCB* discriminator = NULL);
+
+  //! enable/disable the lazy registration of classes. When enabled, registerClass() and registerCPPClass()
+  //! (and the generated Qt bindings) only record the class, the Python class wrapper is created
+  //! on first attribute access of the package module or when the first instance is wrapped.
+  //! This requires module level __getattr__ (Python 3.7 or newer), the setting is ignored on older Python versions.
+  void setLazyClassRegistrationEnabled(bool enabled);
+
+  //! returns if the lazy registration of classes is enabled
+  bool lazyClassRegistrationEnabled() const;
 
   //@}
 
@@ -290,12 +312,30 @@ public:
   //! If pycode is NULL, a python error is printed.
   QVariant evalCode(PyObject* object, PyObject* pycode);
 
-  //! evaluates the given script code and returns the result value
+  //! evaluates the given script code and returns the result value.
+  //! The compiled code is kept in a LRU cache, so evaluating the same script again does not compile it again
+  //! (see setCodeCacheSize()).
   QVariant evalScript(PyObject* object, const QString& script, int start = Py_file_input);
 
   //! evaluates the given script code from file
   void evalFile(PyObject* object, const QString& filename);
 
+  //! sets the maximum number of compiled scripts that evalScript() keeps in its LRU cache (default is 128),
+  //! the same number of dotted names is cached for lookupObject()/call(). 0 disables the cache.
+  void setCodeCacheSize(int maxEntries);
+
+  //! returns the maximum number of compiled scripts that are cached
+  int codeCacheSize() const;
+
+  //! returns how often evalScript() found the compiled script in the cache
+  int codeCacheHits() const;
+
+  //! returns how often evalScript() had to compile the script
+  int codeCacheMisses() const;
+
+  //! removes all compiled scripts and dotted names from the cache and resets the hit/miss statistics
+  void purgeCodeCache();
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -332,6 +372,15 @@ public:
   //! get the variable with the \c name of the \c object, returns an invalid QVariant on error
   QVariant getVariable(PyObject* object, const QString& name);
 
+  //! reads the given properties of the \c object in one pass, all readable properties if \c names is empty
+  //! (the same as obj.getProperties() in Python). Unknown properties are missing in the result.
+  QVariantMap getProperties(QObject* object, const QStringList& names = QStringList());
+
+  //! writes all given properties of the \c object in one pass (the same as obj.setProperties() in Python).
+  //! Nothing is written if a property is unknown, read-only or its value can not be converted to the property type.
+  //! Errors are reported as a Python AttributeError via handleError() and false is returned.
+  bool setProperties(QObject* object, const QVariantMap& values);
+
   //! read vars etc. in scope of an \c object, optional looking inside of an object \c objectname
   QStringList introspection(PyObject* object, const QString& objectname, ObjectType type);
   //! read vars etc. in scope of the given \c object
@@ -462,6 +511,28 @@ public:
   //! get paths that the importer should ignore
   const QStringList& getImporterIgnorePaths();
 
+  //! enable/disable caching of directory listings in the importer. If enabled and the import interface supports it
+  //! (see PythonQtImportFileInterface::supportsDirectoryListing()), each directory on the path is listed once and
+  //! module lookups are answered from memory. A cached listing is refreshed when the modification date of its directory changes.
+  //! (disabled by default)
+  void setImporterDirectoryCacheEnabled(bool enabled);
+
+  //! returns if the importer caches directory listings
+  bool importerDirectoryCacheEnabled();
+
+  //! clears the cached directory listings of the importer, call this if files were added or removed
+  //! in a way that does not change the modification date of their directories
+  void clearImporterDirectoryCache();
+
+  //! sets a directory in which the importer stores the compiled code of all imported source files
+  //! (an empty string disables the cache, which is the default). Unlike the *.pyc files that are written next to
+  //! the sources, this also works for modules in Qt resources and in read-only directories.
+  //! A cached module is only used if the hash of its source is unchanged.
+  void setImporterBytecodeCacheDirectory(const QString& directory);
+
+  //! returns the directory of the importer's bytecode cache
+  QString importerBytecodeCacheDirectory();
+
   //! get access to the file importer (if set)
   static PythonQtImportFileInterface* importInterface();
 
@@ -515,8 +586,47 @@ public:
   //! sets a callback that is called before and after function calls for profiling
   void setProfilingCallback(ProfilingCB* cb);
 
+  //! enable/disable the built-in profiler, which collects call counts and times of all slot calls and
+  //! property accesses (see PythonQtProfilerStats). It is cheap enough to be left enabled.
+  //! The statistics are also available in Python via PythonQt.profilerStats(), PythonQt.resetProfilerStats()
+  //! and PythonQt.setProfilingEnabled()
+  void setProfilingEnabled(bool enabled);
+
+  //! returns if the built-in profiler is enabled
+  bool profilingEnabled() const;
+
+  //! returns the statistics of all slots and properties that were called while the profiler was enabled
+  QList<PythonQtProfilerStats> profilerStats() const;
+
+  //! resets all statistics of the built-in profiler
+  void resetProfilerStats();
+
+  //! enables buffering of the stdout/stderr redirection (see RedirectStdOut). The output of each stream is collected
+  //! in a ring buffer of \c bufferSize bytes and emitted via pythonStdOut()/pythonStdErr() when a line is complete,
+  //! when \c flushThreshold bytes are buffered, when flush() is called on sys.stdout/sys.stderr, when flushStdOut()
+  //! is called or every \c flushInterval milliseconds (0 disables the timer).
+  //! A single write that is larger than the buffer is emitted unbuffered after the buffered output. Output that is
+  //! written while the buffered output is emitted (e.g. by a slot connected to pythonStdOut()) and does not fit
+  //! into the buffer is dropped, see droppedStdOutBytes().
+  //! Passing a \c bufferSize of 0 disables the buffering.
+  void setRedirectStdOutBuffering(int bufferSize, int flushThreshold = 4096, int flushInterval = 100);
+
+  //! returns the number of stdout/stderr bytes that were dropped because the buffers were full
+  qint64 droppedStdOutBytes();
+
+  //! creates the module PythonQt.eventloop and installs its QtEventLoop as the current asyncio event loop.
+  //! The loop dispatches its callbacks, timers and socket events from the Qt event loop, so coroutines run
+  //! while the application is in its Qt main loop, without a separate thread or a polling timer.
+  //! Once it is installed, the signals of wrapped objects can be awaited (e.g. \c "args = await obj.finished").
+  //! Returns false if asyncio is not available (it requires Python 3.7 or later).
+  bool installAsyncioEventLoop();
+
   //@}
 
+public Q_SLOTS:
+  //! emits all buffered stdout/stderr output, see setRedirectStdOutBuffering()
+  void flushStdOut();
+
 Q_SIGNALS:
   //! emitted when python outputs something to stdout (and redirection is turned on)
   void pythonStdOut(const QString& str);
@@ -594,8 +704,8 @@ public:
   //! add parent class relation
   bool addParentClass(const char* typeName, const char* parentTypeName, int upcastingOffset);
 
-  //! add a handler for polymorphic downcasting
-  void addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb);
+  //! add a handler for polymorphic downcasting (see PythonQt::addPolymorphicHandler())
+  void addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb, PythonQtPolymorphicDiscriminatorCB* discriminator = NULL);
 
   //! lookup existing classinfo and return new if not yet present
   PythonQtClassInfo* lookupClassInfoAndCreateIfNotPresent(const char* typeName);
@@ -634,6 +744,13 @@ public:
   //! and it will register the classes when it first sees a pointer to such a derived class
   void registerQObjectClassNames(const QStringList& names);
 
+  //! register the direct calls of the slots of the given wrapper/decorator meta object (generated by the
+  //! generator with --direct-calls), the table is terminated by an entry with a NULL signature and is not copied
+  void registerDirectCalls(const QMetaObject* meta, const PythonQtDirectCallEntry* entries);
+
+  //! returns the direct call for the slot with the given signature of the wrapper/decorator meta object (or NULL)
+  PythonQtDirectCallCB* directCall(const QMetaObject* meta, const QByteArray& signature) const;
+
   //! add a decorator object
   void addDecorators(QObject* o, int decoTypes);
 
@@ -649,12 +766,19 @@ public:
   //! helper method that creates a PythonQtInstanceWrapper object and registers it in the object map
   PythonQtInstanceWrapper* createNewPythonQtInstanceWrapper(QObject* obj, PythonQtClassInfo* info, void* wrappedPtr = NULL);
 
+  //! creates a wrapper that holds a copy of the given value type object in its inline storage, which avoids
+  //! the heap allocation of the copy. Returns NULL if the type is too large or can't be copied that way (new reference)
+  PyObject* createInlineCopyFromMetaType(int type, const void* data);
+
   //! get the class info for a meta object (if available)
   PythonQtClassInfo* getClassInfo(const QMetaObject* meta) { return _knownClassInfos.value(meta->className()); }
 
   //! get the class info for a meta object (if available)
   PythonQtClassInfo* getClassInfo(const QByteArray& className) { return _knownClassInfos.value(className); }
 
+  //! returns if the class name was registered with registerQObjectClassNames()
+  bool isKnownQObjectClassName(const QByteArray& className) const { return _knownQObjectClassNames.contains(className); }
+
   //! creates the new module from the given pycode
   PythonQtObjectPtr createModule(const QString& name, PyObject* pycode);
 
@@ -670,6 +794,9 @@ public:
   //! get access to the PythonQt module
   PythonQtObjectPtr pythonQtModule() const { return _pythonQtModule; }
 
+  //! returns the PythonQt.eventloop module, which is NULL until PythonQt::installAsyncioEventLoop() was called
+  PythonQtObjectPtr asyncioEventLoopModule() const { return _asyncioEventLoopModule; }
+
   //! returns the profiling callback, which may be NULL
   PythonQt::ProfilingCB* profilingCB() const { return _profilingCB; }
   
@@ -679,13 +806,28 @@ public:
   //! returns true if the object is a method descriptor (same as inspect.ismethoddescriptor() in inspect.py)
   bool isMethodDescriptor(PyObject* object) const;
 
+  //! creates the class wrapper of a lazily registered class (called by PythonQtClassInfo::pythonQtClassWrapper())
+  void createPendingClassWrapper(PythonQtClassInfo* info);
+
+  //! creates all pending class wrappers of the given package module
+  void createPendingClassWrappers(PyObject* module);
+
+  //! module level __getattr__ of package modules that contain lazily registered classes (returns a new reference)
+  PyObject* getPendingClassWrapperAttribute(PyObject* module, PyObject* name);
+
 private:
   //! Setup the shared library suffixes by getting them from the "imp" module.
   void setupSharedLibrarySuffixes();
 
-  //! create a new pythonqt class wrapper and place it in the pythonqt module
+  //! create a new pythonqt class wrapper and place it in the pythonqt module (or record it as pending if lazy registration is enabled)
   void createPythonQtClassWrapper(PythonQtClassInfo* info, const char* package, PyObject* module = NULL);
 
+  //! create the pythonqt class wrapper (with the __module__ of parentModule) and place it in the given package modules
+  void createPythonQtClassWrapperInPackages(PythonQtClassInfo* info, PyObject* parentModule, const QList<PyObject*>& packages);
+
+  //! record the lazily registered class in the given package module and install the module level __getattr__
+  void addPendingClassWrapper(PyObject* pack, PythonQtClassInfo* info);
+
   //! get/create new package module (the returned object is a borrowed reference)
   PyObject* packageByName(const char* name);
 
@@ -716,6 +858,17 @@ private:
   //! the default importer
   PythonQtQFileImporter* _defaultImporter;
 
+  //! the stdout/stderr redirection objects (if RedirectStdOut is set)
+  PythonQtObjectPtr _stdOutRedirect;
+  PythonQtObjectPtr _stdErrRedirect;
+
+  //! the timer that flushes the buffered stdout/stderr output
+  QTimer* _stdOutFlushTimer;
+
+  //! the PythonQt.eventloop module and the helper that drives its asyncio event loop
+  PythonQtObjectPtr _asyncioEventLoopModule;
+  PythonQtEventLoopHelper* _eventLoopHelper;
+
   PythonQtQObjectNoLongerWrappedCB* _noLongerWrappedCB;
   PythonQtQObjectWrappedCB* _wrappedCB;
 
@@ -729,6 +882,23 @@ private:
 
   QHash<QByteArray, PyObject*> _packages;
 
+  //! the registered direct calls per wrapper meta object, by normalized slot signature
+  QHash<const QMetaObject*, QHash<QByteArray, PythonQtDirectCallCB*> > _directCalls;
+
+  //! where a lazily registered class wrapper is placed once it is created
+  struct PendingClassWrapper {
+    PyObject* parentModule;
+    QList<PyObject*> packages;
+  };
+  QHash<PythonQtClassInfo*, PendingClassWrapper> _pendingClassWrappers;
+  //! the lazily registered classes by name, per package module
+  QHash<PyObject*, QHash<QByteArray, PythonQtClassInfo*> > _pendingClassWrappersByModule;
+
+  bool _lazyClassRegistration;
+
+  //! the compiled scripts of evalScript() and the dotted names of lookupObject()
+  PythonQtCodeCache _codeCache;
+
   PythonQtClassInfo* _currentClassInfoForClassWrapperCreation;
 
   PythonQt::ProfilingCB* _profilingCB;
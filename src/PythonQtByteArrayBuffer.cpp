@@ -0,0 +1,108 @@
+/*
+*
+*  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  Further, this software is distributed without any warranty that it is
+*  free of the rightful claim of any third person regarding infringement
+*  or the like.  Any license provided herein, whether implied or
+*  otherwise, applies only to this software file.  Patent licenses, if
+*  any, provided herein do not apply to combinations of this program with
+*  other software, or any other product whatsoever.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*
+*  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+*  28359 Bremen, Germany or:
+*
+*  http://www.mevis.de
+*
+*/
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtByteArrayBuffer.cpp
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtByteArrayBuffer.h"
+
+static void PythonQtByteArrayBuffer_dealloc(PythonQtByteArrayBufferObject* self)
+{
+  delete self->_bytes;
+  self->_bytes = NULL;
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static int PythonQtByteArrayBuffer_getbuffer(PythonQtByteArrayBufferObject* self, Py_buffer* view, int flags)
+{
+  // the data is exported read-only, so that it is never modified behind the back of the QByteArray
+  return PyBuffer_FillInfo(view, (PyObject*)self, (void*)self->_bytes->constData(), self->_bytes->size(), 1, flags);
+}
+
+static PyBufferProcs PythonQtByteArrayBuffer_as_buffer = {
+#ifndef PY3K
+  0,      /* bf_getreadbuffer */
+  0,      /* bf_getwritebuffer */
+  0,      /* bf_getsegcount */
+  0,      /* bf_getcharbuffer */
+#endif
+  (getbufferproc)PythonQtByteArrayBuffer_getbuffer,      /* bf_getbuffer */
+  0,      /* bf_releasebuffer */
+};
+
+PyTypeObject PythonQtByteArrayBuffer_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "ByteArrayBuffer",
+    sizeof(PythonQtByteArrayBufferObject),
+    0,
+    (destructor)PythonQtByteArrayBuffer_dealloc,     /* tp_dealloc */
+    0,          /* tp_print */
+    0,          /* tp_getattr */
+    0,          /* tp_setattr */
+    0,
+    0,          /* tp_repr */
+    0,          /* tp_as_number */
+    0,          /* tp_as_sequence */
+    0,          /* tp_as_mapping */
+    0,      /* tp_hash */
+    0,      /* tp_call */
+    0,          /* tp_str */
+    0,    /* tp_getattro */
+    0,          /* tp_setattro */
+    &PythonQtByteArrayBuffer_as_buffer,          /* tp_as_buffer */
+#ifdef PY3K
+    Py_TPFLAGS_DEFAULT,/* tp_flags */
+#else
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER,/* tp_flags */
+#endif
+    "Exports the data of a QByteArray via the buffer protocol",          /* tp_doc */
+};
+
+PyObject* PythonQtByteArrayBuffer_FromByteArray(const QByteArray& bytes)
+{
+  PythonQtByteArrayBufferObject* exporter = PyObject_New(PythonQtByteArrayBufferObject, &PythonQtByteArrayBuffer_Type);
+  if (!exporter) {
+    return NULL;
+  }
+  // shares the data with bytes
+  exporter->_bytes = new QByteArray(bytes);
+  PyObject* view = PyMemoryView_FromObject((PyObject*)exporter);
+  Py_DECREF(exporter);
+  return view;
+}
@@ -0,0 +1,66 @@
+#ifndef _PYTHONQTBYTEARRAYBUFFER_H
+#define _PYTHONQTBYTEARRAYBUFFER_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtByteArrayBuffer.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+
+#include "PythonQtSystem.h"
+
+#include <QByteArray>
+
+extern PYTHONQT_EXPORT PyTypeObject PythonQtByteArrayBuffer_Type;
+
+#define PythonQtByteArrayBuffer_Check(op) (Py_TYPE(op) == &PythonQtByteArrayBuffer_Type)
+
+//! defines a python object that exports the data of a QByteArray via the buffer protocol,
+//! the data is shared with the QByteArray (implicit sharing) and is exported read-only
+typedef struct {
+    PyObject_HEAD
+    QByteArray* _bytes;
+} PythonQtByteArrayBufferObject;
+
+//! returns a new read-only memoryview on the data of \c bytes, without copying the data
+PYTHONQT_EXPORT PyObject* PythonQtByteArrayBuffer_FromByteArray(const QByteArray& bytes);
+
+#endif
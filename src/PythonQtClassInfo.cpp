@@ -49,6 +49,8 @@
 
 QHash<QByteArray, int> PythonQtMethodInfo::_parameterTypeDict;
 
+int PythonQtClassInfo::_parentClassesGeneration = 1;
+
 PythonQtClassInfo::PythonQtClassInfo() {
   _meta = NULL;
   _constructors = NULL;
@@ -62,6 +64,11 @@ PythonQtClassInfo::PythonQtClassInfo() {
   _isQObject = false;
   _enumsCreated = false;
   _searchPolymorphicHandlerOnParent = true;
+  _polymorphicDiscriminator = NULL;
+  _pythonQtClassWrapperPending = false;
+  _cachedMembersGeneration = 1;
+  _indexedDecoratorSlots = 0;
+  _castOffsetsGeneration = 0;
 }
 
 PythonQtClassInfo::~PythonQtClassInfo()
@@ -79,6 +86,15 @@ PythonQtClassInfo::~PythonQtClassInfo()
   }
 }
 
+PyObject* PythonQtClassInfo::pythonQtClassWrapper()
+{
+  if (_pythonQtClassWrapperPending) {
+    // the class was registered lazily, create the wrapper on first use
+    PythonQt::priv()->createPendingClassWrapper(this);
+  }
+  return _pythonQtClassWrapper;
+}
+
 void PythonQtClassInfo::setupQObject(const QMetaObject* meta)
 {
   // _wrappedClassName is already set earlier in the class setup
@@ -98,6 +114,9 @@ void PythonQtClassInfo::setupCPPObject(const QByteArray& classname)
 
 void PythonQtClassInfo::clearCachedMembers()
 {
+  _cachedMembersGeneration++;
+  clearCachedMembersByName(false);
+
   QHashIterator<QByteArray, PythonQtMemberInfo> i(_cachedMembers);
   while (i.hasNext()) {
     PythonQtMemberInfo member = i.next().value();
@@ -162,45 +181,104 @@ PythonQtSlotInfo* PythonQtClassInfo::recursiveFindDecoratorSlotsFromDecoratorPro
   return inputInfo;
 }
 
+void PythonQtClassInfo::updateDecoratorMethodIndex(const QMetaObject* meta)
+{
+  if (_decoratorMethodIndex._meta == meta) {
+    return;
+  }
+  _decoratorMethodIndex._meta = meta;
+  _decoratorMethodIndex._methods.clear();
+  int numMethods = meta->methodCount();
+  int startFrom = QObject::staticMetaObject.methodCount();
+  for (int i = startFrom; i < numMethods; i++) {
+    QMetaMethod m = meta->method(i);
+    if ((m.methodType() == QMetaMethod::Method ||
+         m.methodType() == QMetaMethod::Slot) && m.access() == QMetaMethod::Public) {
+
+      QByteArray signature = PythonQtUtils::methodName(m);
+      bool isClassDeco = false;
+      if (signature.startsWith("static_")) {
+        // skip the static_classname_ part of the string
+        signature = signature.mid(7 + 1 + static_cast<int>(strlen(className())));
+        isClassDeco = true;
+      } else if (signature.startsWith("new_")) {
+        isClassDeco = true;
+      } else if (signature.startsWith("delete_")) {
+        isClassDeco = true;
+      }
+      // XXX no checking is currently done if the slots have correct first argument or not...
+      _decoratorMethodIndex._methods[signature].append(MethodIndexEntry(i, isClassDeco));
+    }
+  }
+}
+
+void PythonQtClassInfo::updateMetaMethodIndex()
+{
+  if (_metaMethodIndex._meta == _meta) {
+    return;
+  }
+  _metaMethodIndex._meta = _meta;
+  _metaMethodIndex._methods.clear();
+  if (!_meta) {
+    return;
+  }
+  int numMethods = _meta->methodCount();
+  // start from methodOffset, to only add slots which are located in this class,
+  // and not in the parent class, which is traversed recursively later on.
+  // (if the class in not a QObject, we are working with a script wrapper QObject
+  //  and need to read all slots/signals starting from 0).
+  int methodOffset = _isQObject?_meta->methodOffset():0;
+  for (int i = methodOffset; i < numMethods; i++) {
+    QMetaMethod m = _meta->method(i);
+    if (((m.methodType() == QMetaMethod::Method ||
+      m.methodType() == QMetaMethod::Slot) && m.access() == QMetaMethod::Public)
+      || m.methodType()==QMetaMethod::Signal) {
+      _metaMethodIndex._methods[PythonQtUtils::methodName(m)].append(MethodIndexEntry(i));
+    }
+  }
+}
+
+void PythonQtClassInfo::updateDecoratorSlotIndex()
+{
+  // decorator slots are only ever appended
+  if (_indexedDecoratorSlots == _decoratorSlots.size()) {
+    return;
+  }
+  _indexedDecoratorSlots = _decoratorSlots.size();
+  _decoratorSlotIndex.clear();
+  Q_FOREACH(PythonQtSlotInfo* info, _decoratorSlots) {
+    QByteArray signature = PythonQtUtils::methodName(*info->metaMethod());
+    if (signature.startsWith("static_")) {
+      int offset = signature.indexOf('_', 7);
+      signature = signature.mid(offset+1);
+    }
+    _decoratorSlotIndex[signature].append(info);
+  }
+}
+
 PythonQtSlotInfo* PythonQtClassInfo::findDecoratorSlotsFromDecoratorProvider(const char* memberName, PythonQtSlotInfo* tail, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset) {
+  QByteArray name(memberName);
   QObject* decoratorProvider = decorator();
   if (decoratorProvider) {
     //qDebug()<< "looking " << decoratorProvider->metaObject()->className() << " " << memberName << " " << upcastingOffset;
     const QMetaObject* meta = decoratorProvider->metaObject();
-    int numMethods = meta->methodCount();
-    int startFrom = QObject::staticMetaObject.methodCount();
-    for (int i = startFrom; i < numMethods; i++) {
-      QMetaMethod m = meta->method(i);
-      if ((m.methodType() == QMetaMethod::Method ||
-           m.methodType() == QMetaMethod::Slot) && m.access() == QMetaMethod::Public) {
-        
-        QByteArray signature = PythonQtUtils::methodName(m);
-        bool isClassDeco = false;
-        if (signature.startsWith("static_")) {
-          // skip the static_classname_ part of the string
-          signature = signature.mid(7 + 1 + static_cast<int>(strlen(className())));
-          isClassDeco = true;
-        } else if (signature.startsWith("new_")) {
-          isClassDeco = true;
-        } else if (signature.startsWith("delete_")) {
-          isClassDeco = true;
-        }
-        // XXX no checking is currently done if the slots have correct first argument or not...
-        
-        // check if same length and same name
-        if (signature == memberName) {
-          found = true;
-          PythonQtSlotInfo* info = new PythonQtSlotInfo(this, m, i, decoratorProvider, isClassDeco?PythonQtSlotInfo::ClassDecorator:PythonQtSlotInfo::InstanceDecorator);
-          info->setUpcastingOffset(upcastingOffset);
-          //qDebug()<< "adding " << decoratorProvider->metaObject()->className() << " " << memberName << " " << upcastingOffset;
-          if (tail) {
-            tail->setNextInfo(info);
-          } else {
-            PythonQtMemberInfo newInfo(info);
-            memberCache.insert(signature, newInfo);
-          }
-          tail = info;
+    updateDecoratorMethodIndex(meta);
+    QHash<QByteArray, QList<MethodIndexEntry> >::const_iterator it = _decoratorMethodIndex._methods.constFind(name);
+    if (it != _decoratorMethodIndex._methods.constEnd()) {
+      Q_FOREACH(const MethodIndexEntry& entry, it.value()) {
+        QMetaMethod m = meta->method(entry._index);
+        found = true;
+        PythonQtSlotInfo* info = new PythonQtSlotInfo(this, m, entry._index, decoratorProvider, entry._classDecorator?PythonQtSlotInfo::ClassDecorator:PythonQtSlotInfo::InstanceDecorator);
+        info->setUpcastingOffset(upcastingOffset);
+        info->setDirectCall(PythonQt::priv()->directCall(meta, PythonQtUtils::signature(m)));
+        //qDebug()<< "adding " << decoratorProvider->metaObject()->className() << " " << memberName << " " << upcastingOffset;
+        if (tail) {
+          tail->setNextInfo(info);
+        } else {
+          PythonQtMemberInfo newInfo(info);
+          memberCache.insert(name, newInfo);
         }
+        tail = info;
       }
     }
   }
@@ -209,32 +287,19 @@ PythonQtSlotInfo* PythonQtClassInfo::findDecoratorSlotsFromDecoratorProvider(con
 
   // now look for slots/signals/methods on this level of the meta object
   if (_meta) {
-    int numMethods = _meta->methodCount();
-    // start from methodOffset, to only add slots which are located in this class,
-    // and not in the parent class, which is traversed recursively later on.
-    // (if the class in not a QObject, we are working with a script wrapper QObject
-    //  and need to read all slots/signals starting from 0).
-    int methodOffset = _isQObject?_meta->methodOffset():0;
-    for (int i = methodOffset; i < numMethods; i++) {
-      QMetaMethod m = _meta->method(i);
-      if (((m.methodType() == QMetaMethod::Method ||
-        m.methodType() == QMetaMethod::Slot) && m.access() == QMetaMethod::Public)
-        || m.methodType()==QMetaMethod::Signal) {
-
-          QByteArray signature = PythonQtUtils::methodName(m);
-
-          // check if same length and same name
-          if (signature == memberName) {
-            found = true;
-            PythonQtSlotInfo* info = new PythonQtSlotInfo(this, m, i);
-            if (tail) {
-              tail->setNextInfo(info);
-            } else {
-              PythonQtMemberInfo newInfo(info);
-              memberCache.insert(signature, newInfo);
-            }
-            tail = info;
-          }
+    updateMetaMethodIndex();
+    QHash<QByteArray, QList<MethodIndexEntry> >::const_iterator it = _metaMethodIndex._methods.constFind(name);
+    if (it != _metaMethodIndex._methods.constEnd()) {
+      Q_FOREACH(const MethodIndexEntry& entry, it.value()) {
+        found = true;
+        PythonQtSlotInfo* info = new PythonQtSlotInfo(this, _meta->method(entry._index), entry._index);
+        if (tail) {
+          tail->setNextInfo(info);
+        } else {
+          PythonQtMemberInfo newInfo(info);
+          memberCache.insert(name, newInfo);
+        }
+        tail = info;
       }
     }
   }
@@ -383,16 +448,14 @@ void PythonQtClassInfo::recursiveCollectClassInfos(QList<PythonQtClassInfo*>& cl
 
 PythonQtSlotInfo* PythonQtClassInfo::findDecoratorSlots(const char* memberName, PythonQtSlotInfo* tail, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset)
 {
-  QListIterator<PythonQtSlotInfo*> it(_decoratorSlots);
-  while (it.hasNext()) {
-
-    PythonQtSlotInfo* infoOrig = it.next();
-    QByteArray signature = PythonQtUtils::methodName(*infoOrig->metaMethod());
-    if (signature.startsWith("static_")) {
-      int offset = signature.indexOf('_', 7);
-      signature = signature.mid(offset+1);
-    }
-    if (signature == memberName) {
+  if (_decoratorSlots.isEmpty()) {
+    return tail;
+  }
+  updateDecoratorSlotIndex();
+  QByteArray name(memberName);
+  QHash<QByteArray, QList<PythonQtSlotInfo*> >::const_iterator it = _decoratorSlotIndex.constFind(name);
+  if (it != _decoratorSlotIndex.constEnd()) {
+    Q_FOREACH(PythonQtSlotInfo* infoOrig, it.value()) {
       //make a copy, otherwise we will have trouble on overloads!
       PythonQtSlotInfo* info = new PythonQtSlotInfo(*infoOrig);
       info->setUpcastingOffset(upcastingOffset);
@@ -401,7 +464,7 @@ PythonQtSlotInfo* PythonQtClassInfo::findDecoratorSlots(const char* memberName,
         tail->setNextInfo(info);
       } else {
         PythonQtMemberInfo newInfo(info);
-        memberCache.insert(signature, newInfo);
+        memberCache.insert(name, newInfo);
       }
       tail = info;
     }
@@ -563,32 +626,73 @@ void* PythonQtClassInfo::castTo(void* ptr, const char* classname)
   return NULL;
 }
 
-bool PythonQtClassInfo::inherits(const char* name)
+void* PythonQtClassInfo::castTo(void* ptr, PythonQtClassInfo* classInfo)
 {
-  if (_wrappedClassName == name) {
+  int offset;
+  if (ptr==NULL || !upcastingOffset(classInfo, offset)) {
+    return NULL;
+  }
+  return (char*)ptr + offset;
+}
+
+bool PythonQtClassInfo::upcastingOffset(PythonQtClassInfo* classInfo, int& offset)
+{
+  if (classInfo == this) {
+    offset = 0;
+    return true;
+  }
+  if (_castOffsetsGeneration != _parentClassesGeneration) {
+    _castOffsets.clear();
+    _castOffsetsGeneration = _parentClassesGeneration;
+  }
+  QHash<PythonQtClassInfo*, CastOffset>::const_iterator it = _castOffsets.constFind(classInfo);
+  if (it != _castOffsets.constEnd()) {
+    offset = it.value()._offset;
+    return it.value()._related;
+  }
+  CastOffset cast;
+  cast._offset = 0;
+  cast._related = findUpcastingOffset(classInfo, cast._offset);
+  _castOffsets.insert(classInfo, cast);
+  offset = cast._offset;
+  return cast._related;
+}
+
+bool PythonQtClassInfo::findUpcastingOffset(PythonQtClassInfo* classInfo, int& offset)
+{
+  if (classInfo == this) {
     return true;
   }
+  // the same depth first search as in castTo()
   Q_FOREACH(const ParentClassInfo& info, _parentClasses) {
-    if (info._parent->inherits(name)) {
+    int parentOffset = 0;
+    if (info._parent->findUpcastingOffset(classInfo, parentOffset)) {
+      offset = info._upcastingOffset + parentOffset;
       return true;
     }
   }
   return false;
 }
 
-bool PythonQtClassInfo::inherits(PythonQtClassInfo* classInfo)
+bool PythonQtClassInfo::inherits(const char* name)
 {
-  if (classInfo == this) {
+  if (_wrappedClassName == name) {
     return true;
   }
   Q_FOREACH(const ParentClassInfo& info, _parentClasses) {
-    if (info._parent->inherits(classInfo)) {
+    if (info._parent->inherits(name)) {
       return true;
     }
   }
   return false;
 }
 
+bool PythonQtClassInfo::inherits(PythonQtClassInfo* classInfo)
+{
+  int offset;
+  return upcastingOffset(classInfo, offset);
+}
+
 QString PythonQtClassInfo::help()
 {
   decorator();
@@ -712,6 +816,7 @@ void PythonQtClassInfo::setDestructor(PythonQtSlotInfo* info)
 void PythonQtClassInfo::setMetaObject(const QMetaObject* meta)
 {
   _meta = meta;
+  _metaMethodIndex = MethodIndex();
   clearCachedMembers();
 }
 
@@ -756,6 +861,9 @@ void* PythonQtClassInfo::recursiveCastDownIfPossible(void* ptr, const char** res
   return NULL;
 }
 
+//! the maximum number of discriminator values whose downcast is cached per class in castDownIfPossible()
+#define PYTHONQT_MAX_DOWNCAST_DISCRIMINATOR_VALUES 1024
+
 void* PythonQtClassInfo::castDownIfPossible(void* ptr, PythonQtClassInfo** resultClassInfo)
 {
   const char* className;
@@ -775,6 +883,7 @@ void* PythonQtClassInfo::castDownIfPossible(void* ptr, PythonQtClassInfo** resul
         if (parent->_polymorphicHandlers.count()>0) {
           // copy handlers from parent class, to speedup next lookup
           _polymorphicHandlers = parent->_polymorphicHandlers;
+          _polymorphicDiscriminator = parent->_polymorphicDiscriminator;
           break;
         }
         if (parent->_parentClasses.count()>0) {
@@ -786,25 +895,89 @@ void* PythonQtClassInfo::castDownIfPossible(void* ptr, PythonQtClassInfo** resul
     }
   }
 
+  if (_polymorphicHandlers.isEmpty()) {
+    *resultClassInfo = this;
+    return ptr;
+  }
+
+  // if the handlers only depend on a discriminator value, their results are cached per value
+  int discriminatorValue = 0;
+  if (_polymorphicDiscriminator) {
+    discriminatorValue = (*_polymorphicDiscriminator)(ptr);
+    QHash<int, DiscriminatedDowncast>::const_iterator it = _downcastsByDiscriminator.constFind(discriminatorValue);
+    if (it != _downcastsByDiscriminator.constEnd()) {
+      *resultClassInfo = it.value()._classInfo;
+      return ((char*)ptr) + it.value()._offset;
+    }
+  }
+
   // we only do downcasting on the base object, not on the whole inheritance tree...
   void* resultPtr = NULL;
-  if (!_polymorphicHandlers.isEmpty()) {
-    Q_FOREACH(PythonQtPolymorphicHandlerCB* cb, _polymorphicHandlers) {
-      resultPtr = (*cb)(ptr, &className);
-      if (resultPtr) {
-        break;
-      }
+  Q_FOREACH(PythonQtPolymorphicHandlerCB* cb, _polymorphicHandlers) {
+    resultPtr = (*cb)(ptr, &className);
+    if (resultPtr) {
+      break;
     }
   }
   if (resultPtr) {
-    *resultClassInfo = PythonQt::priv()->getClassInfo(className);
+    *resultClassInfo = downcastClassInfo(className);
   } else {
     *resultClassInfo = this;
     resultPtr = ptr;
   }
+  // unknown classes are not cached, they might be registered later on
+  if (_polymorphicDiscriminator && *resultClassInfo &&
+      _downcastsByDiscriminator.size() < PYTHONQT_MAX_DOWNCAST_DISCRIMINATOR_VALUES) {
+    DiscriminatedDowncast downcast;
+    downcast._classInfo = *resultClassInfo;
+    downcast._offset = (int)(((char*)resultPtr) - ((char*)ptr));
+    _downcastsByDiscriminator.insert(discriminatorValue, downcast);
+  }
   return resultPtr;
 }
 
+void PythonQtClassInfo::addPolymorphicHandler(PythonQtPolymorphicHandlerCB* cb, PythonQtPolymorphicDiscriminatorCB* discriminator)
+{
+  // the results can only be cached if all handlers decide on the discriminator
+  if (_polymorphicHandlers.isEmpty() || _polymorphicDiscriminator) {
+    _polymorphicDiscriminator = discriminator;
+  }
+  _polymorphicHandlers.append(cb);
+  _downcastsByDiscriminator.clear();
+}
+
+//! the maximum number of name pointers that are cached per class in downcastClassInfo()
+#define PYTHONQT_MAX_DOWNCAST_NAME_POINTERS 64
+
+PythonQtClassInfo* PythonQtClassInfo::downcastClassInfo(const char* className)
+{
+  // the (generated) polymorphic handlers return string literals, so the class infos are cached by the name pointer first.
+  // The name is compared as well, in case a handler returns the name in a reused buffer.
+  QHash<const char*, DowncastTarget>::const_iterator it = _downcastTargets.constFind(className);
+  bool knownPointer = it != _downcastTargets.constEnd();
+  if (knownPointer && qstrcmp(it.value()._className.constData(), className) == 0) {
+    return it.value()._classInfo;
+  }
+  QByteArray name(className);
+  PythonQtClassInfo* info = _downcastTargetsByName.value(name);
+  if (!info) {
+    info = PythonQt::priv()->getClassInfo(name);
+    if (!info) {
+      // unknown classes are not cached, they might be registered later on
+      return NULL;
+    }
+    _downcastTargetsByName.insert(name, info);
+  }
+  // handlers that return names in temporary buffers would add a new pointer on each call, so the pointers are limited
+  if (!knownPointer && _downcastTargets.size() < PYTHONQT_MAX_DOWNCAST_NAME_POINTERS) {
+    DowncastTarget target;
+    target._className = name;
+    target._classInfo = info;
+    _downcastTargets.insert(className, target);
+  }
+  return info;
+}
+
 PyObject* PythonQtClassInfo::findEnumWrapper(const QByteArray& name, PythonQtClassInfo* localScope, bool* isLocalEnum)
 {
   if (isLocalEnum) {
@@ -837,7 +1010,7 @@ void PythonQtClassInfo::createEnumWrappers(const QMetaObject* meta)
   for (int i = meta->enumeratorOffset();i<meta->enumeratorCount();i++) {
     QMetaEnum e = meta->enumerator(i);
     PythonQtObjectPtr p;
-    p.setNewRef(PythonQtPrivate::createNewPythonQtEnumWrapper(e.name(), _pythonQtClassWrapper));
+    p.setNewRef(PythonQtPrivate::createNewPythonQtEnumWrapper(e.name(), pythonQtClassWrapper()));
     _enumWrappers.append(p);
   }
 }
@@ -887,6 +1060,7 @@ void PythonQtClassInfo::clearNotFoundCachedMembers()
 {
   // remove all not found entries, since a new decorator means new slots,
   // which might have been cached as "NotFound" already.
+  _cachedMembersGeneration++;
   QMutableHashIterator<QByteArray, PythonQtMemberInfo> it(_cachedMembers);
   while (it.hasNext()) {
     it.next();
@@ -894,6 +1068,45 @@ void PythonQtClassInfo::clearNotFoundCachedMembers()
       it.remove();
     }
   }
+  clearCachedMembersByName(true);
+}
+
+const PythonQtMemberInfo* PythonQtClassInfo::cachedMember(PyObject* name)
+{
+  PythonQtMemberInfo* info = _cachedMembersByName.value(name);
+  if (info) {
+    return info;
+  }
+#ifdef PY3K
+  bool interned = PyUnicode_CheckExact(name) && PyUnicode_CHECK_INTERNED(name);
+  const char* memberName = interned ? PyUnicode_AsUTF8(name) : NULL;
+#else
+  bool interned = PyString_CheckExact(name) && PyString_CHECK_INTERNED(name);
+  const char* memberName = interned ? PyString_AS_STRING(name) : NULL;
+#endif
+  if (!memberName) {
+    return NULL;
+  }
+  // keep the name alive, so that its address can not be reused by another string
+  Py_INCREF(name);
+  info = new PythonQtMemberInfo(member(memberName));
+  _cachedMembersByName.insert(name, info);
+  return info;
+}
+
+void PythonQtClassInfo::clearCachedMembersByName(bool notFoundOnly)
+{
+  QMutableHashIterator<PyObject*, PythonQtMemberInfo*> it(_cachedMembersByName);
+  while (it.hasNext()) {
+    it.next();
+    if (!notFoundOnly || it.value()->_type == PythonQtMemberInfo::NotFound) {
+      if (Py_IsInitialized()) {
+        Py_DECREF(it.key());
+      }
+      delete it.value();
+      it.remove();
+    }
+  }
 }
 
 void PythonQtClassInfo::addNestedClass(PythonQtClassInfo* info)
@@ -144,6 +144,10 @@ public:
   //! (if the cast is not possible or if ptr is NULL, NULL is returned)
   void* castTo(void* ptr, const char* classname);
 
+  //! casts the given \c ptr to an object of the class of \c classInfo, the same as castTo() with a class name,
+  //! but the upcasting offset (or that the classes are not related) is cached per class info
+  void* castTo(void* ptr, PythonQtClassInfo* classInfo);
+
   //! get help string for the metaobject
   QString help();
 
@@ -163,13 +167,23 @@ public:
   QObject* decorator();
   
   //! add the parent class info of a CPP object
-  void addParentClass(const ParentClassInfo& info) { _parentClasses.append(info); }
+  void addParentClass(const ParentClassInfo& info) { _parentClasses.append(info); _parentClassesGeneration++; }
 
   //! set the associated PythonQtClassWrapper (which handles instance creation of this type)
   void setPythonQtClassWrapper(PyObject* obj) { _pythonQtClassWrapper = obj; }
 
-  //! get the associated PythonQtClassWrapper (which handles instance creation of this type)
-  PyObject* pythonQtClassWrapper() { return _pythonQtClassWrapper; }
+  //! get the associated PythonQtClassWrapper (which handles instance creation of this type),
+  //! creates the wrapper if it was registered lazily and is still pending
+  PyObject* pythonQtClassWrapper();
+
+  //! returns if a PythonQtClassWrapper exists or is pending for lazy creation (does not create it)
+  bool hasPythonQtClassWrapper() const { return _pythonQtClassWrapper || _pythonQtClassWrapperPending; }
+
+  //! set if the PythonQtClassWrapper is registered lazily and will be created on first use
+  void setPythonQtClassWrapperPending(bool flag) { _pythonQtClassWrapperPending = flag; }
+
+  //! returns if the PythonQtClassWrapper is registered lazily and not yet created
+  bool isPythonQtClassWrapperPending() const { return _pythonQtClassWrapperPending; }
 
   //! set the shell set instance wrapper cb
   void setShellSetInstanceWrapperCB(PythonQtShellSetInstanceWrapperCB* cb) {
@@ -181,8 +195,8 @@ public:
     return _shellSetInstanceWrapperCB;
   }
 
-  //! add a handler for polymorphic downcasting
-  void addPolymorphicHandler(PythonQtPolymorphicHandlerCB* cb) { _polymorphicHandlers.append(cb); }
+  //! add a handler for polymorphic downcasting, see PythonQt::addPolymorphicHandler() for the \c discriminator
+  void addPolymorphicHandler(PythonQtPolymorphicHandlerCB* cb, PythonQtPolymorphicDiscriminatorCB* discriminator = NULL);
 
   //! cast the pointer down in the class hierarchy if a polymorphic handler allows to do that
   void* castDownIfPossible(void* ptr, PythonQtClassInfo** resultClassInfo);
@@ -190,9 +204,19 @@ public:
   //! returns if the localScope has an enum of that type name or if the enum contains a :: scope, if that class contails the enum
   static PyObject* findEnumWrapper(const QByteArray& name, PythonQtClassInfo* localScope, bool* isLocalEnum = NULL);
 
+  //! get the member for the given Python attribute name, interned names are cached by their string object,
+  //! so that repeated lookups avoid building a QByteArray key.
+  //! Returns NULL if the name is not interned, use member(const char*) in that case.
+  //! The returned pointer stays valid until the cached members are cleared.
+  const PythonQtMemberInfo* cachedMember(PyObject* name);
+
   //! clear all members that where cached as "NotFound"
   void clearNotFoundCachedMembers();
 
+  //! returns a counter that changes whenever cached members are cleared, which allows to
+  //! revalidate slot pointers that were obtained from member()
+  int cachedMembersGeneration() const { return _cachedMembersGeneration; }
+
   //! get nested classes
   const QList<PythonQtClassInfo*>& nestedClasses() { return _nestedClasses; }
 
@@ -212,15 +236,49 @@ public:
   const QString& doc() const {return _doc;}
 
 private:
+  //! an entry of a MethodIndex
+  struct MethodIndexEntry {
+    MethodIndexEntry(int index = -1, bool classDecorator = false):_index(index),_classDecorator(classDecorator) {}
+
+    int  _index;
+    bool _classDecorator;
+  };
+
+  //! the public methods of a meta object by their Python name, so that member lookups do not need to walk all methods
+  struct MethodIndex {
+    MethodIndex():_meta(NULL) {}
+
+    //! the meta object the index was built for
+    const QMetaObject* _meta;
+    QHash<QByteArray, QList<MethodIndexEntry> > _methods;
+  };
+
+  //! builds the index of the decorator provider methods (if it was not built for the given meta object yet)
+  void updateDecoratorMethodIndex(const QMetaObject* meta);
+  //! builds the index of the slots/signals/methods of _meta (if it was not built for _meta yet)
+  void updateMetaMethodIndex();
+  //! builds the index of the decorator slots (if slots were added since it was built)
+  void updateDecoratorSlotIndex();
+
   void createEnumWrappers();
   void createEnumWrappers(const QMetaObject* meta);
   PyObject* findEnumWrapper(const char* name);
 
   //! clear all cached members
   void clearCachedMembers();
+  //! clear the members cached by Python name (or only those cached as "NotFound")
+  void clearCachedMembersByName(bool notFoundOnly);
 
   void* recursiveCastDownIfPossible(void* ptr, const char** resultClassName);
 
+  //! returns if the class is or inherits from \c classInfo and the accumulated upcasting offset (uses _castOffsets)
+  bool upcastingOffset(PythonQtClassInfo* classInfo, int& offset);
+  //! finds the upcasting offset to \c classInfo in the class hierarchy
+  bool findUpcastingOffset(PythonQtClassInfo* classInfo, int& offset);
+
+  //! returns the class info of the class name returned by a polymorphic handler
+  PythonQtClassInfo* downcastClassInfo(const char* className);
+
   PythonQtSlotInfo* findDecoratorSlotsFromDecoratorProvider(const char* memberName, PythonQtSlotInfo* inputInfo, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset);
   void listDecoratorSlotsFromDecoratorProvider(QStringList& list, bool metaOnly);
   PythonQtSlotInfo* recursiveFindDecoratorSlotsFromDecoratorProvider(const char* memberName, PythonQtSlotInfo* inputInfo, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset);
@@ -236,11 +294,20 @@ private:
   int findCharOffset(const char* sigStart, char someChar);
  
   QHash<QByteArray, PythonQtMemberInfo> _cachedMembers;
+  //! members cached by their interned Python name (holds a reference to the name)
+  QHash<PyObject*, PythonQtMemberInfo*> _cachedMembersByName;
+  int _cachedMembersGeneration;
 
   PythonQtSlotInfo*                    _constructors;
   PythonQtSlotInfo*                    _destructor;
   QList<PythonQtSlotInfo*>             _decoratorSlots;
 
+  //! the name indices of the decorator provider methods, the _meta methods and the decorator slots
+  MethodIndex                          _decoratorMethodIndex;
+  MethodIndex                          _metaMethodIndex;
+  QHash<QByteArray, QList<PythonQtSlotInfo*> > _decoratorSlotIndex;
+  int                                  _indexedDecoratorSlots;
+
   QList<PythonQtObjectPtr>             _enumWrappers;
 
   const QMetaObject*                   _meta;
@@ -248,7 +315,39 @@ private:
   QByteArray                           _wrappedClassName;
   QList<ParentClassInfo>               _parentClasses;
 
+  //! the result of a cast to another class
+  struct CastOffset {
+    bool _related;
+    int  _offset;
+  };
+  //! the cached casts to other classes, valid as long as no parent class was added to any class
+  QHash<PythonQtClassInfo*, CastOffset> _castOffsets;
+  int                                  _castOffsetsGeneration;
+  //! incremented when a parent class is added to any class
+  static int                           _parentClassesGeneration;
+
   QList<PythonQtPolymorphicHandlerCB*> _polymorphicHandlers;
+  //! the discriminator of the polymorphic handlers, NULL if any of them was added without one
+  PythonQtPolymorphicDiscriminatorCB*  _polymorphicDiscriminator;
+
+  //! the result of the polymorphic handlers for a discriminator value
+  struct DiscriminatedDowncast {
+    PythonQtClassInfo* _classInfo;
+    //! the offset of the pointer returned by the handler
+    int                _offset;
+  };
+  //! the results of the polymorphic handlers by discriminator value (limited in size)
+  QHash<int, DiscriminatedDowncast>    _downcastsByDiscriminator;
+
+  //! a class returned by a polymorphic handler
+  struct DowncastTarget {
+    QByteArray         _className;
+    PythonQtClassInfo* _classInfo;
+  };
+  //! the class infos of the classes returned by the polymorphic handlers, by the returned name pointer (limited in size)
+  QHash<const char*, DowncastTarget>   _downcastTargets;
+  //! the class infos of the classes returned by the polymorphic handlers, by name
+  QHash<QByteArray, PythonQtClassInfo*> _downcastTargetsByName;
 
   QList<PythonQtClassInfo*>            _nestedClasses;
 
@@ -265,6 +364,7 @@ private:
   bool                                 _isQObject;
   bool                                 _enumsCreated;
   bool                                 _searchPolymorphicHandlerOnParent;
+  bool                                 _pythonQtClassWrapperPending;
 
   QString                              _doc;
   
@@ -49,13 +49,78 @@
 #include "PythonQtConversion.h"
 #include "PythonQtInstanceWrapper.h"
 
+bool PythonQtClassWrapper_hasOverride(PythonQtClassWrapper* type, int overrideIndex, PyObject* name)
+{
+  if (!type->_overrides) {
+    type->_knownOverrides = new QBitArray();
+    type->_overrides = new QBitArray();
+  }
+  PyTypeObject* typeObject = (PyTypeObject*)type;
+  // Python invalidates the version tag when the class or any class in its MRO (including plain Python
+  // mixin classes) is modified, without a valid tag the override bits can't be reused
+  if (!PyType_HasFeature(typeObject, Py_TPFLAGS_VALID_VERSION_TAG) ||
+      typeObject->tp_version_tag != type->_overridesVersionTag) {
+    type->_knownOverrides->fill(false);
+  }
+  if (overrideIndex >= type->_knownOverrides->size()) {
+    int size = qMax(overrideIndex + 1, 2 * type->_knownOverrides->size());
+    type->_knownOverrides->resize(size);
+    type->_overrides->resize(size);
+  }
+  if (!type->_knownOverrides->testBit(overrideIndex)) {
+    // look into the dicts of the class and its bases, this does not set an exception if nothing is found
+    bool overridden = _PyType_Lookup(typeObject, name) != NULL;
+    type->_overrides->setBit(overrideIndex, overridden);
+    type->_knownOverrides->setBit(overrideIndex);
+    // the lookup assigns a new version tag if possible
+    type->_overridesVersionTag = typeObject->tp_version_tag;
+  }
+  return type->_overrides->testBit(overrideIndex);
+}
+
+// the member names of the operators, indexed by PythonQtClassWrapper_Operator
+static const char* operatorNames[PythonQtOp_Count] = {
+  "__add__", "__sub__", "__mul__", "__div__", "__and__", "__or__", "__xor__", "__mod__", "__lshift__", "__rshift__",
+  "__iadd__", "__isub__", "__imul__", "__idiv__", "__iand__", "__ior__", "__ixor__", "__imod__", "__ilshift__", "__irshift__",
+  "__invert__", "__nonzero__",
+  "__lt__", "__le__", "__eq__", "__ne__", "__gt__", "__ge__"
+};
+
+PythonQtSlotInfo* PythonQtClassWrapper_operatorSlot(PythonQtInstanceWrapper* wrapper, PythonQtClassWrapper_Operator op)
+{
+  PythonQtClassWrapper* type = (PythonQtClassWrapper*)Py_TYPE(wrapper);
+  PythonQtClassInfo* info = wrapper->classInfo();
+  if (type->_operatorSlotsGeneration != info->cachedMembersGeneration()) {
+    // the slots of the class info were deleted or new slots were added
+    type->_knownOperatorSlots = 0;
+    type->_operatorSlotsGeneration = info->cachedMembersGeneration();
+  }
+  unsigned int bit = 1u << op;
+  if (!(type->_knownOperatorSlots & bit)) {
+    PythonQtMemberInfo opSlot = info->member(operatorNames[op]);
+    type->_operatorSlots[op] = (opSlot._type == PythonQtMemberInfo::Slot)?opSlot._slot:NULL;
+    type->_knownOperatorSlots |= bit;
+  }
+  return type->_operatorSlots[op];
+}
+
+PyObject* PythonQtClassWrapper_callOperator(PythonQtInstanceWrapper* wrapper, PythonQtSlotInfo* slot, PyObject* other)
+{
+  PyObject* args = PyTuple_Pack(1, other);
+  if (!args) {
+    return NULL;
+  }
+  PyObject* result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, slot, args, NULL, wrapper->_wrappedPtr);
+  Py_DECREF(args);
+  return result;
+}
+
 static PyObject* PythonQtInstanceWrapper_invert(PythonQtInstanceWrapper* wrapper)
 {
   PyObject* result = NULL;
-  static QByteArray memberName = "__invert__";
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
-    result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, NULL, NULL, wrapper->_wrappedPtr);
+  PythonQtSlotInfo* opSlot = PythonQtClassWrapper_operatorSlot(wrapper, PythonQtOp_Invert);
+  if (opSlot) {
+    result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot, NULL, NULL, wrapper->_wrappedPtr);
   }
   return result;
 }
@@ -64,10 +129,9 @@ static int PythonQtInstanceWrapper_nonzero(PythonQtInstanceWrapper* wrapper)
 {
   int result = (wrapper->_wrappedPtr == NULL && wrapper->_obj == NULL)?0:1;
   if (result) {
-    static QByteArray memberName = "__nonzero__";
-    PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-    if (opSlot._type == PythonQtMemberInfo::Slot) {
-      PyObject* resultObj = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, NULL, NULL, wrapper->_wrappedPtr);
+    PythonQtSlotInfo* opSlot = PythonQtClassWrapper_operatorSlot(wrapper, PythonQtOp_NonZero);
+    if (opSlot) {
+      PyObject* resultObj = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot, NULL, NULL, wrapper->_wrappedPtr);
       if (resultObj == Py_False) {
         result = 0;
       }
@@ -78,69 +142,61 @@ static int PythonQtInstanceWrapper_nonzero(PythonQtInstanceWrapper* wrapper)
 }
 
 
-static PyObject* PythonQtInstanceWrapper_binaryfunc(PyObject* self, PyObject* other, const QByteArray& opName, const QByteArray& fallbackOpName = QByteArray())
+static PyObject* PythonQtInstanceWrapper_binaryfunc(PyObject* self, PyObject* other, PythonQtClassWrapper_Operator op, int fallbackOp = -1)
 {
   // since we disabled type checking, we can receive any object as self, but we currently only support
   // different objects on the right. Otherwise we would need to generate __radd__ etc. methods.
   if (!PyObject_TypeCheck(self, &PythonQtInstanceWrapper_Type)) {
-    QString error = "Unsupported operation " + opName + "(" + self->ob_type->tp_name + ", " +  other->ob_type->tp_name + ")";
+    QString error = QString("Unsupported operation ") + operatorNames[op] + "(" + self->ob_type->tp_name + ", " +  other->ob_type->tp_name + ")";
     PyErr_SetString(PyExc_ArithmeticError, error.toLatin1().data());
     return NULL;
   }
   PythonQtInstanceWrapper* wrapper = (PythonQtInstanceWrapper*)self;
   PyObject* result = NULL;
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member(opName);
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
-    // TODO get rid of tuple
-    PyObject* args = PyTuple_New(1);
-    Py_INCREF(other);
-    PyTuple_SET_ITEM(args, 0, other);
-    result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, args, NULL, wrapper->_wrappedPtr);
-    Py_DECREF(args);
-    if (!result && !fallbackOpName.isEmpty()) {
+  PythonQtSlotInfo* opSlot = PythonQtClassWrapper_operatorSlot(wrapper, op);
+  if (opSlot) {
+    result = PythonQtClassWrapper_callOperator(wrapper, opSlot, other);
+    if (!result && fallbackOp >= 0) {
       // try fallback if we did not get a result
-      result = PythonQtInstanceWrapper_binaryfunc(self, other, fallbackOpName);
+      result = PythonQtInstanceWrapper_binaryfunc(self, other, (PythonQtClassWrapper_Operator)fallbackOp);
     }
   }
   return result;
 }
 
-#define BINARY_OP(NAME) \
+#define BINARY_OP(NAME, OP) \
 static PyObject* PythonQtInstanceWrapper_ ## NAME(PyObject* self, PyObject* other) \
 { \
-  static const QByteArray opName("__" #NAME "__"); \
-  return PythonQtInstanceWrapper_binaryfunc(self, other, opName); \
+  return PythonQtInstanceWrapper_binaryfunc(self, other, PythonQtOp_ ## OP); \
 }
 
-#define BINARY_OP_INPLACE(NAME) \
+#define BINARY_OP_INPLACE(NAME, OP) \
   static PyObject* PythonQtInstanceWrapper_i ## NAME(PyObject* self, PyObject* other) \
 { \
-  static const QByteArray opName("__i" #NAME "__"); \
-  static const QByteArray fallbackName("__" #NAME "__"); \
-  return PythonQtInstanceWrapper_binaryfunc(self, other, opName, fallbackName); \
+  return PythonQtInstanceWrapper_binaryfunc(self, other, PythonQtOp_Inplace ## OP, PythonQtOp_ ## OP); \
 }
 
-BINARY_OP(add)
-BINARY_OP(sub)
-BINARY_OP(mul)
-BINARY_OP(div)
-BINARY_OP(and)
-BINARY_OP(or)
-BINARY_OP(xor)
-BINARY_OP(mod)
-BINARY_OP(lshift)
-BINARY_OP(rshift)
-
-BINARY_OP_INPLACE(add)
-BINARY_OP_INPLACE(sub)
-BINARY_OP_INPLACE(mul)
-BINARY_OP_INPLACE(div)
-BINARY_OP_INPLACE(and)
-BINARY_OP_INPLACE(or)
-BINARY_OP_INPLACE(xor)
-BINARY_OP_INPLACE(mod)
-BINARY_OP_INPLACE(lshift)
-BINARY_OP_INPLACE(rshift)
+BINARY_OP(add, Add)
+BINARY_OP(sub, Subtract)
+BINARY_OP(mul, Multiply)
+BINARY_OP(div, Divide)
+BINARY_OP(and, And)
+BINARY_OP(or, Or)
+BINARY_OP(xor, Xor)
+BINARY_OP(mod, Mod)
+BINARY_OP(lshift, LShift)
+BINARY_OP(rshift, RShift)
+
+BINARY_OP_INPLACE(add, Add)
+BINARY_OP_INPLACE(sub, Subtract)
+BINARY_OP_INPLACE(mul, Multiply)
+BINARY_OP_INPLACE(div, Divide)
+BINARY_OP_INPLACE(and, And)
+BINARY_OP_INPLACE(or, Or)
+BINARY_OP_INPLACE(xor, Xor)
+BINARY_OP_INPLACE(mod, Mod)
+BINARY_OP_INPLACE(lshift, LShift)
+BINARY_OP_INPLACE(rshift, RShift)
 
 static void initializeSlots(PythonQtClassWrapper* wrap)
 {
@@ -242,6 +298,13 @@ static PyObject* PythonQtClassWrapper_alloc(PyTypeObject *self, Py_ssize_t nitem
 }
 
 
+static void PythonQtClassWrapper_dealloc(PythonQtClassWrapper* self)
+{
+  delete self->_knownOverrides;
+  delete self->_overrides;
+  PyType_Type.tp_dealloc((PyObject*)self);
+}
+
 static int PythonQtClassWrapper_init(PythonQtClassWrapper* self, PyObject* args, PyObject* kwds)
 {
   // call the default type init
@@ -453,7 +516,7 @@ PyTypeObject PythonQtClassWrapper_Type = {
     "PythonQt.PythonQtClassWrapper",             /*tp_name*/
     sizeof(PythonQtClassWrapper),             /*tp_basicsize*/
     0,                         /*tp_itemsize*/
-    0,                         /*tp_dealloc*/
+    (destructor)PythonQtClassWrapper_dealloc, /*tp_dealloc*/
     0,                         /*tp_print*/
     0,                         /*tp_getattr*/
     0,                         /*tp_setattr*/
@@ -51,8 +51,24 @@
 #include "compile.h"
 #include "eval.h"
 #include <QString>
+#include <QBitArray>
 
 class PythonQtClassInfo;
+class PythonQtSlotInfo;
+struct PythonQtInstanceWrapperStruct;
+
+//! the operators of a wrapped class that are dispatched via the Python type slots (see PythonQt::TypeSlots)
+enum PythonQtClassWrapper_Operator {
+  PythonQtOp_Add, PythonQtOp_Subtract, PythonQtOp_Multiply, PythonQtOp_Divide,
+  PythonQtOp_And, PythonQtOp_Or, PythonQtOp_Xor, PythonQtOp_Mod, PythonQtOp_LShift, PythonQtOp_RShift,
+  PythonQtOp_InplaceAdd, PythonQtOp_InplaceSubtract, PythonQtOp_InplaceMultiply, PythonQtOp_InplaceDivide,
+  PythonQtOp_InplaceAnd, PythonQtOp_InplaceOr, PythonQtOp_InplaceXor, PythonQtOp_InplaceMod,
+  PythonQtOp_InplaceLShift, PythonQtOp_InplaceRShift,
+  PythonQtOp_Invert, PythonQtOp_NonZero,
+  PythonQtOp_LessThan, PythonQtOp_LessEqual, PythonQtOp_Equal, PythonQtOp_NotEqual,
+  PythonQtOp_GreaterThan, PythonQtOp_GreaterEqual,
+  PythonQtOp_Count
+};
 
 //! the type of the PythonQt class wrapper objects
 extern PYTHONQT_EXPORT PyTypeObject PythonQtClassWrapper_Type;
@@ -70,8 +86,38 @@ typedef struct {
   //! get the class info
   PythonQtClassInfo* classInfo() { return _classInfo; }
 
+  //! the shell virtual methods for which the override state is already known (indexed by PythonQtInstanceWrapper_overrideIndex())
+  QBitArray* _knownOverrides;
+
+  //! the shell virtual methods that are overridden by this Python class (valid where _knownOverrides is set)
+  QBitArray* _overrides;
+
+  //! the type version tag that the override bits were computed for (see PyType_Modified())
+  unsigned int _overridesVersionTag;
+
+  //! the operator slots of the class (indexed by PythonQtClassWrapper_Operator), valid where _knownOperatorSlots is set
+  PythonQtSlotInfo* _operatorSlots[PythonQtOp_Count];
+
+  //! bit mask of the operators that are already looked up in _operatorSlots
+  unsigned int _knownOperatorSlots;
+
+  //! the PythonQtClassInfo::cachedMembersGeneration() that _operatorSlots were looked up for
+  int _operatorSlotsGeneration;
+
 } PythonQtClassWrapper;
 
+//! returns if the Python class (or one of its Python base classes) defines an attribute with the given name.
+//! The result is cached per class for the given \c overrideIndex and invalidated when the type version tag
+//! of the class changes, i.e. when an attribute of the class or of one of its base classes is set or deleted.
+bool PythonQtClassWrapper_hasOverride(PythonQtClassWrapper* type, int overrideIndex, PyObject* name);
+
+//! returns the slot that implements the given operator for the class of \c wrapper (or NULL),
+//! the slot is only looked up once per class as long as the cached members of the class info are unchanged
+PythonQtSlotInfo* PythonQtClassWrapper_operatorSlot(struct PythonQtInstanceWrapperStruct* wrapper, PythonQtClassWrapper_Operator op);
+
+//! calls the given operator slot on \c wrapper with \c other as single argument
+PyObject* PythonQtClassWrapper_callOperator(struct PythonQtInstanceWrapperStruct* wrapper, PythonQtSlotInfo* slot, PyObject* other);
+
 //---------------------------------------------------------------
 
 #endif
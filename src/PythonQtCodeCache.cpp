@@ -0,0 +1,106 @@
+/*
+*
+*  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  Further, this software is distributed without any warranty that it is
+*  free of the rightful claim of any third person regarding infringement
+*  or the like.  Any license provided herein, whether implied or
+*  otherwise, applies only to this software file.  Patent licenses, if
+*  any, provided herein do not apply to combinations of this program with
+*  other software, or any other product whatsoever.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*
+*  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+*  28359 Bremen, Germany or:
+*
+*  http://www.mevis.de
+*
+*/
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtCodeCache.cpp
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtCodeCache.h"
+
+#include <QStringList>
+
+PythonQtCodeCache::PythonQtCodeCache()
+{
+  _hits = 0;
+  _misses = 0;
+  setMaxEntries(128);
+}
+
+void PythonQtCodeCache::setMaxEntries(int maxEntries)
+{
+  _codes.setMaxCost(maxEntries);
+  _attributePaths.setMaxCost(maxEntries);
+}
+
+PythonQtObjectPtr PythonQtCodeCache::code(const QString& source, int start)
+{
+  PythonQtCodeCacheKey key(source, start);
+  PythonQtObjectPtr* cached = _codes.object(key);
+  if (cached) {
+    _hits++;
+    return *cached;
+  }
+  _misses++;
+  PythonQtObjectPtr code;
+  code.setNewRef(Py_CompileString(source.toUtf8().constData(), "<string>", start));
+  if (code && _codes.maxCost() > 0) {
+    _codes.insert(key, new PythonQtObjectPtr(code));
+  }
+  return code;
+}
+
+QList<PythonQtObjectPtr> PythonQtCodeCache::attributePath(const QString& name)
+{
+  QList<PythonQtObjectPtr>* cached = _attributePaths.object(name);
+  if (cached) {
+    return *cached;
+  }
+  QList<PythonQtObjectPtr> path;
+  QStringList parts = name.split('.');
+  Q_FOREACH(const QString& part, parts) {
+    PythonQtObjectPtr attributeName;
+#ifdef PY3K
+    attributeName.setNewRef(PyUnicode_InternFromString(part.toUtf8().constData()));
+#else
+    attributeName.setNewRef(PyString_InternFromString(part.toLatin1().constData()));
+#endif
+    path << attributeName;
+  }
+  if (_attributePaths.maxCost() > 0) {
+    _attributePaths.insert(name, new QList<PythonQtObjectPtr>(path));
+  }
+  return path;
+}
+
+void PythonQtCodeCache::clear()
+{
+  _codes.clear();
+  _attributePaths.clear();
+  _hits = 0;
+  _misses = 0;
+}
@@ -0,0 +1,111 @@
+#ifndef _PYTHONQTCODECACHE_H
+#define _PYTHONQTCODECACHE_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtCodeCache.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+#include "PythonQtSystem.h"
+#include "PythonQtObjectPtr.h"
+
+#include <QCache>
+#include <QList>
+#include <QString>
+
+//! key of a compiled code object, consisting of the source text and the start token
+struct PythonQtCodeCacheKey
+{
+  PythonQtCodeCacheKey(const QString& source, int start):_source(source), _start(start) {}
+
+  bool operator==(const PythonQtCodeCacheKey& other) const {
+    return _start == other._start && _source == other._source;
+  }
+
+  QString _source;
+  int     _start;
+};
+
+inline uint qHash(const PythonQtCodeCacheKey& key)
+{
+  return qHash(key._source) ^ uint(key._start);
+}
+
+//! a bounded LRU cache of the code objects compiled by PythonQt::evalScript() and of the
+//! interned attribute names of the dotted names used by PythonQt::lookupObject()/PythonQt::call()
+class PYTHONQT_EXPORT PythonQtCodeCache
+{
+public:
+  PythonQtCodeCache();
+
+  //! returns the code object of the given source text, compiled (as UTF-8) with the given
+  //! start token (Py_file_input, Py_eval_input or Py_single_input). The code is only compiled if it is not cached yet.
+  //! Returns NULL and sets a Python error if the compilation fails.
+  PythonQtObjectPtr code(const QString& source, int start);
+
+  //! returns the interned Python strings of the parts of the given dotted name
+  QList<PythonQtObjectPtr> attributePath(const QString& name);
+
+  //! sets the maximum number of cached code objects (and of cached dotted names), 0 disables the cache
+  void setMaxEntries(int maxEntries);
+  //! returns the maximum number of cached code objects
+  int maxEntries() const { return _codes.maxCost(); }
+
+  //! returns the number of currently cached code objects
+  int count() const { return _codes.count(); }
+
+  //! returns how often code() found a cached code object
+  int hits() const { return _hits; }
+  //! returns how often code() had to compile the source text
+  int misses() const { return _misses; }
+
+  //! removes all cached entries and resets the statistics (the GIL has to be held)
+  void clear();
+
+private:
+  QCache<PythonQtCodeCacheKey, PythonQtObjectPtr>  _codes;
+  QCache<QString, QList<PythonQtObjectPtr> >       _attributePaths;
+  int _hits;
+  int _misses;
+};
+
+#endif
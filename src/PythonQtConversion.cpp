@@ -42,17 +42,28 @@
 #include "PythonQtConversion.h"
 #include "PythonQtVariants.h"
 #include "PythonQtBoolResult.h"
+#include "PythonQtByteArrayBuffer.h"
 #include <QDateTime>
+#include <QPointer>
 #include <QTime>
 #include <QDate>
 #include <climits>
 
-PythonQtValueStorage<qint64, 128>  PythonQtConv::global_valueStorage;
-PythonQtValueStorage<void*, 128>   PythonQtConv::global_ptrStorage;
-PythonQtValueStorageWithCleanup<QVariant, 128> PythonQtConv::global_variantStorage;
+#if defined(PY3K) && PY_VERSION_HEX >= 0x03030000
+//! strings are stored in the compact Latin-1/UCS-2/UCS-4 layout of PEP 393
+#define PYTHONQT_COMPACT_UNICODE
+#endif
+
+PythonQtThreadLocalValueStorage<PythonQtValueStorage<qint64, 128> >  PythonQtConv::global_valueStorage;
+PythonQtThreadLocalValueStorage<PythonQtValueStorage<void*, 128> >   PythonQtConv::global_ptrStorage;
+PythonQtThreadLocalValueStorage<PythonQtValueStorageWithCleanup<QVariant, 128> > PythonQtConv::global_variantStorage;
 
 QHash<int, PythonQtConvertMetaTypeToPythonCB*> PythonQtConv::_metaTypeToPythonConverters;
 QHash<int, PythonQtConvertPythonToMetaTypeCB*> PythonQtConv::_pythonToMetaTypeConverters;
+bool PythonQtConv::_byteArrayZeroCopy = false;
+bool PythonQtConv::_sequenceViews = false;
+bool PythonQtConv::_numericBuffers = false;
+bool PythonQtConv::_specializedConverters = true;
 
 PyObject* PythonQtConv::GetPyBool(bool val)
 {
@@ -109,6 +120,11 @@ PyObject* PythonQtConv::ConvertQtValueToPython(const PythonQtMethodInfo::Paramet
     }
   }
 
+  if (_byteArrayZeroCopy && info.typeId == QMetaType::QByteArray && info.pointerCount == 0) {
+    // share the data instead of wrapping a copy of the QByteArray
+    return PythonQtByteArrayBuffer_FromByteArray(*((QByteArray*)data));
+  }
+
   // special handling did not match, so we convert the usual way (either pointer or value version):
   if (info.pointerCount == 1) {
     // convert the pointer to a Python Object (we can handle ANY C++ object, in the worst case we just know the type and the pointer)
@@ -181,6 +197,9 @@ PyObject* PythonQtConv::ConvertQtValueToPythonInternal(int type, const void* dat
   case QMetaType::QString:
     return PythonQtConv::QStringToPyObject(*((QString*)data));
   case QMetaType::QStringList:
+    if (_sequenceViews) {
+      return PythonQtSequenceView_New(new PythonQtSequenceViewOfValueTypes<QStringList, QString>(*((QStringList*)data), QMetaType::QString));
+    }
     return PythonQtConv::QStringListToPyObject(*((QStringList*)data));
 
   case PythonQtMethodInfo::Variant:
@@ -264,6 +283,17 @@ PyObject* PythonQtConv::ConvertQtValueToPythonInternal(int type, const void* dat
  }
 
  void* PythonQtConv::castWrapperTo(PythonQtInstanceWrapper* wrapper, const QByteArray& className, bool& ok)
+ {
+   // the class info of the given name is the only one that can match
+   PythonQtClassInfo* classInfo = PythonQt::priv()->getClassInfo(className);
+   if (!classInfo) {
+     ok = false;
+     return NULL;
+   }
+   return castWrapperTo(wrapper, classInfo, ok);
+ }
+
+ void* PythonQtConv::castWrapperTo(PythonQtInstanceWrapper* wrapper, PythonQtClassInfo* classInfo, bool& ok)
  {
    void* object;
    if (wrapper->classInfo()->isCPPWrapper()) {
@@ -273,16 +303,29 @@ PyObject* PythonQtConv::ConvertQtValueToPythonInternal(int type, const void* dat
      object = tmp;
    }
    if (object) {
-     // if we can be upcasted to the given name, we pass the casted pointer in:
-     object = wrapper->classInfo()->castTo(object, className);
+     // if we can be upcasted to the given class, we pass the casted pointer in:
+     object = wrapper->classInfo()->castTo(object, classInfo);
      ok = object!=NULL;
    } else {
      // if it is a NULL ptr, we need to check if it inherits, so that we might pass the NULL ptr
-     ok = wrapper->classInfo()->inherits(className);
+     ok = wrapper->classInfo()->inherits(classInfo);
    }
    return object;
  }
 
+ void* PythonQtConv::castWrapperTo(PythonQtInstanceWrapper* wrapper, const PythonQtMethodInfo::ParameterInfo& info, bool& ok)
+ {
+   if (!info.classInfo) {
+     // the class might not be registered yet, so it is resolved again on the next call if it is unknown
+     info.classInfo = PythonQt::priv()->getClassInfo(info.name);
+     if (!info.classInfo) {
+       ok = false;
+       return NULL;
+     }
+   }
+   return castWrapperTo(wrapper, info.classInfo, ok);
+ }
+
 void* PythonQtConv::handlePythonToQtAutoConversion(int typeId, PyObject* obj, void* alreadyAllocatedCPPObject)
 {
   void* ptr = alreadyAllocatedCPPObject;
@@ -381,7 +424,7 @@ void* PythonQtConv::ConvertPythonToQt(const PythonQtMethodInfo::ParameterInfo& i
 
      // a C++ wrapper (can be passed as pointer or reference)
      PythonQtInstanceWrapper* wrap = (PythonQtInstanceWrapper*)obj;
-     void* object = castWrapperTo(wrap, info.name, ok);
+     void* object = castWrapperTo(wrap, info, ok);
      if (ok) {
        if (info.pointerCount==1) {
          // store the wrapped pointer in an extra pointer and let ptr point to the extra pointer
@@ -687,6 +730,221 @@ void* PythonQtConv::ConvertPythonToQt(const PythonQtMethodInfo::ParameterInfo& i
 }
 
 
+// the specialized converters below only handle what ConvertPythonToQt() does for their parameter type
+// after all checks that can not apply to that type, and fall back to ConvertPythonToQt() otherwise
+
+static void* PythonQtConvertGenericArgument(const PythonQtMethodInfo::ParameterInfo& info, PyObject* obj, bool strict, PythonQtClassInfo* classInfo)
+{
+  return PythonQtConv::ConvertPythonToQt(info, obj, strict, classInfo);
+}
+
+static void* PythonQtConvertIntArgument(const PythonQtMethodInfo::ParameterInfo& info, PyObject* obj, bool strict, PythonQtClassInfo* classInfo)
+{
+  if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+    return PythonQtConv::ConvertPythonToQt(info, obj, strict, classInfo);
+  }
+  void* ptr = NULL;
+  bool ok;
+  qint64 val = PythonQtConv::PyObjGetLongLong(obj, strict, ok);
+  if (ok && (val >= INT_MIN && val <= INT_MAX)) {
+    PythonQtValueStorage_ADD_VALUE(PythonQtConv::global_valueStorage, int, val, ptr);
+  }
+  return ptr;
+}
+
+static void* PythonQtConvertDoubleArgument(const PythonQtMethodInfo::ParameterInfo& info, PyObject* obj, bool strict, PythonQtClassInfo* classInfo)
+{
+  if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+    return PythonQtConv::ConvertPythonToQt(info, obj, strict, classInfo);
+  }
+  void* ptr = NULL;
+  bool ok;
+  double val = PythonQtConv::PyObjGetDouble(obj, strict, ok);
+  if (ok) {
+    PythonQtValueStorage_ADD_VALUE(PythonQtConv::global_valueStorage, double, val, ptr);
+  }
+  return ptr;
+}
+
+static void* PythonQtConvertBoolArgument(const PythonQtMethodInfo::ParameterInfo& info, PyObject* obj, bool strict, PythonQtClassInfo* classInfo)
+{
+  if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+    return PythonQtConv::ConvertPythonToQt(info, obj, strict, classInfo);
+  }
+  void* ptr = NULL;
+  bool ok;
+  bool val = PythonQtConv::PyObjGetBool(obj, strict, ok);
+  if (ok) {
+    PythonQtValueStorage_ADD_VALUE(PythonQtConv::global_valueStorage, bool, val, ptr);
+  }
+  return ptr;
+}
+
+static void* PythonQtConvertQStringArgument(const PythonQtMethodInfo::ParameterInfo& info, PyObject* obj, bool strict, PythonQtClassInfo* classInfo)
+{
+  if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+    return PythonQtConv::ConvertPythonToQt(info, obj, strict, classInfo);
+  }
+  void* ptr = NULL;
+  bool ok;
+  QString str = PythonQtConv::PyObjGetString(obj, strict, ok);
+  if (ok) {
+    PythonQtValueStorage_ADD_VALUE(PythonQtConv::global_variantStorage, QVariant, QVariant(str), ptr);
+    ptr = (void*)((QVariant*)ptr)->constData();
+  }
+  return ptr;
+}
+
+static void* PythonQtConvertZeroCopyByteArrayArgument(const PythonQtMethodInfo::ParameterInfo& info, PyObject* obj, bool strict, PythonQtClassInfo* classInfo)
+{
+  if (!PyBytes_Check(obj)) {
+    // other threads may resize or release bytearray and memoryview objects while the slot runs with released GIL
+    return PythonQtConv::ConvertPythonToQt(info, obj, strict, classInfo);
+  }
+  // the bytes object is kept alive by the argument tuple until the slot call returns
+  void* ptr = NULL;
+  bool ok;
+  QByteArray bytes = PythonQtConv::PyObjGetBytesWithoutCopy(obj, ok);
+  if (ok) {
+    PythonQtValueStorage_ADD_VALUE(PythonQtConv::global_variantStorage, QVariant, QVariant(bytes), ptr);
+    ptr = (void*)((QVariant*)ptr)->constData();
+  }
+  return ptr;
+}
+
+static void* PythonQtConvertObjectPointerArgument(const PythonQtMethodInfo::ParameterInfo& info, PyObject* obj, bool strict, PythonQtClassInfo* classInfo)
+{
+  void* ptr = NULL;
+  if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+    bool ok;
+    void* object = PythonQtConv::castWrapperTo((PythonQtInstanceWrapper*)obj, info, ok);
+    if (ok) {
+      PythonQtValueStorage_ADD_VALUE(PythonQtConv::global_ptrStorage, void*, object, ptr);
+    }
+  } else if (obj == Py_None) {
+    // None is treated as a NULL ptr
+    PythonQtValueStorage_ADD_VALUE(PythonQtConv::global_ptrStorage, void*, NULL, ptr);
+  } else {
+    // foreign wrappers and 0 integers
+    ptr = PythonQtConv::ConvertPythonToQt(info, obj, strict, classInfo);
+  }
+  return ptr;
+}
+
+static PyObject* PythonQtConvertVoidReturnValue(const PythonQtMethodInfo::ParameterInfo& /*info*/, const void* /*data*/)
+{
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+static PyObject* PythonQtConvertIntReturnValue(const PythonQtMethodInfo::ParameterInfo& /*info*/, const void* data)
+{
+  return PyLong_FromLong(*((int*)data));
+}
+
+static PyObject* PythonQtConvertDoubleReturnValue(const PythonQtMethodInfo::ParameterInfo& /*info*/, const void* data)
+{
+  return PyFloat_FromDouble(*((double*)data));
+}
+
+static PyObject* PythonQtConvertBoolReturnValue(const PythonQtMethodInfo::ParameterInfo& /*info*/, const void* data)
+{
+  return PythonQtConv::GetPyBool(*((bool*)data));
+}
+
+static PyObject* PythonQtConvertQStringReturnValue(const PythonQtMethodInfo::ParameterInfo& /*info*/, const void* data)
+{
+  return PythonQtConv::QStringToPyObject(*((QString*)data));
+}
+
+static PyObject* PythonQtConvertObjectPointerReturnValue(const PythonQtMethodInfo::ParameterInfo& info, const void* data)
+{
+  return PythonQt::priv()->wrapPtr(*((void**)data), info.name);
+}
+
+
+void PythonQtConv::setByteArrayZeroCopyEnabled(bool enabled)
+{
+  if (_byteArrayZeroCopy != enabled) {
+    _byteArrayZeroCopy = enabled;
+    // the argument converters are cached by the slots
+    PythonQtSlotInfo::invalidateArgumentConverters();
+  }
+}
+
+void PythonQtConv::setSpecializedConvertersEnabled(bool enabled)
+{
+  if (_specializedConverters != enabled) {
+    _specializedConverters = enabled;
+    // the converters are cached by the slots
+    PythonQtSlotInfo::invalidateArgumentConverters();
+  }
+}
+
+PythonQtArgumentConverterCB* PythonQtConv::argumentConverter(const PythonQtMethodInfo::ParameterInfo& info, bool isSignal)
+{
+  if (_byteArrayZeroCopy && !isSignal && info.typeId == QMetaType::QByteArray && info.pointerCount == 0 && info.isConst) {
+    // signals are excluded, since queued connections keep a copy of the arguments after the call
+    return PythonQtConvertZeroCopyByteArrayArgument;
+  }
+  if (info.enumWrapper || !_specializedConverters) {
+    return PythonQtConvertGenericArgument;
+  }
+  if (info.pointerCount == 0) {
+    // these types are not handled by handlePythonToQtAutoConversion()
+    switch (info.typeId) {
+    case QMetaType::Int:
+      return PythonQtConvertIntArgument;
+    case QMetaType::Double:
+      return PythonQtConvertDoubleArgument;
+    case QMetaType::Bool:
+      return PythonQtConvertBoolArgument;
+    case QMetaType::QString:
+      return PythonQtConvertQStringArgument;
+    default:
+      break;
+    }
+  } else if (info.pointerCount == 1) {
+    if (info.typeId != QMetaType::Char && info.typeId != QMetaType::UChar &&
+        info.typeId != QMetaType::QString && info.typeId != QMetaType::Bool &&
+        info.typeId != PythonQtMethodInfo::Variant && info.name != "PyObject") {
+      return PythonQtConvertObjectPointerArgument;
+    }
+  }
+  return PythonQtConvertGenericArgument;
+}
+
+PythonQtReturnValueConverterCB* PythonQtConv::returnValueConverter(const PythonQtMethodInfo::ParameterInfo& info)
+{
+  if (info.enumWrapper || !_specializedConverters) {
+    return ConvertQtValueToPython;
+  }
+  if (info.typeId == QMetaType::Void) {
+    return PythonQtConvertVoidReturnValue;
+  }
+  if (info.pointerCount == 0) {
+    switch (info.typeId) {
+    case QMetaType::Int:
+      return PythonQtConvertIntReturnValue;
+    case QMetaType::Double:
+      return PythonQtConvertDoubleReturnValue;
+    case QMetaType::Bool:
+      return PythonQtConvertBoolReturnValue;
+    case QMetaType::QString:
+      return PythonQtConvertQStringReturnValue;
+    default:
+      break;
+    }
+  } else if (info.pointerCount == 1) {
+    // QList<Obj*> and registered meta types are handled by ConvertQtValueToPython()
+    if (info.typeId != QMetaType::Char && info.typeId < QMetaType::User &&
+        !(info.isQList && info.innerNamePointerCount == 1)) {
+      return PythonQtConvertObjectPointerReturnValue;
+    }
+  }
+  return ConvertQtValueToPython;
+}
+
 QStringList PythonQtConv::PyObjToStringList(PyObject* val, bool strict, bool& ok) {
   QStringList v;
   ok = false;
@@ -725,13 +983,39 @@ QString PythonQtConv::PyObjGetRepresentation(PyObject* val)
   return r;
 }
 
+#ifdef PYTHONQT_COMPACT_UNICODE
+//! converts a python unicode object to a QString, reading the compact Latin-1/UCS-2/UCS-4
+//! representation directly instead of going through an intermediate UTF-8 buffer
+static QString PythonQtConv_compactUnicodeToQString(PyObject* val)
+{
+  if (PyUnicode_READY(val) != 0) {
+    PyErr_Clear();
+    return QString();
+  }
+  Py_ssize_t length = PyUnicode_GET_LENGTH(val);
+  void* data = PyUnicode_DATA(val);
+  switch (PyUnicode_KIND(val)) {
+  case PyUnicode_1BYTE_KIND:
+    return QString::fromLatin1((const char*)data, (int)length);
+  case PyUnicode_2BYTE_KIND:
+    // UCS-2 is UTF-16 without surrogate pairs, so it can be copied as is
+    return QString((const QChar*)data, (int)length);
+  default:
+    // code points above the BMP need surrogate pairs
+    return QString::fromUcs4((const uint*)data, (int)length);
+  }
+}
+#endif
+
 QString PythonQtConv::PyObjGetString(PyObject* val, bool strict, bool& ok) {
   QString r;
   ok = true;
   if (val->ob_type == &PyBytes_Type) {
     r = QString(PyBytes_AS_STRING(val));
   } else if (PyUnicode_Check(val)) {
-#ifdef PY3K
+#ifdef PYTHONQT_COMPACT_UNICODE
+    r = PythonQtConv_compactUnicodeToQString(val);
+#elif defined(PY3K)
     r = QString::fromUtf8(PyUnicode_AsUTF8(val));
 #else
     PyObject *ptmp = PyUnicode_AsUTF8String(val);
@@ -743,7 +1027,9 @@ QString PythonQtConv::PyObjGetString(PyObject* val, bool strict, bool& ok) {
   } else if (!strict) {
     PyObject* str =  PyObject_Str(val);
     if (str) {
-#ifdef PY3K
+#ifdef PYTHONQT_COMPACT_UNICODE
+      r = PythonQtConv_compactUnicodeToQString(str);
+#elif defined(PY3K)
       r = QString::fromUtf8(PyUnicode_AsUTF8(str));
 #else
       r = QString(PyString_AS_STRING(str));
@@ -759,11 +1045,30 @@ QString PythonQtConv::PyObjGetString(PyObject* val, bool strict, bool& ok) {
 }
 
 QByteArray PythonQtConv::PyObjGetBytes(PyObject* val, bool /*strict*/, bool& ok) {
-  // TODO: support buffer objects in general
+  QByteArray r = PyObjGetBytesWithoutCopy(val, ok);
+  if (ok) {
+    // make a deep copy, since r references the data of val
+    r = QByteArray(r.constData(), r.size());
+  }
+  return r;
+}
+
+QByteArray PythonQtConv::PyObjGetBytesWithoutCopy(PyObject* val, bool& ok) {
   QByteArray r;
   ok = true;
   if (PyBytes_Check(val)) {
-    r = QByteArray(PyBytes_AS_STRING(val), PyBytes_GET_SIZE(val));
+    r = QByteArray::fromRawData(PyBytes_AS_STRING(val), PyBytes_GET_SIZE(val));
+  } else if (PyByteArray_Check(val)) {
+    r = QByteArray::fromRawData(PyByteArray_AS_STRING(val), PyByteArray_GET_SIZE(val));
+  } else if (PyMemoryView_Check(val)) {
+    // only views of bytes are accepted, so that e.g. arrays of numbers still select other overloads
+    Py_buffer* view = PyMemoryView_GET_BUFFER(val);
+    bool byteFormat = !view->format || qstrcmp(view->format, "B") == 0 || qstrcmp(view->format, "b") == 0 || qstrcmp(view->format, "c") == 0;
+    if (byteFormat && PyBuffer_IsContiguous(view, 'C')) {
+      r = QByteArray::fromRawData((const char*)view->buf, view->len);
+    } else {
+      ok = false;
+    }
   } else {
     ok = false;
   }
@@ -1187,9 +1492,38 @@ PyObject* PythonQtConv::QStringToPyObject(const QString& str)
 {
   if (str.isNull()) {
     return PyString_FromString("");
-  } else {
-    return PyUnicode_DecodeUTF16((const char*)str.utf16(), str.length()*2, NULL, NULL);
   }
+#ifdef PYTHONQT_COMPACT_UNICODE
+  const ushort* utf16 = str.utf16();
+  int length = str.length();
+  // branch free loop to find the widest character, so that the compiler can vectorize it
+  ushort maxChar = 0;
+  for (int i = 0; i < length; i++) {
+    maxChar = qMax(maxChar, utf16[i]);
+  }
+  bool hasSurrogates = false;
+  if (maxChar >= 0xd800) {
+    for (int i = 0; i < length; i++) {
+      hasSurrogates |= (utf16[i] & 0xf800) == 0xd800;
+    }
+  }
+  if (!hasSurrogates) {
+    PyObject* result = PyUnicode_New(length, maxChar);
+    if (result) {
+      if (PyUnicode_KIND(result) == PyUnicode_1BYTE_KIND) {
+        Py_UCS1* data = PyUnicode_1BYTE_DATA(result);
+        for (int i = 0; i < length; i++) {
+          data[i] = (Py_UCS1)utf16[i];
+        }
+      } else {
+        memcpy(PyUnicode_2BYTE_DATA(result), utf16, length * sizeof(Py_UCS2));
+      }
+    }
+    return result;
+  }
+  // surrogate pairs need to be combined, leave this to the codec
+#endif
+  return PyUnicode_DecodeUTF16((const char*)str.utf16(), str.length()*2, NULL, NULL);
 }
 
 PyObject* PythonQtConv::QStringListToPyObject(const QStringList& list)
@@ -1273,8 +1607,42 @@ PyObject* PythonQtConv::QVariantListToPyObject(const QVariantList& l) {
   return result;
 }
 
+//! sequence view data on a list of pointers, which are wrapped with wrapPtr().
+//! QObjects are tracked with QPointers, so deleted objects are returned as None.
+class PythonQtSequenceViewOfPointers : public PythonQtSequenceViewData
+{
+public:
+  PythonQtSequenceViewOfPointers(const QList<void*>& list, const QByteArray& typeName):_typeName(typeName) {
+    PythonQtClassInfo* info = PythonQt::priv()->getClassInfo(typeName);
+    if ((info && info->isQObject()) || PythonQt::priv()->isKnownQObjectClassName(typeName)) {
+      Q_FOREACH (void* value, list) {
+        _objects.append(QPointer<QObject>((QObject*)value));
+      }
+    } else {
+      _list = list;
+    }
+  }
+
+  virtual int size() const { return _objects.isEmpty() ? _list.size() : _objects.size(); }
+  virtual PyObject* item(int index) const {
+    if (_objects.isEmpty()) {
+      return PythonQt::priv()->wrapPtr(_list.at(index), _typeName);
+    }
+    // wrapPtr() returns None for the NULL pointer of a deleted object
+    return PythonQt::priv()->wrapPtr(_objects.at(index).data(), _typeName);
+  }
+
+private:
+  QList<void*> _list;
+  QList<QPointer<QObject> > _objects;
+  QByteArray _typeName;
+};
+
 PyObject* PythonQtConv::ConvertQListOfPointerTypeToPythonList(QList<void*>* list, const QByteArray& typeName)
 {
+  if (_sequenceViews) {
+    return PythonQtSequenceView_New(new PythonQtSequenceViewOfPointers(*list, typeName));
+  }
   PyObject* result = PyTuple_New(list->count());
   int i = 0;
   Q_FOREACH (void* value, *list) {
@@ -1394,6 +1762,11 @@ QString PythonQtConv::CPPObjectToString(int type, const void* data) {
 
 PyObject* PythonQtConv::createCopyFromMetaType( int type, const void* data )
 {
+  // small value types are copied into the wrapper itself
+  PyObject* inlineCopy = PythonQt::priv()->createInlineCopyFromMetaType(type, data);
+  if (inlineCopy) {
+    return inlineCopy;
+  }
   // if the type is known, we can construct it via QMetaType::construct
 #if( QT_VERSION >= QT_VERSION_CHECK(5,0,0) )
   void* newCPPObject = QMetaType::create(type, data);
@@ -46,6 +46,8 @@
 #include "PythonQtMisc.h"
 #include "PythonQtClassInfo.h"
 #include "PythonQtMethodInfo.h"
+#include "PythonQtSequenceView.h"
+#include "PythonQtNumericBuffer.h"
 
 #include <QWidget>
 #include <QList>
@@ -129,8 +131,11 @@ public:
   static QString PyObjGetString(PyObject* val) { bool ok; QString s = PyObjGetString(val, false, ok); return s; }
   //! get string value from py object
   static QString PyObjGetString(PyObject* val, bool strict, bool &ok);
-  //! get bytes from py object
+  //! get bytes from a bytes, bytearray or contiguous memoryview object (of a byte format)
   static QByteArray PyObjGetBytes(PyObject* val, bool strict, bool &ok);
+  //! get bytes from a bytes, bytearray or contiguous memoryview object (of a byte format) without copying them, the returned QByteArray
+  //! references the data of \c val, so it must not be used after \c val was modified or deleted
+  static QByteArray PyObjGetBytesWithoutCopy(PyObject* val, bool& ok);
   //! get int from py object
   static int     PyObjGetInt(PyObject* val, bool strict, bool &ok);
   //! get int64 from py object
@@ -159,6 +164,44 @@ public:
   //! get human readable string from CPP object (when the metatype is known)
   static QString CPPObjectToString(int type, const void* data);
     
+  //! enable/disable passing QByteArray data between Python and Qt without copying it (disabled by default).
+  //! If enabled, bytes objects are passed to const QByteArray& parameters of slots by reference, so the slot must
+  //! not keep a copy of the QByteArray beyond the call (the mutable bytearray and memoryview objects are still copied,
+  //! as are the arguments of signals emitted from Python, since queued connections keep them after the call).
+  //! QByteArray return values and signal arguments are converted to read-only memoryview objects
+  //! that share the data of the QByteArray instead of wrapped QByteArray copies.
+  static void setByteArrayZeroCopyEnabled(bool enabled);
+
+  //! returns if QByteArray data is passed without copying it
+  static bool byteArrayZeroCopyEnabled() { return _byteArrayZeroCopy; }
+
+  //! enable/disable returning lists (QList, QVector, std::vector, QStringList and lists of pointers) as lazy sequence
+  //! views instead of tuples (disabled by default). A view shares the data of the returned list and converts an element
+  //! only when it is accessed, use list() or tuple() on the view to convert all elements.
+  //! Note that the objects in lists of pointers are only wrapped on access, so they must still exist at that time
+  //! (QObjects are tracked, a deleted QObject is returned as None).
+  static void setSequenceViewsEnabled(bool enabled) { _sequenceViews = enabled; }
+
+  //! returns if lists are returned as lazy sequence views
+  static bool sequenceViewsEnabled() { return _sequenceViews; }
+
+  //! enable/disable returning numeric lists (QList, QVector and std::vector of int, unsigned int, qint64, quint64, float and double)
+  //! as read-only memoryview objects instead of tuples (disabled by default). The memoryview shares the data of a QVector
+  //! and holds a single copy of other containers, it can be passed to array, bytes or NumPy without creating an object per element.
+  //! Independent of this setting, contiguous buffers with a matching element type are always accepted for such lists and copied at once.
+  static void setNumericBuffersEnabled(bool enabled) { _numericBuffers = enabled; }
+
+  //! returns if numeric lists are returned as memoryview objects
+  static bool numericBuffersEnabled() { return _numericBuffers; }
+
+  //! enable/disable the specialized argument and return value converters of slots for common types (enabled by default).
+  //! If disabled, all slot arguments and return values are converted by ConvertPythonToQt() and ConvertQtValueToPython(),
+  //! which is only useful to compare the performance of both. Must not be called while slots are executed.
+  static void setSpecializedConvertersEnabled(bool enabled);
+
+  //! returns if the specialized slot argument and return value converters are used
+  static bool specializedConvertersEnabled() { return _specializedConverters; }
+
   //! register a converter callback from python to cpp for given metatype
   static void registerPythonToMetaTypeConverter(int metaTypeId, PythonQtConvertPythonToMetaTypeCB* cb) { _pythonToMetaTypeConverters.insert(metaTypeId, cb); }
 
@@ -174,15 +217,34 @@ public:
   //! cast wrapper to given className if possible
   static void* castWrapperTo(PythonQtInstanceWrapper* wrapper, const QByteArray& className, bool& ok);
 
+  //! casts the wrapper to the class of \c classInfo (uses the cast cache of the wrapper's class info)
+  static void* castWrapperTo(PythonQtInstanceWrapper* wrapper, PythonQtClassInfo* classInfo, bool& ok);
+
+  //! casts the wrapper to the type of the parameter, whose class info is resolved once
+  static void* castWrapperTo(PythonQtInstanceWrapper* wrapper, const PythonQtMethodInfo::ParameterInfo& info, bool& ok);
+
+  //! returns the converter that is used to pass a Python object as the given slot argument,
+  //! this is a specialized converter for common types and ConvertPythonToQt() for all others
+  //! (\c isSignal is set for the parameters of signals, which never get shared QByteArray data)
+  static PythonQtArgumentConverterCB* argumentConverter(const PythonQtMethodInfo::ParameterInfo& info, bool isSignal = false);
+
+  //! returns the converter that is used to convert the given slot return value to Python,
+  //! this is a specialized converter for common types and ConvertQtValueToPython() for all others
+  static PythonQtReturnValueConverterCB* returnValueConverter(const PythonQtMethodInfo::ParameterInfo& info);
+
 public:
 
-  static PythonQtValueStorage<qint64, 128>  global_valueStorage;
-  static PythonQtValueStorage<void*, 128>   global_ptrStorage;
-  static PythonQtValueStorageWithCleanup<QVariant, 128>  global_variantStorage;
+  static PythonQtThreadLocalValueStorage<PythonQtValueStorage<qint64, 128> >  global_valueStorage;
+  static PythonQtThreadLocalValueStorage<PythonQtValueStorage<void*, 128> >   global_ptrStorage;
+  static PythonQtThreadLocalValueStorage<PythonQtValueStorageWithCleanup<QVariant, 128> >  global_variantStorage;
 
 protected:
   static QHash<int, PythonQtConvertMetaTypeToPythonCB*> _metaTypeToPythonConverters; 
   static QHash<int, PythonQtConvertPythonToMetaTypeCB*> _pythonToMetaTypeConverters; 
+  static bool _byteArrayZeroCopy;
+  static bool _sequenceViews;
+  static bool _numericBuffers;
+  static bool _specializedConverters;
  
   //! handle automatic conversion of some special types (QColor, QBrush, ...)
   static void* handlePythonToQtAutoConversion(int typeId, PyObject* obj, void* alreadyAllocatedCPPObject);
@@ -200,6 +262,41 @@ protected:
   static PyObject* mapToPython (const Map& m);
 };
 
+//! sequence view data on a list of value types, which are converted with ConvertQtValueToPythonInternal()
+template<class ListType, class T>
+class PythonQtSequenceViewOfValueTypes : public PythonQtSequenceViewData
+{
+public:
+  PythonQtSequenceViewOfValueTypes(const ListType& list, int innerType):_list(list), _innerType(innerType) {}
+
+  virtual int size() const { return int(_list.size()); }
+  virtual PyObject* item(int index) const { return PythonQtConv::ConvertQtValueToPythonInternal(_innerType, &_list[index]); }
+
+private:
+  ListType _list;
+  int _innerType;
+};
+
+//! sequence view data on a list of known classes, which are wrapped as copies owned by PythonQt
+template<class ListType, class T>
+class PythonQtSequenceViewOfKnownClasses : public PythonQtSequenceViewData
+{
+public:
+  PythonQtSequenceViewOfKnownClasses(const ListType& list, PythonQtClassInfo* innerType):_list(list), _innerType(innerType) {}
+
+  virtual int size() const { return int(_list.size()); }
+  virtual PyObject* item(int index) const {
+    T* newObject = new T(_list[index]);
+    PythonQtInstanceWrapper* wrap = (PythonQtInstanceWrapper*)PythonQt::priv()->wrapPtr(newObject, _innerType->className());
+    wrap->_ownedByPythonQt = true;
+    return (PyObject*)wrap;
+  }
+
+private:
+  ListType _list;
+  PythonQtClassInfo* _innerType;
+};
+
 template<class ListType, class T>
 PyObject* PythonQtConvertListOfValueTypeToPythonList(const void* /*QList<T>* */ inList, int metaTypeId)
 {
@@ -208,6 +305,12 @@ PyObject* PythonQtConvertListOfValueTypeToPythonList(const void* /*QList<T>* */
   if (innerType == QVariant::Invalid) {
     std::cerr << "PythonQtConvertListOfValueTypeToPythonList: unknown inner type " << QMetaType::typeName(metaTypeId) << std::endl;
   }
+  if (PythonQtNumericBufferFormat<T>::format() && PythonQtConv::numericBuffersEnabled()) {
+    return PythonQtNumericBuffer_FromList(*list);
+  }
+  if (PythonQtConv::sequenceViewsEnabled()) {
+    return PythonQtSequenceView_New(new PythonQtSequenceViewOfValueTypes<ListType, T>(*list, innerType));
+  }
   PyObject* result = PyTuple_New(list->size());
   int i = 0;
   Q_FOREACH (const T& value, *list) {
@@ -225,6 +328,14 @@ bool PythonQtConvertPythonListToListOfValueType(PyObject* obj, void* /*QList<T>*
   if (innerType == QVariant::Invalid) {
     std::cerr << "PythonQtConvertPythonListToListOfValueType: unknown inner type " << QMetaType::typeName(metaTypeId) << std::endl;
   }
+  const char* format = PythonQtNumericBufferFormat<T>::format();
+  Py_buffer view;
+  if (format && PythonQtNumericBuffer_GetContiguous(obj, format, sizeof(T), &view)) {
+    // copy all elements at once instead of converting each of them via QVariant
+    PythonQtNumericBuffer_AssignTo(*list, (const T*)view.buf, int(view.len / sizeof(T)));
+    PyBuffer_Release(&view);
+    return true;
+  }
   bool result = false;
   if (PySequence_Check(obj)) {
     int count = PySequence_Size(obj);
@@ -257,6 +368,9 @@ PyObject* PythonQtConvertListOfKnownClassToPythonList(const void* /*QList<T>* */
   if (innerType == NULL) {
     std::cerr << "PythonQtConvertListOfKnownClassToPythonList: unknown inner type " << innerType->className().constData() << std::endl;
   }
+  if (PythonQtConv::sequenceViewsEnabled()) {
+    return PythonQtSequenceView_New(new PythonQtSequenceViewOfKnownClasses<ListType, T>(*list, innerType));
+  }
   PyObject* result = PyTuple_New(list->size());
   int i = 0;
   Q_FOREACH(const T& value, *list) {
@@ -288,7 +402,7 @@ bool PythonQtConvertPythonListToListOfKnownClass(PyObject* obj, void* /*QList<T>
         if (PyObject_TypeCheck(value, &PythonQtInstanceWrapper_Type)) {
           PythonQtInstanceWrapper* wrap = (PythonQtInstanceWrapper*)value;
           bool ok;
-          T* object = (T*)PythonQtConv::castWrapperTo(wrap, innerType->className(), ok);
+          T* object = (T*)PythonQtConv::castWrapperTo(wrap, innerType, ok);
           if (ok) {
             list->push_back(*object);
           } else {
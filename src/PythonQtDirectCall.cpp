@@ -0,0 +1,131 @@
+/*
+*
+*  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  Further, this software is distributed without any warranty that it is
+*  free of the rightful claim of any third person regarding infringement
+*  or the like.  Any license provided herein, whether implied or
+*  otherwise, applies only to this software file.  Patent licenses, if
+*  any, provided herein do not apply to combinations of this program with
+*  other software, or any other product whatsoever.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*
+*  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+*  28359 Bremen, Germany or:
+*
+*  http://www.mevis.de
+*
+*/
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtDirectCall.cpp
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtDirectCall.h"
+#include "PythonQt.h"
+#include "PythonQtProfiler.h"
+
+#include <stdexcept>
+#include <new>
+
+PythonQtDirectCallContext::PythonQtDirectCallContext(PythonQtClassInfo* classInfo, PythonQtSlotInfo* info, QObject* objectToCall, PyObject* args, bool strict)
+{
+  _classInfo = classInfo;
+  _info = info;
+  _objectToCall = objectToCall;
+  _args = args;
+  _converters = info->argumentConverters();
+  // the first parameter is the return value, instance decorators get the wrapped object as second parameter
+  _firstParameter = info->isInstanceDecorator() ? 2 : 1;
+  _strict = strict;
+  // release the GIL while the C++ code runs, unless the slot deals with Python objects itself
+  _releaseGIL = PythonQtThreadSupport::isEnabled() && !info->usesPythonObjects();
+  _entered = false;
+  _profiled = false;
+  _cppStartTime = 0;
+  _cppEndTime = 0;
+}
+
+void* PythonQtDirectCallContext::convertArgument(PyObject* args, int index)
+{
+  const PythonQtArgumentConverter& converter = _converters[_firstParameter + index];
+  return (*converter.toQt)(*converter.info, PyTuple_GET_ITEM(args, index), _strict, _classInfo);
+}
+
+PyObject* PythonQtDirectCallContext::convertReturnValue(const void* data)
+{
+  return (*_converters[0].toPython)(*_converters[0].info, data);
+}
+
+void PythonQtDirectCallContext::enter()
+{
+  PythonQt::ProfilingCB* profilingCB = PythonQt::priv()->profilingCB();
+  if (profilingCB) {
+    const char* className = NULL;
+    if (_info->decorator()) {
+      className = _info->decorator()->metaObject()->className();
+    } else if (_objectToCall) {
+      className = _objectToCall->metaObject()->className();
+    }
+    profilingCB(PythonQt::Enter, className, _info->signature(), _args);
+  }
+  _entered = true;
+  if (PythonQtProfiler::isEnabled()) {
+    _profiled = true;
+    _cppStartTime = PythonQtProfiler::now();
+  }
+}
+
+void PythonQtDirectCallContext::leave()
+{
+  if (!_entered) {
+    return;
+  }
+  _entered = false;
+  if (_profiled) {
+    _cppEndTime = PythonQtProfiler::now();
+  }
+  PythonQt::ProfilingCB* profilingCB = PythonQt::priv()->profilingCB();
+  if (profilingCB) {
+    profilingCB(PythonQt::Leave, NULL, NULL, NULL);
+  }
+}
+
+void PythonQtDirectCallContext::setException(const std::exception& e)
+{
+  // the same mapping as in PythonQtCallSlot()
+  PyObject* type = PyExc_RuntimeError;
+  QByteArray what("std::exception: ");
+  if (dynamic_cast<const std::out_of_range*>(&e)) {
+    type = PyExc_IndexError;
+    what = "std::out_of_range: ";
+  } else if (dynamic_cast<const std::bad_alloc*>(&e)) {
+    type = PyExc_MemoryError;
+    what = "std::bad_alloc: ";
+  } else if (dynamic_cast<const std::runtime_error*>(&e)) {
+    what = "std::runtime_error: ";
+  } else if (dynamic_cast<const std::logic_error*>(&e)) {
+    what = "std::logic_error: ";
+  }
+  what += e.what();
+  PyErr_SetString(type, what.constData());
+}
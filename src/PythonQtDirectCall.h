@@ -0,0 +1,260 @@
+#ifndef _PYTHONQTDIRECTCALL_H
+#define _PYTHONQTDIRECTCALL_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtDirectCall.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+#include "PythonQtSystem.h"
+#include "PythonQtMethodInfo.h"
+#include "PythonQtConversion.h"
+#include "PythonQtInstanceWrapper.h"
+#include "PythonQtThreadSupport.h"
+
+#include <QString>
+#include <exception>
+#include <climits>
+
+class PythonQtClassInfo;
+
+//! The state of a call of a direct call, which the generator creates for each wrapper slot with --direct-calls.
+//! A direct call converts the items of the Python argument tuple with PythonQtDirectArgument into typed C++ values,
+//! calls the wrapper slot as a normal C++ method and converts its result with PythonQtDirectReturnValue(),
+//! so the qt_metacall dispatch and its void* argument list are not needed.
+//! Direct calls are only invoked by PythonQtCallSlot(), which also resets the value storages afterwards.
+class PYTHONQT_EXPORT PythonQtDirectCallContext
+{
+public:
+  PythonQtDirectCallContext(PythonQtClassInfo* classInfo, PythonQtSlotInfo* info, QObject* objectToCall, PyObject* args, bool strict);
+
+  //! returns if the arguments are converted strictly (the first pass of the overload resolution)
+  bool strict() const { return _strict; }
+
+  //! returns if the GIL can be released while the C++ method runs
+  bool releaseGIL() const { return _releaseGIL; }
+
+  //! converts the argument at \c index of the argument tuple with the precompiled converter of the slot parameter,
+  //! returns a pointer to the converted value in the global value storages or NULL if the argument does not match
+  void* convertArgument(PyObject* args, int index);
+
+  //! converts the C++ return value with the precompiled converter of the slot
+  PyObject* convertReturnValue(const void* data);
+
+  //! must be called right before the C++ method is called (calls the profiling callback and records the time)
+  void enter();
+  //! must be called after the C++ method returned or threw an exception, it may be called more than once
+  void leave();
+
+  //! sets the Python exception for a C++ exception thrown by the method
+  void setException(const std::exception& e);
+
+  //! returns if enter() was called while the built-in profiler was enabled
+  bool profiled() const { return _profiled; }
+  //! the time at which the C++ method was called (if profiled)
+  qint64 cppStartTime() const { return _cppStartTime; }
+  //! the time at which the C++ method returned (if profiled)
+  qint64 cppEndTime() const { return _cppEndTime; }
+
+private:
+  PythonQtClassInfo* _classInfo;
+  PythonQtSlotInfo*  _info;
+  QObject*           _objectToCall;
+  PyObject*          _args;
+  const PythonQtArgumentConverter* _converters;
+  int                _firstParameter;
+  bool               _strict;
+  bool               _releaseGIL;
+  bool               _entered;
+  bool               _profiled;
+  qint64             _cppStartTime;
+  qint64             _cppEndTime;
+};
+
+//! Converts an item of the argument tuple of a direct call to the C++ type \c T.
+//! The general version uses the precompiled converter of the slot parameter and refers to the converted value
+//! in the global value storages, the specializations below convert common types into a member instead.
+template <class T> class PythonQtDirectArgument
+{
+public:
+  PythonQtDirectArgument():_value(NULL) {}
+
+  //! converts the argument at \c index of \c args, returns false if it does not match the parameter type
+  bool convert(PythonQtDirectCallContext& context, PyObject* args, int index) {
+    _value = (T*)context.convertArgument(args, index);
+    return _value != NULL;
+  }
+
+  //! the converted value (valid after convert() returned true)
+  T& value() { return *_value; }
+
+private:
+  T* _value;
+};
+
+template <> class PythonQtDirectArgument<int>
+{
+public:
+  PythonQtDirectArgument():_value(0) {}
+
+  bool convert(PythonQtDirectCallContext& context, PyObject* args, int index) {
+    PyObject* obj = PyTuple_GET_ITEM(args, index);
+    if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+      // a wrapped object might be convertible via a registered converter
+      void* ptr = context.convertArgument(args, index);
+      if (ptr) {
+        _value = *(int*)ptr;
+      }
+      return ptr != NULL;
+    }
+    bool ok;
+    qint64 val = PythonQtConv::PyObjGetLongLong(obj, context.strict(), ok);
+    _value = (int)val;
+    return ok && val >= INT_MIN && val <= INT_MAX;
+  }
+
+  int& value() { return _value; }
+
+private:
+  int _value;
+};
+
+template <> class PythonQtDirectArgument<double>
+{
+public:
+  PythonQtDirectArgument():_value(0) {}
+
+  bool convert(PythonQtDirectCallContext& context, PyObject* args, int index) {
+    PyObject* obj = PyTuple_GET_ITEM(args, index);
+    if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+      void* ptr = context.convertArgument(args, index);
+      if (ptr) {
+        _value = *(double*)ptr;
+      }
+      return ptr != NULL;
+    }
+    bool ok;
+    _value = PythonQtConv::PyObjGetDouble(obj, context.strict(), ok);
+    return ok;
+  }
+
+  double& value() { return _value; }
+
+private:
+  double _value;
+};
+
+template <> class PythonQtDirectArgument<bool>
+{
+public:
+  PythonQtDirectArgument():_value(false) {}
+
+  bool convert(PythonQtDirectCallContext& context, PyObject* args, int index) {
+    PyObject* obj = PyTuple_GET_ITEM(args, index);
+    if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+      void* ptr = context.convertArgument(args, index);
+      if (ptr) {
+        _value = *(bool*)ptr;
+      }
+      return ptr != NULL;
+    }
+    bool ok;
+    _value = PythonQtConv::PyObjGetBool(obj, context.strict(), ok);
+    return ok;
+  }
+
+  bool& value() { return _value; }
+
+private:
+  bool _value;
+};
+
+template <> class PythonQtDirectArgument<QString>
+{
+public:
+  bool convert(PythonQtDirectCallContext& context, PyObject* args, int index) {
+    PyObject* obj = PyTuple_GET_ITEM(args, index);
+    if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+      void* ptr = context.convertArgument(args, index);
+      if (ptr) {
+        _value = *(QString*)ptr;
+      }
+      return ptr != NULL;
+    }
+    bool ok;
+    _value = PythonQtConv::PyObjGetString(obj, context.strict(), ok);
+    return ok;
+  }
+
+  QString& value() { return _value; }
+
+private:
+  QString _value;
+};
+
+//! converts the return value of a direct call to a new Python object, the general version uses the
+//! precompiled converter of the slot (so \c value must have the type of the slot's return value)
+template <class T> inline PyObject* PythonQtDirectReturnValue(PythonQtDirectCallContext& context, const T& value)
+{
+  return context.convertReturnValue(&value);
+}
+
+template <> inline PyObject* PythonQtDirectReturnValue<int>(PythonQtDirectCallContext& /*context*/, const int& value)
+{
+  return PyLong_FromLong(value);
+}
+
+template <> inline PyObject* PythonQtDirectReturnValue<double>(PythonQtDirectCallContext& /*context*/, const double& value)
+{
+  return PyFloat_FromDouble(value);
+}
+
+template <> inline PyObject* PythonQtDirectReturnValue<bool>(PythonQtDirectCallContext& /*context*/, const bool& value)
+{
+  return PythonQtConv::GetPyBool(value);
+}
+
+template <> inline PyObject* PythonQtDirectReturnValue<QString>(PythonQtDirectCallContext& /*context*/, const QString& value)
+{
+  return PythonQtConv::QStringToPyObject(value);
+}
+
+#endif
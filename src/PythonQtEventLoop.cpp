@@ -0,0 +1,299 @@
+/*
+*
+*  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  Further, this software is distributed without any warranty that it is
+*  free of the rightful claim of any third person regarding infringement
+*  or the like.  Any license provided herein, whether implied or
+*  otherwise, applies only to this software file.  Patent licenses, if
+*  any, provided herein do not apply to combinations of this program with
+*  other software, or any other product whatsoever.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*
+*  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+*  28359 Bremen, Germany or:
+*
+*  http://www.mevis.de
+*
+*/
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtEventLoop.cpp
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtEventLoop.h"
+
+#include <QSocketNotifier>
+#include <QEventLoop>
+#include <QThread>
+
+PythonQtEventLoopHelper::PythonQtEventLoopHelper(QObject* parent)
+  : QObject(parent)
+{
+  _timer.setSingleShot(true);
+#if QT_VERSION >= QT_VERSION_CHECK(5,0,0)
+  // a coarse timer may fire early, which would cause an additional step
+  _timer.setTimerType(Qt::PreciseTimer);
+#endif
+  connect(&_timer, SIGNAL(timeout()), this, SIGNAL(stepRequested()));
+}
+
+PythonQtEventLoopHelper::~PythonQtEventLoopHelper()
+{
+  for (int type = 0; type < 2; type++) {
+    qDeleteAll(_notifiers[type]);
+  }
+}
+
+void PythonQtEventLoopHelper::scheduleStep(int msecs)
+{
+  if (QThread::currentThread() != thread()) {
+    // the timer can only be started from the thread of the helper
+    QMetaObject::invokeMethod(this, "scheduleStep", Qt::QueuedConnection, Q_ARG(int, msecs));
+    return;
+  }
+  if (msecs < 0) {
+    _timer.stop();
+  } else {
+    _timer.start(msecs);
+  }
+}
+
+void PythonQtEventLoopHelper::setSocketNotifierEnabled(int fd, int type, bool enabled)
+{
+  QSocketNotifier* notifier = _notifiers[type].value(fd);
+  if (!notifier) {
+    notifier = new QSocketNotifier(fd, type == 0 ? QSocketNotifier::Read : QSocketNotifier::Write);
+    connect(notifier, SIGNAL(activated(int)), this, SLOT(socketNotifierActivated(int)));
+    _notifiers[type].insert(fd, notifier);
+  }
+  notifier->setEnabled(enabled);
+}
+
+void PythonQtEventLoopHelper::removeSocketNotifier(int fd, int type)
+{
+  QSocketNotifier* notifier = _notifiers[type].take(fd);
+  if (notifier) {
+    notifier->setEnabled(false);
+    // the notifier may be removed while its activated() signal is handled
+    notifier->deleteLater();
+  }
+}
+
+void PythonQtEventLoopHelper::runEventLoop()
+{
+  QEventLoop loop;
+  _eventLoops.append(&loop);
+  loop.exec();
+  _eventLoops.removeLast();
+}
+
+void PythonQtEventLoopHelper::quitEventLoop()
+{
+  if (!_eventLoops.isEmpty()) {
+    _eventLoops.last()->quit();
+  }
+}
+
+void PythonQtEventLoopHelper::socketNotifierActivated(int fd)
+{
+  QSocketNotifier* notifier = qobject_cast<QSocketNotifier*>(sender());
+  if (notifier) {
+    // level triggered notifiers would fire again until the loop has read/written the socket
+    notifier->setEnabled(false);
+    emit socketActivated(fd, notifier->type() == QSocketNotifier::Read ? 0 : 1);
+  }
+}
+
+const char* PythonQtEventLoopHelper::moduleSource()
+{
+  return
+"import asyncio\n"
+"import asyncio.events\n"
+"import math\n"
+"import selectors\n"
+"import threading\n"
+"\n"
+"_EVENTS = ((0, selectors.EVENT_READ), (1, selectors.EVENT_WRITE))\n"
+"\n"
+"class QtSelector(selectors._BaseSelectorImpl):\n"
+"  \"\"\"selector that watches the registered files with QSocketNotifiers, select() never blocks\"\"\"\n"
+"\n"
+"  def __init__(self, helper):\n"
+"    super().__init__()\n"
+"    self._helper = helper\n"
+"    self._readyEvents = {}\n"
+"\n"
+"  def register(self, fileobj, events, data=None):\n"
+"    key = super().register(fileobj, events, data)\n"
+"    self._updateNotifiers(key.fd, events)\n"
+"    return key\n"
+"\n"
+"  def unregister(self, fileobj):\n"
+"    key = super().unregister(fileobj)\n"
+"    self._updateNotifiers(key.fd, 0)\n"
+"    self._readyEvents.pop(key.fd, None)\n"
+"    return key\n"
+"\n"
+"  def select(self, timeout=None):\n"
+"    ready = []\n"
+"    for fd, events in self._readyEvents.items():\n"
+"      key = self._fd_to_key.get(fd)\n"
+"      if key is not None and events & key.events:\n"
+"        ready.append((key, events & key.events))\n"
+"        # the notifiers were disabled on activation until the event is dispatched\n"
+"        self._updateNotifiers(fd, key.events)\n"
+"    self._readyEvents.clear()\n"
+"    return ready\n"
+"\n"
+"  def close(self):\n"
+"    for fd in list(self._fd_to_key):\n"
+"      self._updateNotifiers(fd, 0)\n"
+"    super().close()\n"
+"\n"
+"  def _updateNotifiers(self, fd, events):\n"
+"    for type, mask in _EVENTS:\n"
+"      if events & mask:\n"
+"        self._helper.setSocketNotifierEnabled(fd, type, True)\n"
+"      else:\n"
+"        self._helper.removeSocketNotifier(fd, type)\n"
+"\n"
+"  def _socketActivated(self, fd, type):\n"
+"    self._readyEvents[fd] = self._readyEvents.get(fd, 0) | _EVENTS[type][1]\n"
+"\n"
+"\n"
+"class QtEventLoop(asyncio.SelectorEventLoop):\n"
+"  \"\"\"asyncio event loop that is driven by the Qt event loop.\n"
+"\n"
+"  After start() has been called, the callbacks, timers and socket events of the loop are dispatched\n"
+"  by the Qt event loop, so coroutines run while the application is in QApplication.exec().\n"
+"  run_forever() and run_until_complete() run a local Qt event loop.\"\"\"\n"
+"\n"
+"  def __init__(self, helper):\n"
+"    self._helper = helper\n"
+"    self._processing = False\n"
+"    self._localLoops = 0\n"
+"    super().__init__(QtSelector(helper))\n"
+"    helper.stepRequested.connect(self._step)\n"
+"    helper.socketActivated.connect(self._socketActivated)\n"
+"\n"
+"  def start(self):\n"
+"    \"\"\"starts dispatching the loop from the Qt event loop\"\"\"\n"
+"    self._check_closed()\n"
+"    if self._thread_id is None:\n"
+"      self._thread_id = threading.get_ident()\n"
+"      self._scheduleStep()\n"
+"\n"
+"  def run_forever(self):\n"
+"    self._check_closed()\n"
+"    self._check_running()\n"
+"    started = self._thread_id is None\n"
+"    self.start()\n"
+"    self._localLoops += 1\n"
+"    try:\n"
+"      self._helper.runEventLoop()\n"
+"    finally:\n"
+"      self._localLoops -= 1\n"
+"      self._stopping = False\n"
+"      if started:\n"
+"        self._thread_id = None\n"
+"\n"
+"  def stop(self):\n"
+"    super().stop()\n"
+"    self._scheduleStep()\n"
+"\n"
+"  def close(self):\n"
+"    self._helper.scheduleStep(-1)\n"
+"    self._thread_id = None\n"
+"    super().close()\n"
+"\n"
+"  def _check_running(self):\n"
+"    if self._processing or self._localLoops:\n"
+"      raise RuntimeError(\"This event loop is already running\")\n"
+"\n"
+"  def _call_soon(self, *args, **kwargs):\n"
+"    handle = super()._call_soon(*args, **kwargs)\n"
+"    self._scheduleStep()\n"
+"    return handle\n"
+"\n"
+"  def call_at(self, *args, **kwargs):\n"
+"    handle = super().call_at(*args, **kwargs)\n"
+"    self._scheduleStep()\n"
+"    return handle\n"
+"\n"
+"  def _socketActivated(self, fd, type):\n"
+"    self._selector._socketActivated(fd, type)\n"
+"    self._scheduleStep()\n"
+"\n"
+"  def _scheduleStep(self):\n"
+"    # while a step is processed, the next step is scheduled when it is finished,\n"
+"    # other threads (call_soon_threadsafe) wake up the loop via the self-pipe notifier\n"
+"    if not self._processing and self._thread_id == threading.get_ident() and not self.is_closed():\n"
+"      self._helper.scheduleStep(0)\n"
+"\n"
+"  def _step(self):\n"
+"    if self._processing or self._thread_id is None or self.is_closed():\n"
+"      return\n"
+"    self._processing = True\n"
+"    oldLoop = asyncio.events._get_running_loop()\n"
+"    asyncio.events._set_running_loop(self)\n"
+"    try:\n"
+"      self._run_once()\n"
+"    finally:\n"
+"      asyncio.events._set_running_loop(oldLoop)\n"
+"      self._processing = False\n"
+"    if self._stopping and self._localLoops:\n"
+"      self._stopping = False\n"
+"      self._helper.quitEventLoop()\n"
+"    if self._ready:\n"
+"      self._helper.scheduleStep(0)\n"
+"    elif self._scheduled:\n"
+"      timeout = max(0, self._scheduled[0]._when - self.time())\n"
+"      self._helper.scheduleStep(int(math.ceil(timeout * 1000)))\n"
+"    else:\n"
+"      self._helper.scheduleStep(-1)\n"
+"\n"
+"\n"
+"def awaitSignal(signal):\n"
+"  \"\"\"returns an awaitable iterator that is finished when the signal is emitted (used by the __await__ of signals)\"\"\"\n"
+"  loop = asyncio.get_event_loop()\n"
+"  future = loop.create_future()\n"
+"  def handler(*args):\n"
+"    signal.disconnect(handler)\n"
+"    if not future.done():\n"
+"      if len(args) == 0:\n"
+"        future.set_result(None)\n"
+"      elif len(args) == 1:\n"
+"        future.set_result(args[0])\n"
+"      else:\n"
+"        future.set_result(args)\n"
+"  signal.connect(handler)\n"
+"  return future.__await__()\n"
+"\n"
+"\n"
+"def install():\n"
+"  \"\"\"creates a QtEventLoop, makes it the current event loop and starts it\"\"\"\n"
+"  loop = QtEventLoop(_helper)\n"
+"  asyncio.set_event_loop(loop)\n"
+"  loop.start()\n"
+"  return loop\n";
+}
@@ -0,0 +1,112 @@
+#ifndef _PYTHONQTEVENTLOOP_H
+#define _PYTHONQTEVENTLOOP_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtEventLoop.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+
+#include "PythonQtSystem.h"
+
+#include <QObject>
+#include <QTimer>
+#include <QHash>
+#include <QList>
+
+class QSocketNotifier;
+class QEventLoop;
+
+#if defined(PY3K) && PY_VERSION_HEX >= 0x03070000
+// the asyncio event loop uses the running loop API of asyncio 3.7
+#define PYTHONQT_SUPPORTS_ASYNCIO
+#endif
+
+//! Drives the asyncio event loop of the PythonQt.eventloop module (see PythonQt::installAsyncioEventLoop())
+//! from the Qt event loop. The Python side requests the next step of the loop with scheduleStep() and
+//! watches its sockets with QSocketNotifiers, so no thread or polling timer is needed.
+class PYTHONQT_EXPORT PythonQtEventLoopHelper : public QObject
+{
+  Q_OBJECT
+
+public:
+  PythonQtEventLoopHelper(QObject* parent = NULL);
+  ~PythonQtEventLoopHelper();
+
+  //! returns the Python source of the PythonQt.eventloop module
+  static const char* moduleSource();
+
+public Q_SLOTS:
+  //! emits stepRequested() after \c msecs milliseconds, a negative value cancels the pending step,
+  //! calls from other threads are queued to the thread of the helper
+  void scheduleStep(int msecs);
+
+  //! creates or (re-)enables the notifier of the given socket, \c type is 0 for reading and 1 for writing
+  void setSocketNotifierEnabled(int fd, int type, bool enabled);
+
+  //! removes the notifier of the given socket
+  void removeSocketNotifier(int fd, int type);
+
+  //! runs a local Qt event loop until quitEventLoop() is called
+  void runEventLoop();
+
+  //! quits the innermost local event loop started by runEventLoop()
+  void quitEventLoop();
+
+Q_SIGNALS:
+  //! emitted when the asyncio event loop should process its ready callbacks, timers and socket events
+  void stepRequested();
+
+  //! emitted when a socket became ready, the notifier is disabled until it is enabled again
+  void socketActivated(int fd, int type);
+
+private Q_SLOTS:
+  void socketNotifierActivated(int fd);
+
+private:
+  QTimer _timer;
+  //! the read and write notifiers by socket
+  QHash<int, QSocketNotifier*> _notifiers[2];
+  QList<QEventLoop*> _eventLoops;
+};
+
+#endif
@@ -44,6 +44,7 @@
 
 #include <QDateTime>
 #include <QString>
+#include <QStringList>
 #include <QByteArray>
 
 //! Defines an abstract interface to file access for the Python import statement.
@@ -67,6 +68,15 @@ public:
   //! get the last modified data of a file
   virtual QDateTime lastModifiedDate(const QString& filename) = 0;
 
+  //! returns if listDirectory() is implemented. If it is and the directory cache is enabled
+  //! (see PythonQt::setImporterDirectoryCacheEnabled()), the importer lists each directory once
+  //! and answers exists() lookups of module files from the cached listing
+  virtual bool supportsDirectoryListing() { return false; }
+
+  //! returns the names of all files and directories in the given directory
+  //! (an empty list if the directory does not exist)
+  virtual QStringList listDirectory(const QString& /*path*/) { return QStringList(); }
+
   //! indicates that *.py files which are newer than their corresponding *.pyc files
   //! are ignored
   virtual bool ignoreUpdatedPythonSourceFiles() { return false; }
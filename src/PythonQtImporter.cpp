@@ -50,6 +50,9 @@
 #include "PythonQtConversion.h"
 #include <QFile>
 #include <QFileInfo>
+#include <QDir>
+#include <QCoreApplication>
+#include <QCryptographicHash>
 
 #define IS_SOURCE   0x0
 #define IS_BYTECODE 0x1
@@ -78,6 +81,11 @@ struct st_mlab_searchorder {
 extern PyTypeObject PythonQtImporter_Type;
 PyObject *PythonQtImportError;
 
+bool PythonQtImport::_directoryCacheEnabled = false;
+QHash<QString, PythonQtImport::DirectoryListing> PythonQtImport::_directoryCache;
+int PythonQtImport::_directoryCacheGeneration = 0;
+QString PythonQtImport::_bytecodeCacheDirectory;
+
 QString PythonQtImport::getSubName(const QString& str)
 {
   int idx = str.lastIndexOf('.');
@@ -97,10 +105,20 @@ PythonQtImport::ModuleInfo PythonQtImport::getModuleInfo(PythonQtImporter* self,
   subname = getSubName(fullname);
   QString path = *self->_path + "/" + subname;
 
+  // check the modification date of each cached directory only once per lookup
+  _directoryCacheGeneration++;
+
+  // with the directory cache, a package directory is looked up in the listing of the path first,
+  // so that directories that do not exist are never listed
+  bool mayBePackage = !_directoryCacheEnabled || fileExists(path);
+
   QString test;
   for (zso = mlab_searchorder; *zso->suffix; zso++) {
+    if ((zso->type & IS_PACKAGE) && !mayBePackage) {
+      continue;
+    }
     test = path + zso->suffix;
-    if (PythonQt::importInterface()->exists(test)) {
+    if (fileExists(test)) {
       info.fullPath = test;
       info.moduleName = subname;
       info.type = (zso->type & IS_PACKAGE)?MI_PACKAGE:MI_MODULE;
@@ -110,7 +128,7 @@ PythonQtImport::ModuleInfo PythonQtImport::getModuleInfo(PythonQtImporter* self,
   // test if it is a shared library
   Q_FOREACH(const QString& suffix, PythonQt::priv()->sharedLibrarySuffixes()) {
     test = path+suffix;
-    if (PythonQt::importInterface()->exists(test)) {
+    if (fileExists(test)) {
       info.fullPath = test;
       info.moduleName = subname;
       info.type = MI_SHAREDLIBRARY;
@@ -120,6 +138,132 @@ PythonQtImport::ModuleInfo PythonQtImport::getModuleInfo(PythonQtImporter* self,
   return info;
 }
 
+bool PythonQtImport::fileExists(const QString& filename)
+{
+  PythonQtImportFileInterface* importInterface = PythonQt::importInterface();
+  if (!_directoryCacheEnabled || !importInterface->supportsDirectoryListing()) {
+    return importInterface->exists(filename);
+  }
+  int sepIndex = qMax(filename.lastIndexOf('/'), filename.lastIndexOf(QChar(SEP)));
+  if (sepIndex <= 0 || sepIndex == filename.length()-1) {
+    return importInterface->exists(filename);
+  }
+  QString directory = filename.left(sepIndex);
+  QHash<QString, DirectoryListing>::iterator it = _directoryCache.find(directory);
+  if (it == _directoryCache.end()) {
+    DirectoryListing listing;
+    listing.lastModified = importInterface->lastModifiedDate(directory);
+    listing.entries = toSet(importInterface->listDirectory(directory));
+    listing.checkedGeneration = _directoryCacheGeneration;
+    it = _directoryCache.insert(directory, listing);
+  } else if (it->checkedGeneration != _directoryCacheGeneration) {
+    // refresh the listing if the directory was modified since it was listed
+    it->checkedGeneration = _directoryCacheGeneration;
+    QDateTime lastModified = importInterface->lastModifiedDate(directory);
+    if (lastModified != it->lastModified) {
+      it->lastModified = lastModified;
+      it->entries = toSet(importInterface->listDirectory(directory));
+    }
+  }
+  return it->entries.contains(filename.mid(sepIndex+1));
+}
+
+QSet<QString> PythonQtImport::toSet(const QStringList& list)
+{
+  QSet<QString> result;
+  result.reserve(list.size());
+  Q_FOREACH(const QString& entry, list) {
+    result.insert(entry);
+  }
+  return result;
+}
+
+void PythonQtImport::setDirectoryCacheEnabled(bool enabled)
+{
+  _directoryCacheEnabled = enabled;
+  if (!enabled) {
+    clearDirectoryCache();
+  }
+}
+
+void PythonQtImport::clearDirectoryCache()
+{
+  _directoryCache.clear();
+}
+
+void PythonQtImport::setBytecodeCacheDirectory(const QString& directory)
+{
+  _bytecodeCacheDirectory = directory;
+  if (!directory.isEmpty()) {
+    QDir().mkpath(directory);
+  }
+}
+
+QString PythonQtImport::bytecodeCacheFile(const QString& path)
+{
+  QByteArray name = QCryptographicHash::hash(path.toUtf8(), QCryptographicHash::Sha1).toHex();
+  return _bytecodeCacheDirectory + "/" + QString::fromLatin1(name) + ".pyc";
+}
+
+PyObject* PythonQtImport::readFromBytecodeCache(const QString& path, const QByteArray& sourceHash)
+{
+  QFile file(bytecodeCacheFile(path));
+  if (!file.open(QIODevice::ReadOnly)) {
+    return NULL;
+  }
+  // the file starts with the magic number and the hash of the source, followed by the marshalled code
+  QByteArray data = file.readAll();
+  int headerSize = 4 + sourceHash.size();
+  if (data.size() <= headerSize ||
+      getLong((unsigned char*)data.constData()) != PyImport_GetMagicNumber() ||
+      data.mid(4, sourceHash.size()) != sourceHash) {
+    return NULL;
+  }
+  PyObject* code = PyMarshal_ReadObjectFromString(data.data() + headerSize, data.size() - headerSize);
+  if (!code || !PyCode_Check(code)) {
+    Py_XDECREF(code);
+    PyErr_Clear();
+    return NULL;
+  }
+  if (Py_VerboseFlag)
+    PySys_WriteStderr("# read %s from bytecode cache\n", path.toLatin1().constData());
+  return code;
+}
+
+void PythonQtImport::writeToBytecodeCache(const QString& path, const QByteArray& sourceHash, PyObject* code)
+{
+  PyObject* marshalled = PyMarshal_WriteObjectToString(code, Py_MARSHAL_VERSION);
+  if (!marshalled) {
+    PyErr_Clear();
+    return;
+  }
+  QByteArray data;
+  long magic = PyImport_GetMagicNumber();
+  for (int i = 0; i < 4; i++) {
+    data.append(char((magic >> (8*i)) & 0xff));
+  }
+  data.append(sourceHash);
+  data.append(PyBytes_AS_STRING(marshalled), PyBytes_GET_SIZE(marshalled));
+  Py_DECREF(marshalled);
+
+  // write to a temporary file first, so that no one reads a partially written file
+  QString filename = bytecodeCacheFile(path);
+  QString tmpFilename = filename + "." + QString::number(QCoreApplication::applicationPid()) + ".tmp";
+  QFile file(tmpFilename);
+  if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size()) {
+    if (Py_VerboseFlag)
+      PySys_WriteStderr("# can't write %s to bytecode cache\n", path.toLatin1().constData());
+    file.close();
+    QFile::remove(tmpFilename);
+    return;
+  }
+  file.close();
+  QFile::remove(filename);
+  if (!QFile::rename(tmpFilename, filename)) {
+    QFile::remove(tmpFilename);
+  }
+}
+
 
 /* PythonQtImporter.__init__
   Just store the path argument (or reject if it is in the ignorePaths list
@@ -648,13 +792,24 @@ PythonQtImport::getCodeFromData(const QString& path, int isbytecode,int /*ispack
     code = unmarshalCode(path, qdata, mtime);
   }
   else {
-  //  mlabDebugConst("MLABPython", "compiling source " << path);
-    code = compileSource(path, qdata);
-    if (code) {
-      // save a pyc file if possible
-      QDateTime time;
-      time = PythonQt::importInterface()->lastModifiedDate(path);
-      writeCompiledModule((PyCodeObject*)code, path+"c", time.toTime_t());
+    QByteArray sourceHash;
+    code = NULL;
+    if (!_bytecodeCacheDirectory.isEmpty()) {
+      sourceHash = QCryptographicHash::hash(qdata, QCryptographicHash::Sha1);
+      code = readFromBytecodeCache(path, sourceHash);
+    }
+    if (!code) {
+    //  mlabDebugConst("MLABPython", "compiling source " << path);
+      code = compileSource(path, qdata);
+      if (code) {
+        // save a pyc file if possible
+        QDateTime time;
+        time = PythonQt::importInterface()->lastModifiedDate(path);
+        writeCompiledModule((PyCodeObject*)code, path+"c", time.toTime_t());
+        if (!sourceHash.isEmpty()) {
+          writeToBytecodeCache(path, sourceHash, code);
+        }
+      }
     }
   }
   return code;
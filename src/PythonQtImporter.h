@@ -52,6 +52,10 @@
 
 #include <qobject.h>
 #include <qstring.h>
+#include <qdatetime.h>
+#include <qhash.h>
+#include <qset.h>
+#include <qstringlist.h>
 
 
 //! defines a python object that stores a Qt slot info
@@ -132,6 +136,55 @@ public:
   //! replace extension of file
   static QString replaceExtension(const QString& str, const QString& ext);
 
+  //! returns if the file exists, answered from the cached listing of its directory
+  //! if the directory cache is enabled and the import interface supports directory listing
+  static bool fileExists(const QString& filename);
+
+  //! enable/disable the directory listing cache
+  static void setDirectoryCacheEnabled(bool enabled);
+
+  //! returns if the directory listing cache is enabled
+  static bool directoryCacheEnabled() { return _directoryCacheEnabled; }
+
+  //! clears all cached directory listings
+  static void clearDirectoryCache();
+
+  //! sets the directory of the bytecode cache (an empty string disables the cache).
+  //! The compiled code of each imported source file is stored there, keyed by the source path and validated
+  //! by a hash of the source, so that e.g. modules from Qt resources or read-only directories are only compiled once.
+  static void setBytecodeCacheDirectory(const QString& directory);
+
+  //! returns the directory of the bytecode cache
+  static QString bytecodeCacheDirectory() { return _bytecodeCacheDirectory; }
+
+private:
+  //! returns the file in the bytecode cache that stores the code of the given source file
+  static QString bytecodeCacheFile(const QString& path);
+
+  //! returns the code of the given source file from the bytecode cache or NULL if it is
+  //! not cached or the source changed (new reference)
+  static PyObject* readFromBytecodeCache(const QString& path, const QByteArray& sourceHash);
+
+  //! stores the code of the given source file in the bytecode cache
+  static void writeToBytecodeCache(const QString& path, const QByteArray& sourceHash, PyObject* code);
+
+  //! returns the entries of the list as set
+  static QSet<QString> toSet(const QStringList& list);
+
+  //! a cached listing of a directory
+  struct DirectoryListing {
+    QSet<QString> entries;
+    QDateTime     lastModified;
+    int           checkedGeneration;  //!< the lookup generation in which the modification date was last checked
+  };
+
+  static bool _directoryCacheEnabled;
+  static QHash<QString, DirectoryListing> _directoryCache;
+  //! incremented for each module lookup, the modification date of a directory is checked once per lookup
+  static int _directoryCacheGeneration;
+
+  static QString _bytecodeCacheDirectory;
+
 };
 
 #endif
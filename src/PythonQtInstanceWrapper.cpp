@@ -47,6 +47,9 @@
 #include "PythonQtClassInfo.h"
 #include "PythonQtConversion.h"
 #include "PythonQtClassWrapper.h"
+#include "PythonQtProfiler.h"
+
+#include <QVector>
 
 PythonQtClassInfo* PythonQtInstanceWrapperStruct::classInfo()
 {
@@ -66,7 +69,14 @@ static void PythonQtInstanceWrapper_deleteObject(PythonQtInstanceWrapper* self,
     self->_obj = NULL;
     if (force || self->_ownedByPythonQt) {
       int type = self->classInfo()->metaTypeId();
-      if (self->_useQMetaTypeDestroy && type>=0) {
+      if (self->_useInlineStorage) {
+        // the object lives inside of the wrapper, so it must only be destructed
+#if( QT_VERSION >= QT_VERSION_CHECK(5,0,0) )
+        QMetaType::destruct(type, self->_wrappedPtr);
+#endif
+        self->_wrappedPtr = NULL;
+        self->_useInlineStorage = false;
+      } else if (self->_useQMetaTypeDestroy && type>=0) {
         // use QMetaType to destroy the object
         QMetaType::destroy(type, self->_wrappedPtr);
       } else {
@@ -139,6 +149,7 @@ static PyObject* PythonQtInstanceWrapper_new(PyTypeObject *type, PyObject * /*ar
     self->_ownedByPythonQt = false;
     self->_useQMetaTypeDestroy = false;
     self->_isShellInstance = false;
+    self->_useInlineStorage = false;
   }
   return (PyObject *)self;
 }
@@ -158,6 +169,10 @@ int PythonQtInstanceWrapper_init(PythonQtInstanceWrapper * self, PyObject * args
       return -1;
     }
     if (directCPPPointer) {
+      if (self->_useInlineStorage) {
+        // __init__ was called again on an inline copy, which is destructed now, since the new object is stored on the heap
+        PythonQtInstanceWrapper_deleteObject(self, true);
+      }
       // change ownershipflag to be owned by PythonQt
       self->_ownedByPythonQt = true;
       self->_useQMetaTypeDestroy = false;
@@ -229,60 +244,31 @@ static PyObject *PythonQtInstanceWrapper_richcompare(PythonQtInstanceWrapper* wr
     return Py_NotImplemented;
   }
 
-  QByteArray memberName;
+  PythonQtClassWrapper_Operator op;
   switch (code) {
   case Py_LT:
-    {
-      static QByteArray name = "__lt__";
-      memberName = name;
-    }
+    op = PythonQtOp_LessThan;
     break;
-
   case Py_LE:
-    {
-      static QByteArray name = "__le__";
-      memberName = name;
-    }
+    op = PythonQtOp_LessEqual;
     break;
-
   case Py_EQ:
-    {
-      static QByteArray name = "__eq__";
-      memberName = name;
-    }
+    op = PythonQtOp_Equal;
     break;
-
   case Py_NE:
-    {
-      static QByteArray name = "__ne__";
-      memberName = name;
-    }
+    op = PythonQtOp_NotEqual;
     break;
-
   case Py_GT:
-    {
-      static QByteArray name = "__gt__";
-      memberName = name;
-    }
+    op = PythonQtOp_GreaterThan;
     break;
-
-  case Py_GE:
-    {
-      static QByteArray name = "__ge__";
-      memberName = name;
-    }
+  default:
+    op = PythonQtOp_GreaterEqual;
     break;
   }
 
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
-    // TODO get rid of tuple
-    PyObject* args = PyTuple_New(1);
-    Py_INCREF(other);
-    PyTuple_SET_ITEM(args, 0, other);
-    PyObject* result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, args, NULL, wrapper->_wrappedPtr);
-    Py_DECREF(args);
-    return result;
+  PythonQtSlotInfo* opSlot = PythonQtClassWrapper_operatorSlot(wrapper, op);
+  if (opSlot) {
+    return PythonQtClassWrapper_callOperator(wrapper, opSlot, other);
   } else {
     // not implemented, let python try something else!
     Py_INCREF(Py_NotImplemented);
@@ -314,6 +300,198 @@ static PyObject *PythonQtInstanceWrapper_help(PythonQtInstanceWrapper* obj)
   return PythonQt::self()->helpCalled(obj->classInfo());
 }
 
+//! resolves the property of the given name, sets an AttributeError and returns false if there is no such property
+static bool PythonQtInstanceWrapper_resolveProperty(PythonQtInstanceWrapper* wrapper, PyObject* name, const char*& attributeName, QMetaProperty& prop)
+{
+#ifdef PY3K
+  if ((attributeName = PyUnicode_AsUTF8(name)) == NULL)
+#else
+  if ((attributeName = PyString_AsString(name)) == NULL)
+#endif
+    return false;
+
+  const PythonQtMemberInfo* cachedMember = wrapper->classInfo()->cachedMember(name);
+  PythonQtMemberInfo uncachedMember;
+  if (!cachedMember) {
+    uncachedMember = wrapper->classInfo()->member(attributeName);
+    cachedMember = &uncachedMember;
+  }
+  if (cachedMember->_type != PythonQtMemberInfo::Property) {
+    QString error = QString(wrapper->classInfo()->className()) + " has no property named '" + QString(attributeName) + "'";
+    PyErr_SetString(PyExc_AttributeError, error.toLatin1().data());
+    return false;
+  }
+  prop = cachedMember->_property;
+  return true;
+}
+
+static PyObject *PythonQtInstanceWrapper_getProperties(PythonQtInstanceWrapper* wrapper, PyObject *args)
+{
+  PyObject* names = NULL;
+  if (!PyArg_ParseTuple(args, "|O:PythonQtInstanceWrapper.getProperties", &names)) {
+    return NULL;
+  }
+  if (!wrapper->_obj) {
+    QString error = QString("Trying to read properties from a destroyed ") + wrapper->classInfo()->className() + " object";
+    PyErr_SetString(PyExc_ValueError, error.toLatin1().data());
+    return NULL;
+  }
+
+  // resolve all properties first, so that they are read in one pass
+  QList<QMetaProperty> properties;
+  QList<PythonQtObjectPtr> keys;
+  if (!names || names == Py_None) {
+    const QMetaObject* meta = wrapper->_obj->metaObject();
+    for (int i = 0; i < meta->propertyCount(); i++) {
+      QMetaProperty prop = meta->property(i);
+      if (prop.isReadable()) {
+        properties << prop;
+        keys << PythonQtObjectPtr();
+      }
+    }
+  } else {
+    PythonQtObjectPtr sequence;
+    sequence.setNewRef(PySequence_Fast(names, "getProperties() expects a sequence of property names"));
+    if (!sequence) {
+      return NULL;
+    }
+    Py_ssize_t count = PySequence_Fast_GET_SIZE(sequence.object());
+    for (Py_ssize_t i = 0; i < count; i++) {
+      PyObject* name = PySequence_Fast_GET_ITEM(sequence.object(), i);
+      const char* attributeName;
+      QMetaProperty prop;
+      if (!PythonQtInstanceWrapper_resolveProperty(wrapper, name, attributeName, prop)) {
+        return NULL;
+      }
+      properties << prop;
+      keys << PythonQtObjectPtr(name);
+    }
+  }
+
+  bool releaseGIL = true;
+  for (int i = 0; i < properties.size(); i++) {
+    if (PythonQt::priv()->isPythonQtObjectPtrMetaId(properties.at(i).userType())) {
+      releaseGIL = false;
+    }
+  }
+  bool profiling = PythonQtProfiler::isEnabled();
+  QVector<QVariant> values(properties.size());
+  QVector<qint64> readTimes(profiling ? properties.size() : 0);
+  {
+    // release the GIL once while all property getters run (unless a property holds a Python object)
+    PythonQtThreadStateSaver threadStateSaver(releaseGIL);
+    for (int i = 0; i < properties.size() && wrapper->_obj; i++) {
+      qint64 startTime = profiling ? PythonQtProfiler::now() : 0;
+      if (properties.at(i).userType() != QVariant::Invalid) {
+        values[i] = properties.at(i).read(wrapper->_obj);
+      }
+      if (profiling) {
+        readTimes[i] = PythonQtProfiler::now() - startTime;
+      }
+    }
+  }
+
+  PyObject* dict = PyDict_New();
+  for (int i = 0; i < properties.size(); i++) {
+    qint64 convertTime = profiling ? PythonQtProfiler::now() : 0;
+    PyObject* value = PythonQtConv::QVariantToPyObject(values.at(i));
+    if (profiling && wrapper->_obj) {
+      PythonQtProfilerStats* stats = PythonQtProfiler::propertyStats(wrapper->_obj->metaObject(), properties.at(i), false);
+      PythonQtProfiler::addCall(stats, PythonQtProfiler::now() - convertTime, readTimes.at(i));
+    }
+    if (!keys.at(i).isNull()) {
+      PyDict_SetItem(dict, keys.at(i), value);
+    } else {
+      PyDict_SetItemString(dict, properties.at(i).name(), value);
+    }
+    Py_DECREF(value);
+  }
+  return dict;
+}
+
+static PyObject *PythonQtInstanceWrapper_setProperties(PythonQtInstanceWrapper* wrapper, PyObject *args)
+{
+  PyObject* dict = NULL;
+  if (!PyArg_ParseTuple(args, "O!:PythonQtInstanceWrapper.setProperties", &PyDict_Type, &dict)) {
+    return NULL;
+  }
+  if (!wrapper->_obj) {
+    QString error = QString("Trying to set properties on a destroyed ") + wrapper->classInfo()->className() + " object";
+    PyErr_SetString(PyExc_AttributeError, error.toLatin1().data());
+    return NULL;
+  }
+
+  // resolve and convert all values first, so that nothing is written if one of them is invalid
+  QList<QMetaProperty> properties;
+  QList<QVariant> values;
+  bool releaseGIL = true;
+  PyObject* name;
+  PyObject* value;
+  Py_ssize_t pos = 0;
+  while (PyDict_Next(dict, &pos, &name, &value)) {
+    const char* attributeName;
+    QMetaProperty prop;
+    if (!PythonQtInstanceWrapper_resolveProperty(wrapper, name, attributeName, prop)) {
+      return NULL;
+    }
+    if (!prop.isWritable()) {
+      QString error = QString("Property '") + attributeName + "' of " + Py_TYPE(wrapper)->tp_name + " object is not writable";
+      PyErr_SetString(PyExc_AttributeError, error.toLatin1().data());
+      return NULL;
+    }
+    QVariant v;
+    if (prop.isEnumType()) {
+      // this will give us either a string or an int, everything else will probably be an error
+      v = PythonQtConv::PyObjToQVariant(value);
+    } else {
+      v = PythonQtConv::PyObjToQVariant(value, prop.userType());
+    }
+    if (!v.isValid()) {
+      QString error = QString("Property '") + attributeName + "' of type '" +
+        prop.typeName() + "' does not accept an object of type "
+        + QString(value->ob_type->tp_name) + " (" + PythonQtConv::PyObjGetRepresentation(value) + ")";
+      PyErr_SetString(PyExc_AttributeError, error.toLatin1().data());
+      return NULL;
+    }
+    if (PythonQt::priv()->isPythonQtObjectPtrMetaId(prop.userType())) {
+      releaseGIL = false;
+    }
+    properties << prop;
+    values << v;
+  }
+
+  bool profiling = PythonQtProfiler::isEnabled();
+  QVector<qint64> writeTimes(profiling ? properties.size() : 0);
+  int failed = -1;
+  {
+    // release the GIL once while all property setters run (unless a property holds a Python object)
+    PythonQtThreadStateSaver threadStateSaver(releaseGIL);
+    for (int i = 0; i < properties.size() && wrapper->_obj; i++) {
+      qint64 startTime = profiling ? PythonQtProfiler::now() : 0;
+      if (!properties.at(i).write(wrapper->_obj, values.at(i)) && failed == -1) {
+        failed = i;
+      }
+      if (profiling) {
+        writeTimes[i] = PythonQtProfiler::now() - startTime;
+      }
+    }
+  }
+  if (profiling && wrapper->_obj) {
+    for (int i = 0; i < properties.size(); i++) {
+      PythonQtProfilerStats* stats = PythonQtProfiler::propertyStats(wrapper->_obj->metaObject(), properties.at(i), true);
+      PythonQtProfiler::addCall(stats, 0, writeTimes.at(i));
+    }
+  }
+  if (failed != -1) {
+    QString error = QString("Property '") + properties.at(failed).name() + "' of type '" +
+      properties.at(failed).typeName() + "' could not be written";
+    PyErr_SetString(PyExc_AttributeError, error.toLatin1().data());
+    return NULL;
+  }
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
 PyObject *PythonQtInstanceWrapper_delete(PythonQtInstanceWrapper * self)
 {
   PythonQtInstanceWrapper_deleteObject(self, true);
@@ -321,6 +499,33 @@ PyObject *PythonQtInstanceWrapper_delete(PythonQtInstanceWrapper * self)
   return Py_None;
 }
 
+int PythonQtInstanceWrapper_overrideIndex(const char* name)
+{
+  static QHash<QByteArray, int> overrideIndices;
+  QByteArray key(name);
+  QHash<QByteArray, int>::const_iterator it = overrideIndices.constFind(key);
+  if (it != overrideIndices.constEnd()) {
+    return it.value();
+  }
+  int index = overrideIndices.size();
+  overrideIndices.insert(key, index);
+  return index;
+}
+
+PyObject* PythonQtInstanceWrapper_findOverride(PythonQtInstanceWrapper* wrapper, int overrideIndex, PyObject* name)
+{
+  PyObject* type = (PyObject*)Py_TYPE(wrapper);
+  if (PyObject_TypeCheck(type, &PythonQtClassWrapper_Type) &&
+      !PythonQtClassWrapper_hasOverride((PythonQtClassWrapper*)type, overrideIndex, name)) {
+    // the class does not override the method, but it might still be set on the instance itself
+    PyObject** dictPtr = _PyObject_GetDictPtr((PyObject*)wrapper);
+    if (!dictPtr || !*dictPtr || !PyDict_GetItem(*dictPtr, name)) {
+      return NULL;
+    }
+  }
+  return PyBaseObject_Type.tp_getattro((PyObject*)wrapper, name);
+}
+
 
 static PyMethodDef PythonQtInstanceWrapper_methods[] = {
     {"className", (PyCFunction)PythonQtInstanceWrapper_classname, METH_NOARGS,
@@ -335,10 +540,49 @@ static PyMethodDef PythonQtInstanceWrapper_methods[] = {
     {"delete", (PyCFunction)PythonQtInstanceWrapper_delete, METH_NOARGS,
     "Deletes the C++ object (at your own risk, my friend!)"
     },
+    {"getProperties", (PyCFunction)PythonQtInstanceWrapper_getProperties, METH_VARARGS,
+    "Returns a dict with the values of the given property names (or of all readable properties), which are read in one pass"
+    },
+    {"setProperties", (PyCFunction)PythonQtInstanceWrapper_setProperties, METH_VARARGS,
+    "Sets all properties of the given dict in one pass, nothing is written if a property is unknown or a value does not fit"
+    },
 {NULL, NULL, 0, NULL}  /* Sentinel */
 };
 
 
+//! returns if the generic attribute lookup can find the name in the type hierarchy or the instance dict
+static bool PythonQtInstanceWrapper_hasGenericAttribute(PyObject* obj, PyObject* name)
+{
+  if (_PyType_Lookup(Py_TYPE(obj), name)) {
+    return true;
+  }
+  PyObject** dictPtr = _PyObject_GetDictPtr(obj);
+  return dictPtr && *dictPtr && PyDict_GetItem(*dictPtr, name);
+}
+
+//! returns if \c name is getProperties or setProperties and the wrapped class has a C++ member of that name,
+//! which takes precedence over the built-in method (but not over Python overrides or instance attributes)
+static bool PythonQtInstanceWrapper_isShadowedBulkPropertyMethod(PythonQtInstanceWrapper* wrapper, PyObject* name, const char* attributeName)
+{
+  if ((attributeName[0] != 'g' && attributeName[0] != 's') || qstrcmp(attributeName + 1, "etProperties") != 0) {
+    return false;
+  }
+  if (_PyType_Lookup(Py_TYPE(wrapper), name) != PyDict_GetItem(PythonQtInstanceWrapper_Type.tp_dict, name)) {
+    return false;
+  }
+  PyObject** dictPtr = _PyObject_GetDictPtr((PyObject*)wrapper);
+  if (dictPtr && *dictPtr && PyDict_GetItem(*dictPtr, name)) {
+    return false;
+  }
+  const PythonQtMemberInfo* cachedMember = wrapper->classInfo()->cachedMember(name);
+  PythonQtMemberInfo uncachedMember;
+  if (!cachedMember) {
+    uncachedMember = wrapper->classInfo()->member(attributeName);
+    cachedMember = &uncachedMember;
+  }
+  return cachedMember->_type != PythonQtMemberInfo::NotFound && cachedMember->_type != PythonQtMemberInfo::Invalid;
+}
+
 static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
 {
   const char *attributeName;
@@ -385,16 +629,28 @@ static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
     return dict;
   }
 
-  // first look in super, to return derived methods from base object first
-  PyObject* superAttr = PyBaseObject_Type.tp_getattro(obj, name);
-  if (superAttr) {
-    return superAttr;
+  // first look in super, to return derived methods from base object first.
+  // The generic lookup can only succeed if the name is found in the type hierarchy or
+  // in the instance dict, so skip it (and the AttributeError it raises) for Qt members.
+  if (PythonQtInstanceWrapper_hasGenericAttribute(obj, name) &&
+      !PythonQtInstanceWrapper_isShadowedBulkPropertyMethod(wrapper, name, attributeName)) {
+    PyObject* superAttr = PyBaseObject_Type.tp_getattro(obj, name);
+    if (superAttr) {
+      return superAttr;
+    }
+    PyErr_Clear();
   }
-  PyErr_Clear();
 
   //  mlabDebugConst("Python","get " << attributeName);
 
-  PythonQtMemberInfo member = wrapper->classInfo()->member(attributeName);
+  // interned names (which is what attribute access in Python code uses) are looked up by pointer
+  const PythonQtMemberInfo* cachedMember = wrapper->classInfo()->cachedMember(name);
+  PythonQtMemberInfo uncachedMember;
+  if (!cachedMember) {
+    uncachedMember = wrapper->classInfo()->member(attributeName);
+    cachedMember = &uncachedMember;
+  }
+  const PythonQtMemberInfo& member = *cachedMember;
   switch (member._type) {
   case PythonQtMemberInfo::Property:
     if (wrapper->_obj) {
@@ -402,14 +658,27 @@ static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
 
         PythonQt::ProfilingCB* profilingCB = PythonQt::priv()->profilingCB();
         if (profilingCB) {
-          QString methodName = "getProperty('";
+          QByteArray methodName = "getProperty('";
           methodName += attributeName;
           methodName += "')";
-          profilingCB(PythonQt::Enter, wrapper->_obj->metaObject()->className(), methodName.toLatin1(), NULL);
+          profilingCB(PythonQt::Enter, wrapper->_obj->metaObject()->className(), methodName.constData(), NULL);
         }
+        bool profiling = PythonQtProfiler::isEnabled();
+        qint64 startTime = profiling ? PythonQtProfiler::now() : 0;
+
+        QVariant v;
+        {
+          // release the GIL while the property getter runs (unless the property holds a Python object)
+          PythonQtThreadStateSaver threadStateSaver(!PythonQt::priv()->isPythonQtObjectPtrMetaId(member._property.userType()));
+          v = member._property.read(wrapper->_obj);
+        }
+        qint64 readTime = profiling ? PythonQtProfiler::now() : 0;
+        PyObject* value = PythonQtConv::QVariantToPyObject(v);
 
-        PyObject* value = PythonQtConv::QVariantToPyObject(member._property.read(wrapper->_obj));
-
+        if (profiling && wrapper->_obj) {
+          PythonQtProfilerStats* stats = PythonQtProfiler::propertyStats(wrapper->_obj->metaObject(), member._property, false);
+          PythonQtProfiler::addCall(stats, PythonQtProfiler::now() - readTime, readTime - startTime);
+        }
         if (profilingCB) {
           profilingCB(PythonQt::Leave, NULL, NULL, NULL);
         }
@@ -530,7 +799,13 @@ static int PythonQtInstanceWrapper_setattro(PyObject *obj,PyObject *name,PyObjec
 #endif
     return -1;
 
-  PythonQtMemberInfo member = wrapper->classInfo()->member(attributeName);
+  const PythonQtMemberInfo* cachedMember = wrapper->classInfo()->cachedMember(name);
+  PythonQtMemberInfo uncachedMember;
+  if (!cachedMember) {
+    uncachedMember = wrapper->classInfo()->member(attributeName);
+    cachedMember = &uncachedMember;
+  }
+  const PythonQtMemberInfo& member = *cachedMember;
   if (member._type == PythonQtMemberInfo::Property) {
 
     if (!wrapper->_obj) {
@@ -541,6 +816,8 @@ static int PythonQtInstanceWrapper_setattro(PyObject *obj,PyObject *name,PyObjec
 
     QMetaProperty prop = member._property;
     if (prop.isWritable()) {
+      bool profiling = PythonQtProfiler::isEnabled();
+      qint64 startTime = profiling ? PythonQtProfiler::now() : 0;
       QVariant v;
       if (prop.isEnumType()) {
         // this will give us either a string or an int, everything else will probably be an error
@@ -553,13 +830,23 @@ static int PythonQtInstanceWrapper_setattro(PyObject *obj,PyObject *name,PyObjec
       if (v.isValid()) {
         PythonQt::ProfilingCB* profilingCB = PythonQt::priv()->profilingCB();
         if (profilingCB) {
-          QString methodName = "setProperty('";
+          QByteArray methodName = "setProperty('";
           methodName += attributeName;
           methodName += "')";
-          profilingCB(PythonQt::Enter, wrapper->_obj->metaObject()->className(), methodName.toLatin1(), NULL);
+          profilingCB(PythonQt::Enter, wrapper->_obj->metaObject()->className(), methodName.constData(), NULL);
         }
+        qint64 writeTime = profiling ? PythonQtProfiler::now() : 0;
 
-        success = prop.write(wrapper->_obj, v);
+        {
+          // release the GIL while the property setter runs (unless the property holds a Python object)
+          PythonQtThreadStateSaver threadStateSaver(!PythonQt::priv()->isPythonQtObjectPtrMetaId(prop.userType()));
+          success = prop.write(wrapper->_obj, v);
+        }
+
+        if (profiling && wrapper->_obj) {
+          PythonQtProfilerStats* stats = PythonQtProfiler::propertyStats(wrapper->_obj->metaObject(), prop, true);
+          PythonQtProfiler::addCall(stats, writeTime - startTime, PythonQtProfiler::now() - writeTime);
+        }
 
         if (profilingCB) {
           profilingCB(PythonQt::Leave, NULL, NULL, NULL);
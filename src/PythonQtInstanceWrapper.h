@@ -57,6 +57,9 @@ class QObject;
 
 extern PYTHONQT_EXPORT PyTypeObject PythonQtInstanceWrapper_Type;
 
+//! value types up to this size (in bytes) are copied into the wrapper itself instead of a heap allocated copy
+#define PYTHONQT_INSTANCEWRAPPER_INLINE_STORAGE_SIZE 32
+
 //---------------------------------------------------------------
 //! a Python wrapper object for Qt objects and C++ objects (that are themselves wrapped by wrapper QObjects)
 typedef struct PythonQtInstanceWrapperStruct {
@@ -91,11 +94,32 @@ typedef struct PythonQtInstanceWrapperStruct {
   //! stores if the object is a shell instance
   bool _isShellInstance;
 
+  //! stores that _wrappedPtr points to _inlineStorage, so that the object is only destructed
+  bool _useInlineStorage;
+
+  //! storage of a small value type copy (see PythonQtPrivate::createInlineCopyFromMetaType()),
+  //! which checks that the storage is aligned for the type
+  union {
+    long double _alignLongDouble;
+    double _alignDouble;
+    qint64 _alignInt64;
+    void*  _alignPointer;
+    char   _data[PYTHONQT_INSTANCEWRAPPER_INLINE_STORAGE_SIZE];
+  } _inlineStorage;
+
 } PythonQtInstanceWrapper;
 
 int PythonQtInstanceWrapper_init(PythonQtInstanceWrapper * self, PyObject * args, PyObject * kwds);
 
 PyObject *PythonQtInstanceWrapper_delete(PythonQtInstanceWrapper * self);
 
+//! returns a unique index for the given shell virtual method name, which is used to cache
+//! which virtual methods are overridden by a Python class (called once per method by the generated shell classes)
+PYTHONQT_EXPORT int PythonQtInstanceWrapper_overrideIndex(const char* name);
+
+//! returns the Python override of the given shell virtual method as new reference or NULL if it is not
+//! overridden by the Python class of the wrapper or its instance dict (the result is cached per Python class)
+PYTHONQT_EXPORT PyObject* PythonQtInstanceWrapper_findOverride(PythonQtInstanceWrapper* wrapper, int overrideIndex, PyObject* name);
+
 #endif
 
@@ -41,11 +41,14 @@
 
 #include "PythonQtMethodInfo.h"
 #include "PythonQtClassInfo.h"
+#include "PythonQtConversion.h"
+#include "PythonQtInstanceWrapper.h"
 #include <iostream>
 
 QHash<QByteArray, PythonQtMethodInfo*> PythonQtMethodInfo::_cachedSignatures;
 QHash<int, PythonQtMethodInfo::ParameterInfo> PythonQtMethodInfo::_cachedParameterInfos;
 QHash<QByteArray, QByteArray> PythonQtMethodInfo::_parameterNameAliases;
+int PythonQtSlotInfo::_globalArgumentConvertersGeneration = 1;
 
 PythonQtMethodInfo::PythonQtMethodInfo(const QMetaMethod& meta, PythonQtClassInfo* classInfo)
 {
@@ -118,6 +121,7 @@ void PythonQtMethodInfo::fillParameterInfo(ParameterInfo& type, const QByteArray
   QByteArray name = orgName;
 
   type.enumWrapper = NULL;
+  type.classInfo = NULL;
   type.innerNamePointerCount = 0;
   type.isQList = false;
   
@@ -437,3 +441,154 @@ QByteArray PythonQtSlotInfo::signature() const
 {
   return PythonQtUtils::signature(_meta);
 }
+
+bool PythonQtSlotInfo::usesPythonObjects()
+{
+  if (_usesPythonObjects < 0) {
+    _usesPythonObjects = 0;
+    Q_FOREACH(const ParameterInfo& param, _parameters) {
+      if ((param.name == "PyObject" && param.pointerCount == 1) || param.name == "PythonQtObjectPtr") {
+        _usesPythonObjects = 1;
+        break;
+      }
+    }
+  }
+  return _usesPythonObjects != 0;
+}
+
+//! the maximum number of argument type combinations that are cached per overloaded slot
+#define PYTHONQT_MAX_OVERLOAD_CACHE_ENTRIES 64
+
+//! returns the index of the value range of the integer \c obj, all integers with the same
+//! range index fit into the same C integer types, so their strict conversion behaves identically
+static quintptr integerRangeClass(PyObject* obj)
+{
+  static const qint64 bounds[] = {
+    -Q_INT64_C(0x80000000), -0x8000, -0x80, 0, 0x80, 0x100, 0x8000, 0x10000,
+    Q_INT64_C(0x80000000), Q_INT64_C(0x100000000)
+  };
+  static const int boundCount = sizeof(bounds) / sizeof(bounds[0]);
+  qint64 value;
+#ifndef PY3K
+  if (PyInt_Check(obj)) {
+    value = PyInt_AS_LONG(obj);
+  } else
+#endif
+  {
+    int overflow = 0;
+    value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+    if (overflow < 0) {
+      return 1;
+    } else if (overflow > 0) {
+      PyLong_AsUnsignedLongLong(obj);
+      if (PyErr_Occurred()) {
+        PyErr_Clear();
+        return boundCount + 4;
+      }
+      return boundCount + 3;
+    } else if (value == -1 && PyErr_Occurred()) {
+      PyErr_Clear();
+      return 0;
+    }
+  }
+  int i = 0;
+  while (i < boundCount && value >= bounds[i]) {
+    i++;
+  }
+  return i + 2;
+}
+
+//! computes the overload cache key of \c args, which consists of the type and (for integers) the value range
+//! of each argument. Returns false if the conversion of an argument depends on its contents, e.g. for lists or dicts,
+//! since the same overload would then not necessarily match again.
+static bool overloadCacheKey(PyObject* args, QVector<quintptr>& key)
+{
+  int argc = args?PyTuple_GET_SIZE(args):0;
+  key.resize(argc * 2);
+  for (int i = 0; i < argc; i++) {
+    PyObject* obj = PyTuple_GET_ITEM(args, i);
+    quintptr rangeClass = 0;
+    if (PyLong_Check(obj)
+#ifndef PY3K
+        || PyInt_Check(obj)
+#endif
+        ) {
+      rangeClass = integerRangeClass(obj);
+    } else if (!PyBytes_Check(obj) && !PyUnicode_Check(obj) && !PyByteArray_Check(obj) &&
+               !PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type) &&
+               (PySequence_Check(obj) || PyMapping_Check(obj) || PyAnySet_Check(obj))) {
+      return false;
+    }
+    key[i * 2] = (quintptr)Py_TYPE(obj);
+    key[i * 2 + 1] = rangeClass;
+  }
+  return true;
+}
+
+static uint overloadCacheKeyHash(const QVector<quintptr>& key)
+{
+  uint hash = key.size();
+  for (int i = 0; i < key.size(); i++) {
+    hash = hash * 31 + qHash(key.at(i));
+  }
+  return hash;
+}
+
+PythonQtSlotInfo* PythonQtSlotInfo::cachedOverload(PyObject* args)
+{
+  if (!_overloadCache) {
+    return NULL;
+  }
+  QVector<quintptr> key;
+  if (!overloadCacheKey(args, key)) {
+    return NULL;
+  }
+  QHash<uint, PythonQtOverloadCacheEntry>::const_iterator it = _overloadCache->constFind(overloadCacheKeyHash(key));
+  if (it == _overloadCache->constEnd() || it.value().argumentKey != key) {
+    return NULL;
+  }
+  return it.value().slot;
+}
+
+void PythonQtSlotInfo::cacheOverload(PyObject* args, PythonQtSlotInfo* slot)
+{
+  PythonQtOverloadCacheEntry entry;
+  if (!overloadCacheKey(args, entry.argumentKey)) {
+    return;
+  }
+  if (!_overloadCache) {
+    _overloadCache = new QHash<uint, PythonQtOverloadCacheEntry>;
+  } else if (_overloadCache->size() >= PYTHONQT_MAX_OVERLOAD_CACHE_ENTRIES) {
+    _overloadCache->clear();
+  }
+  entry.slot = slot;
+  _overloadCache->insert(overloadCacheKeyHash(entry.argumentKey), entry);
+}
+
+void PythonQtSlotInfo::clearOverloadCache()
+{
+  if (_overloadCache) {
+    _overloadCache->clear();
+  }
+}
+
+void PythonQtSlotInfo::createArgumentConverters()
+{
+  int count = _parameters.size();
+  bool isSignal = _meta.methodType() == QMetaMethod::Signal;
+  delete[] _argumentConverters;
+  _argumentConverters = new PythonQtArgumentConverter[count];
+  _argumentConvertersGeneration = _globalArgumentConvertersGeneration;
+  for (int i = 0; i < count; i++) {
+    PythonQtArgumentConverter& converter = _argumentConverters[i];
+    // point to our own copy of the parameters, which is never modified after construction
+    converter.info = &_parameters.at(i);
+    if (i == 0) {
+      converter.toQt = NULL;
+      converter.toPython = PythonQtConv::returnValueConverter(*converter.info);
+    } else {
+      converter.toQt = PythonQtConv::argumentConverter(*converter.info, isSignal);
+      converter.toPython = NULL;
+    }
+  }
+}
@@ -47,9 +47,11 @@
 #include <QByteArray>
 #include <QHash>
 #include <QList>
+#include <QVector>
 #include <QMetaMethod>
 
 class PythonQtClassInfo;
+struct PythonQtProfilerStats;
 struct _object;
 typedef struct _object PyObject;
 
@@ -72,6 +74,8 @@ public:
     char innerNamePointerCount; // the number of pointer indirections in the inner name 
     bool isConst;
     bool isQList;
+    //! the class info of the type, resolved on the first conversion of a wrapped object (may be NULL)
+    mutable PythonQtClassInfo* classInfo;
   };
 
   PythonQtMethodInfo() {};
@@ -138,6 +142,45 @@ protected:
   QString  _doc;
 };
 
+class PythonQtSlotInfo;
+
+//! caches which overload was called successfully with strict conversion for the given Python argument types
+//! (and integer value ranges)
+struct PythonQtOverloadCacheEntry {
+  QVector<quintptr>  argumentKey;
+  PythonQtSlotInfo*  slot;
+};
+
+//! converts the Python object to the C++ type of the parameter and returns a pointer to the converted value (or NULL),
+//! see PythonQtConv::ConvertPythonToQt()
+typedef void* PythonQtArgumentConverterCB(const PythonQtMethodInfo::ParameterInfo& info, PyObject* obj, bool strict, PythonQtClassInfo* classInfo);
+
+//! converts the C++ value of the parameter to a new Python object, see PythonQtConv::ConvertQtValueToPython()
+typedef PyObject* PythonQtReturnValueConverterCB(const PythonQtMethodInfo::ParameterInfo& info, const void* data);
+
+//! a precompiled conversion step of a slot call, the first entry of a slot describes the return value,
+//! the following entries describe the arguments
+struct PythonQtArgumentConverter {
+  const PythonQtMethodInfo::ParameterInfo* info;
+  PythonQtArgumentConverterCB*     toQt;
+  PythonQtReturnValueConverterCB*  toPython;
+};
+
+class PythonQtDirectCallContext;
+
+//! a typed call of a wrapper slot that is used instead of qt_metacall (see the --direct-calls option of the generator
+//! and PythonQtDirectCall.h). It converts the items of \c args directly to the C++ parameters, calls the slot of the
+//! \c decorator (passing \c object as the wrapped object for instance decorators) and returns the converted result.
+//! It returns NULL without an exception if the arguments do not match and NULL with an exception if the call failed.
+typedef PyObject* PythonQtDirectCallCB(PythonQtDirectCallContext& context, QObject* decorator, void* object, PyObject* args);
+
+//! maps the signature of a wrapper slot to its direct call, tables of these are registered with
+//! PythonQtPrivate::registerDirectCalls() and are terminated by an entry with a NULL signature
+struct PythonQtDirectCallEntry {
+  const char*           signature;
+  PythonQtDirectCallCB* call;
+};
+
 //! stores information about a slot, including a next pointer to overloaded slots
 class PythonQtSlotInfo : public PythonQtMethodInfo
 {
@@ -154,6 +197,14 @@ public:
     _decorator = info._decorator;
     _type = info._type;
     _upcastingOffset = 0;
+    _usesPythonObjects = -1;
+    _overloadCache = NULL;
+    _overloadCacheHits = 0;
+    _overloadCacheMisses = 0;
+    _argumentConverters = NULL;
+    _argumentConvertersGeneration = 0;
+    _profilerStats = NULL;
+    _directCall = info._directCall;
   }
 
   PythonQtSlotInfo(PythonQtClassInfo* classInfo, const QMetaMethod& meta, int slotIndex, QObject* decorator = NULL, Type type = MemberSlot ):PythonQtMethodInfo()
@@ -166,8 +217,20 @@ public:
     _decorator = decorator;
     _type = type;
     _upcastingOffset = 0;
+    _usesPythonObjects = -1;
+    _overloadCache = NULL;
+    _overloadCacheHits = 0;
+    _overloadCacheMisses = 0;
+    _argumentConverters = NULL;
+    _argumentConvertersGeneration = 0;
+    _profilerStats = NULL;
+    _directCall = NULL;
   }
 
+  ~PythonQtSlotInfo() {
+    delete _overloadCache;
+    delete[] _argumentConverters;
+  }
 
 public:
 
@@ -186,7 +249,7 @@ public:
   PythonQtSlotInfo* nextInfo()  const { return _next; }
 
   //! set the next overloaded slot
-  void setNextInfo(PythonQtSlotInfo* next) { _next = next; }
+  void setNextInfo(PythonQtSlotInfo* next) { _next = next; clearOverloadCache(); }
 
   //! returns if the slot is a decorator slot
   bool isInstanceDecorator() { return _decorator!=NULL && _type == InstanceDecorator; }
@@ -205,13 +268,85 @@ public:
   //! get the short slot name
   QByteArray slotName() const;
 
+  //! returns if the slot takes or returns PyObject* or PythonQtObjectPtr,
+  //! such slots are always called while holding the GIL
+  bool usesPythonObjects();
+
+  //! returns the overload (of this slot and its next infos) that was successfully called with strict conversion
+  //! for arguments of the same Python types (and integer value ranges) as \c args before, or NULL if there is none.
+  PythonQtSlotInfo* cachedOverload(PyObject* args);
+
+  //! remember that \c slot was successfully called with strict conversion for the Python types of \c args,
+  //! does nothing if the match could depend on the contents of the arguments (e.g. for lists)
+  void cacheOverload(PyObject* args, PythonQtSlotInfo* slot);
+
+  //! clears the overload cache
+  void clearOverloadCache();
+
+  //! count a successful call of a cached overload
+  void addOverloadCacheHit() { _overloadCacheHits++; }
+
+  //! count a call that required the full overload resolution
+  void addOverloadCacheMiss() { _overloadCacheMisses++; }
+
+  //! returns how often a cached overload was called successfully
+  int overloadCacheHits() const { return _overloadCacheHits; }
+
+  //! returns how often the full overload resolution was needed
+  int overloadCacheMisses() const { return _overloadCacheMisses; }
+
+  //! returns the statistics of the built-in profiler (NULL if the slot was not profiled yet)
+  PythonQtProfilerStats* profilerStats() const { return _profilerStats; }
+
+  //! sets the statistics of the built-in profiler, they are owned by PythonQtProfiler
+  void setProfilerStats(PythonQtProfilerStats* stats) { _profilerStats = stats; }
+
+  //! returns the direct call that replaces qt_metacall for this slot (NULL if there is none)
+  PythonQtDirectCallCB* directCall() const { return _directCall; }
+
+  //! sets the direct call that replaces qt_metacall for this slot
+  void setDirectCall(PythonQtDirectCallCB* call) { _directCall = call; }
+
+  //! returns the precompiled converters of the return value and the arguments (one per parameter),
+  //! the array is created on first use and recreated after invalidateArgumentConverters() was called
+  const PythonQtArgumentConverter* argumentConverters() {
+    if (!_argumentConverters || _argumentConvertersGeneration != _globalArgumentConvertersGeneration) {
+      createArgumentConverters();
+    }
+    return _argumentConverters;
+  }
+
+  //! invalidates the converters of all slots, e.g. after PythonQtConv::setSpecializedConvertersEnabled(),
+  //! this must not be called while slots are executed
+  static void invalidateArgumentConverters() { _globalArgumentConvertersGeneration++; }
+
 private:
+  //! not implemented, the slot info owns its overload cache and converters (the copy constructor does not copy them)
+  PythonQtSlotInfo& operator=(const PythonQtSlotInfo&);
+
+  //! creates the array returned by argumentConverters()
+  void createArgumentConverters();
+
   int               _slotIndex;
   PythonQtSlotInfo* _next;
   QObject*          _decorator;
   Type              _type;
   QMetaMethod       _meta;
   int               _upcastingOffset;
+  char              _usesPythonObjects;
+
+  QHash<uint, PythonQtOverloadCacheEntry>* _overloadCache;
+  int               _overloadCacheHits;
+  int               _overloadCacheMisses;
+
+  PythonQtArgumentConverter* _argumentConverters;
+  int               _argumentConvertersGeneration;
+
+  static int _globalArgumentConvertersGeneration;
+
+  PythonQtProfilerStats* _profilerStats;
+
+  PythonQtDirectCallCB* _directCall;
 };
 
 
@@ -44,6 +44,7 @@
 
 
 #include <QList>
+#include <QThreadStorage>
 
 #define PythonQtValueStorage_ADD_VALUE(store, type, value, ptr) \
 {  type* item = (type*)store.nextValuePtr(); \
@@ -73,6 +74,8 @@ public:
 template <typename T, int chunkEntries> class PythonQtValueStorage
 {
 public:
+  typedef T ValueType;
+
   PythonQtValueStorage() {
     _chunkIdx  = 0;
     _chunkOffset = 0;
@@ -172,4 +175,39 @@ private:
   using PythonQtValueStorage<T, chunkEntries>::_currentChunk;
 };
 
+//! a value storage (PythonQtValueStorage or PythonQtValueStorageWithCleanup) per thread, since the slots of
+//! several threads may run at the same time while the GIL is released
+template <class Storage> class PythonQtThreadLocalValueStorage
+{
+public:
+  //! clear all memory of the current thread's storage, a new storage is created on the next use
+  void clear() { _storage.setLocalData(NULL); }
+
+  //! get the current position to be restored with setPos
+  void getPos(PythonQtValueStoragePosition& pos) { storage().getPos(pos); }
+
+  //! set the current position (without freeing memory, thus caching old entries for reuse)
+  void setPos(const PythonQtValueStoragePosition& pos) { storage().setPos(pos); }
+
+  //! add one default constructed value and return the pointer to it
+  typename Storage::ValueType* nextValuePtr() { return storage().nextValuePtr(); }
+
+private:
+  //! frees the memory when the thread finishes
+  class LocalStorage : public Storage
+  {
+  public:
+    ~LocalStorage() { this->clear(); }
+  };
+
+  Storage& storage() {
+    if (!_storage.hasLocalData()) {
+      _storage.setLocalData(new LocalStorage);
+    }
+    return *_storage.localData();
+  }
+
+  QThreadStorage<LocalStorage*> _storage;
+};
+
 #endif
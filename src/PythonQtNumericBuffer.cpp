@@ -0,0 +1,171 @@
+/*
+*
+*  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  Further, this software is distributed without any warranty that it is
+*  free of the rightful claim of any third person regarding infringement
+*  or the like.  Any license provided herein, whether implied or
+*  otherwise, applies only to this software file.  Patent licenses, if
+*  any, provided herein do not apply to combinations of this program with
+*  other software, or any other product whatsoever.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*
+*  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+*  28359 Bremen, Germany or:
+*
+*  http://www.mevis.de
+*
+*/
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtNumericBuffer.cpp
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtNumericBuffer.h"
+
+#include <cstring>
+
+static void PythonQtNumericBuffer_dealloc(PythonQtNumericBufferObject* self)
+{
+  delete self->_data;
+  self->_data = NULL;
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static int PythonQtNumericBuffer_getbuffer(PythonQtNumericBufferObject* self, Py_buffer* view, int flags)
+{
+  const void* data = self->_data->data();
+  // an empty container may not have any data, but the buffer needs a valid address
+  if (!data) {
+    data = self;
+  }
+  // the data is exported read-only, so that it is never modified behind the back of the container
+  if (PyBuffer_FillInfo(view, (PyObject*)self, (void*)data, self->_count * self->_itemSize, 1, flags) < 0) {
+    return -1;
+  }
+  // without PyBUF_FORMAT the consumer expects unsigned bytes, which is what PyBuffer_FillInfo exports
+  if (flags & PyBUF_FORMAT) {
+    view->format = (char*)self->_format;
+    view->itemsize = self->_itemSize;
+    if (flags & PyBUF_ND) {
+      view->shape = &self->_count;
+    }
+    if ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) {
+      view->strides = &self->_itemSize;
+    }
+  }
+  return 0;
+}
+
+static PyBufferProcs PythonQtNumericBuffer_as_buffer = {
+#ifndef PY3K
+  0,      /* bf_getreadbuffer */
+  0,      /* bf_getwritebuffer */
+  0,      /* bf_getsegcount */
+  0,      /* bf_getcharbuffer */
+#endif
+  (getbufferproc)PythonQtNumericBuffer_getbuffer,      /* bf_getbuffer */
+  0,      /* bf_releasebuffer */
+};
+
+PyTypeObject PythonQtNumericBuffer_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "NumericBuffer",
+    sizeof(PythonQtNumericBufferObject),
+    0,
+    (destructor)PythonQtNumericBuffer_dealloc,     /* tp_dealloc */
+    0,          /* tp_print */
+    0,          /* tp_getattr */
+    0,          /* tp_setattr */
+    0,
+    0,          /* tp_repr */
+    0,          /* tp_as_number */
+    0,          /* tp_as_sequence */
+    0,          /* tp_as_mapping */
+    0,      /* tp_hash */
+    0,      /* tp_call */
+    0,          /* tp_str */
+    0,    /* tp_getattro */
+    0,          /* tp_setattro */
+    &PythonQtNumericBuffer_as_buffer,          /* tp_as_buffer */
+#ifdef PY3K
+    Py_TPFLAGS_DEFAULT,/* tp_flags */
+#else
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER,/* tp_flags */
+#endif
+    "Exports the data of a numeric Qt container via the buffer protocol",          /* tp_doc */
+};
+
+PyObject* PythonQtNumericBuffer_New(PythonQtNumericBufferData* data, const char* format, int itemSize)
+{
+  PythonQtNumericBufferObject* exporter = PyObject_New(PythonQtNumericBufferObject, &PythonQtNumericBuffer_Type);
+  if (!exporter) {
+    delete data;
+    return NULL;
+  }
+  exporter->_data = data;
+  exporter->_format = format;
+  exporter->_itemSize = itemSize;
+  exporter->_count = data->count();
+  PyObject* view = PyMemoryView_FromObject((PyObject*)exporter);
+  Py_DECREF(exporter);
+  return view;
+}
+
+//! returns 'i' for signed integers, 'u' for unsigned integers and 'f' for floating point formats,
+//! 0 for all other formats
+static char PythonQtNumericBuffer_kind(const char* format)
+{
+  // only the native byte order is supported
+  if (*format == '@' || *format == '=') {
+    format++;
+  }
+  if (format[0] == 0 || format[1] != 0) {
+    return 0;
+  }
+  if (strchr("bhilqn", format[0])) {
+    return 'i';
+  } else if (strchr("BHILQN", format[0])) {
+    return 'u';
+  } else if (strchr("fd", format[0])) {
+    return 'f';
+  }
+  return 0;
+}
+
+bool PythonQtNumericBuffer_GetContiguous(PyObject* obj, const char* format, int itemSize, Py_buffer* view)
+{
+  if (!PyObject_CheckBuffer(obj)) {
+    return false;
+  }
+  if (PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+    PyErr_Clear();
+    return false;
+  }
+  // a NULL format means unsigned bytes
+  char kind = PythonQtNumericBuffer_kind(view->format ? view->format : "B");
+  if (view->ndim <= 1 && view->itemsize == itemSize && kind != 0 && kind == PythonQtNumericBuffer_kind(format)) {
+    return true;
+  }
+  PyBuffer_Release(view);
+  return false;
+}
@@ -0,0 +1,170 @@
+#ifndef _PYTHONQTNUMERICBUFFER_H
+#define _PYTHONQTNUMERICBUFFER_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtNumericBuffer.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+
+#include "PythonQtSystem.h"
+
+#include <QList>
+#include <QVector>
+#include <vector>
+#include <algorithm>
+
+extern PYTHONQT_EXPORT PyTypeObject PythonQtNumericBuffer_Type;
+
+#define PythonQtNumericBuffer_Check(op) (Py_TYPE(op) == &PythonQtNumericBuffer_Type)
+
+//! the contiguous elements that are exported by a PythonQtNumericBufferObject
+class PYTHONQT_EXPORT PythonQtNumericBufferData
+{
+public:
+  virtual ~PythonQtNumericBufferData() {}
+
+  //! returns the address of the first element
+  virtual const void* data() const = 0;
+
+  //! returns the number of elements
+  virtual Py_ssize_t count() const = 0;
+};
+
+//! defines a python object that exports the data of a numeric Qt container via the buffer protocol,
+//! the data is exported read-only with the struct module format of the element type
+typedef struct {
+    PyObject_HEAD
+    PythonQtNumericBufferData* _data;
+    const char* _format;
+    Py_ssize_t _itemSize;
+    Py_ssize_t _count;
+} PythonQtNumericBufferObject;
+
+//! returns a new read-only memoryview on the given \c data, which takes ownership of \c data
+PYTHONQT_EXPORT PyObject* PythonQtNumericBuffer_New(PythonQtNumericBufferData* data, const char* format, int itemSize);
+
+//! gets a C contiguous one-dimensional buffer from \c obj whose elements match the given format and size,
+//! the signedness has to match, but the integer format characters may differ (e.g. 'l' and 'q' are both accepted for 8 byte integers).
+//! Returns false (without an exception) if \c obj does not provide such a buffer, otherwise \c view has to be released with PyBuffer_Release.
+PYTHONQT_EXPORT bool PythonQtNumericBuffer_GetContiguous(PyObject* obj, const char* format, int itemSize, Py_buffer* view);
+
+//! returns the struct module format of the numeric type \c T, or NULL if \c T is not exported as a buffer
+template<class T> struct PythonQtNumericBufferFormat { static const char* format() { return NULL; } };
+template<> struct PythonQtNumericBufferFormat<int> { static const char* format() { return "i"; } };
+template<> struct PythonQtNumericBufferFormat<unsigned int> { static const char* format() { return "I"; } };
+template<> struct PythonQtNumericBufferFormat<qint64> { static const char* format() { return "q"; } };
+template<> struct PythonQtNumericBufferFormat<quint64> { static const char* format() { return "Q"; } };
+template<> struct PythonQtNumericBufferFormat<float> { static const char* format() { return "f"; } };
+template<> struct PythonQtNumericBufferFormat<double> { static const char* format() { return "d"; } };
+
+//! buffer data on a copy of a contiguous container (QVector shares its data)
+template<class VectorType>
+class PythonQtNumericBufferDataOfVector : public PythonQtNumericBufferData
+{
+public:
+  PythonQtNumericBufferDataOfVector(const VectorType& vector):_vector(vector) {}
+
+  virtual const void* data() const { return _vector.empty() ? NULL : &_vector[0]; }
+  virtual Py_ssize_t count() const { return Py_ssize_t(_vector.size()); }
+
+private:
+  VectorType _vector;
+};
+
+//! returns a memoryview on the elements of \c list
+template<class T>
+PyObject* PythonQtNumericBuffer_FromList(const QVector<T>& list)
+{
+  return PythonQtNumericBuffer_New(new PythonQtNumericBufferDataOfVector<QVector<T> >(list), PythonQtNumericBufferFormat<T>::format(), sizeof(T));
+}
+
+//! returns a memoryview on the elements of \c list
+template<class T>
+PyObject* PythonQtNumericBuffer_FromList(const std::vector<T>& list)
+{
+  return PythonQtNumericBuffer_New(new PythonQtNumericBufferDataOfVector<std::vector<T> >(list), PythonQtNumericBufferFormat<T>::format(), sizeof(T));
+}
+
+//! returns a memoryview on a contiguous copy of the elements of \c list (e.g. QList, which is not contiguous for all element types)
+template<class ListType>
+PyObject* PythonQtNumericBuffer_FromList(const ListType& list)
+{
+  return PythonQtNumericBuffer_FromList(std::vector<typename ListType::value_type>(list.begin(), list.end()));
+}
+
+//! replaces the content of \c list with the \c count elements at \c data
+template<class T>
+void PythonQtNumericBuffer_AssignTo(QVector<T>& list, const T* data, int count)
+{
+  list.resize(count);
+  std::copy(data, data + count, list.data());
+}
+
+//! replaces the content of \c list with the \c count elements at \c data
+template<class T>
+void PythonQtNumericBuffer_AssignTo(std::vector<T>& list, const T* data, int count)
+{
+  list.assign(data, data + count);
+}
+
+//! replaces the content of \c list with the \c count elements at \c data
+template<class T>
+void PythonQtNumericBuffer_AssignTo(QList<T>& list, const T* data, int count)
+{
+  list.clear();
+  list.reserve(count);
+  for (int i = 0; i < count; i++) {
+    list.append(data[i]);
+  }
+}
+
+//! replaces the content of \c list with the \c count elements at \c data
+template<class ListType, class T>
+void PythonQtNumericBuffer_AssignTo(ListType& list, const T* data, int count)
+{
+  list.clear();
+  for (int i = 0; i < count; i++) {
+    list.push_back(data[i]);
+  }
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*
+*
+*  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  Further, this software is distributed without any warranty that it is
+*  free of the rightful claim of any third person regarding infringement
+*  or the like.  Any license provided herein, whether implied or
+*  otherwise, applies only to this software file.  Patent licenses, if
+*  any, provided herein do not apply to combinations of this program with
+*  other software, or any other product whatsoever.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*
+*  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+*  28359 Bremen, Germany or:
+*
+*  http://www.mevis.de
+*
+*/
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtProfiler.cpp
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtProfiler.h"
+#include "PythonQtMethodInfo.h"
+#include "PythonQtClassInfo.h"
+
+#include <QObject>
+#include <QMetaObject>
+#include <QMetaProperty>
+
+bool PythonQtProfiler::_enabled = false;
+QElapsedTimer PythonQtProfiler::_timer;
+QList<PythonQtProfilerStats*> PythonQtProfiler::_stats;
+QHash<QPair<const QMetaObject*, int>, PythonQtProfilerStats*> PythonQtProfiler::_propertyStats;
+
+void PythonQtProfiler::setEnabled(bool enabled)
+{
+  if (enabled && !_timer.isValid()) {
+    _timer.start();
+  }
+  _enabled = enabled;
+}
+
+qint64 PythonQtProfiler::now()
+{
+#if QT_VERSION >= 0x040800
+  return _timer.nsecsElapsed();
+#else
+  return _timer.elapsed() * 1000000;
+#endif
+}
+
+PythonQtProfilerStats* PythonQtProfiler::slotStats(PythonQtSlotInfo* slot, PythonQtClassInfo* classInfo, QObject* objectToCall)
+{
+  PythonQtProfilerStats* stats = slot->profilerStats();
+  if (!stats) {
+    stats = new PythonQtProfilerStats;
+    if (classInfo) {
+      stats->name = classInfo->className();
+    } else if (slot->decorator()) {
+      stats->name = slot->decorator()->metaObject()->className();
+    } else if (objectToCall) {
+      stats->name = objectToCall->metaObject()->className();
+    }
+    stats->name += "::";
+    stats->name += slot->signature();
+    _stats.append(stats);
+    slot->setProfilerStats(stats);
+  }
+  return stats;
+}
+
+PythonQtProfilerStats* PythonQtProfiler::propertyStats(const QMetaObject* metaObject, const QMetaProperty& property, bool write)
+{
+  QPair<const QMetaObject*, int> key(metaObject, property.propertyIndex() * 2 + (write ? 1 : 0));
+  PythonQtProfilerStats* stats = _propertyStats.value(key);
+  if (!stats) {
+    stats = new PythonQtProfilerStats;
+    stats->name = metaObject->className();
+    stats->name += write ? "::setProperty(" : "::getProperty(";
+    stats->name += property.name();
+    stats->name += ")";
+    _stats.append(stats);
+    _propertyStats.insert(key, stats);
+  }
+  return stats;
+}
+
+void PythonQtProfiler::addCall(PythonQtProfilerStats* stats, qint64 conversionTime, qint64 cppTime)
+{
+  qint64 time = conversionTime + cppTime;
+  stats->calls++;
+  stats->totalTime += time;
+  stats->conversionTime += conversionTime;
+  stats->cppTime += cppTime;
+  if (time > stats->maxTime) {
+    stats->maxTime = time;
+  }
+}
+
+QList<PythonQtProfilerStats> PythonQtProfiler::stats()
+{
+  QList<PythonQtProfilerStats> result;
+  Q_FOREACH(PythonQtProfilerStats* stats, _stats) {
+    if (stats->calls > 0 || stats->overloadRetries > 0) {
+      result.append(*stats);
+    }
+  }
+  return result;
+}
+
+void PythonQtProfiler::reset()
+{
+  Q_FOREACH(PythonQtProfilerStats* stats, _stats) {
+    QByteArray name = stats->name;
+    *stats = PythonQtProfilerStats();
+    stats->name = name;
+  }
+}
+
+void PythonQtProfiler::clear()
+{
+  qDeleteAll(_stats);
+  _stats.clear();
+  _propertyStats.clear();
+}
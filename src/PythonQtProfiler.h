@@ -0,0 +1,121 @@
+#ifndef _PYTHONQTPROFILER_H
+#define _PYTHONQTPROFILER_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtProfiler.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtSystem.h"
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QPair>
+
+class PythonQtSlotInfo;
+class PythonQtClassInfo;
+class QObject;
+struct QMetaObject;
+class QMetaProperty;
+
+//! statistics of a slot or property collected by the built-in profiler, all times are in nanoseconds
+struct PythonQtProfilerStats {
+  PythonQtProfilerStats() {
+    calls = 0;
+    totalTime = 0;
+    maxTime = 0;
+    conversionTime = 0;
+    cppTime = 0;
+    overloadRetries = 0;
+  }
+
+  QByteArray name;         //!< "Class::slot(args)", "Class::getProperty(name)" or "Class::setProperty(name)"
+  qint64 calls;            //!< the number of calls
+  qint64 totalTime;        //!< the total time of all calls
+  qint64 maxTime;          //!< the time of the slowest call
+  qint64 conversionTime;   //!< the time spent converting arguments and return values
+  qint64 cppTime;          //!< the time spent in the C++ code
+  qint64 overloadRetries;  //!< the number of overloads that did not match before this slot was called
+};
+
+//! the built-in profiler of PythonQt, see PythonQt::setProfilingEnabled().
+//! The statistics are only modified while the GIL is held.
+class PYTHONQT_EXPORT PythonQtProfiler
+{
+public:
+  //! returns if the profiler is enabled
+  static bool isEnabled() { return _enabled; }
+
+  //! enable/disable the profiler, the collected statistics are kept
+  static void setEnabled(bool enabled);
+
+  //! returns a monotonic time stamp in nanoseconds
+  static qint64 now();
+
+  //! returns the statistics of the given slot, they are created on first use
+  static PythonQtProfilerStats* slotStats(PythonQtSlotInfo* slot, PythonQtClassInfo* classInfo, QObject* objectToCall);
+
+  //! returns the statistics of reading or writing the given property, they are created on first use
+  static PythonQtProfilerStats* propertyStats(const QMetaObject* metaObject, const QMetaProperty& property, bool write);
+
+  //! adds a call with the given times to the statistics
+  static void addCall(PythonQtProfilerStats* stats, qint64 conversionTime, qint64 cppTime);
+
+  //! returns a copy of the statistics of all slots and properties that were called
+  static QList<PythonQtProfilerStats> stats();
+
+  //! resets the statistics of all slots and properties to zero
+  static void reset();
+
+  //! deletes all statistics, called on PythonQt cleanup after the slot infos are deleted
+  static void clear();
+
+private:
+  static bool _enabled;
+  static QElapsedTimer _timer;
+  //! all statistics, owned by the profiler
+  static QList<PythonQtProfilerStats*> _stats;
+  //! the property statistics by meta object and (property index * 2 + write)
+  static QHash<QPair<const QMetaObject*, int>, PythonQtProfilerStats*> _propertyStats;
+};
+
+#endif
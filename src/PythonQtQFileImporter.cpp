@@ -39,6 +39,7 @@
  */
 //----------------------------------------------------------------------------------
 
+#include <QDir>
 #include <QFile>
 #include <QFileInfo>
 
@@ -78,3 +79,8 @@ QDateTime PythonQtQFileImporter::lastModifiedDate (const QString &filename) {
   QFileInfo fi(filename);
   return fi.lastModified();
 }
+
+QStringList PythonQtQFileImporter::listDirectory (const QString &path) {
+  QDir dir(path);
+  return dir.entryList(QDir::AllEntries | QDir::Hidden | QDir::System | QDir::NoDotAndDotDot);
+}
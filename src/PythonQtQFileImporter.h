@@ -58,6 +58,10 @@ public:
     
     QDateTime lastModifiedDate (const QString &filename);
 
+    bool supportsDirectoryListing() { return true; }
+
+    QStringList listDirectory (const QString &path);
+
 };
 
 #endif
@@ -0,0 +1,158 @@
+/*
+*
+*  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  Further, this software is distributed without any warranty that it is
+*  free of the rightful claim of any third person regarding infringement
+*  or the like.  Any license provided herein, whether implied or
+*  otherwise, applies only to this software file.  Patent licenses, if
+*  any, provided herein do not apply to combinations of this program with
+*  other software, or any other product whatsoever.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*
+*  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+*  28359 Bremen, Germany or:
+*
+*  http://www.mevis.de
+*
+*/
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtSequenceView.cpp
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtSequenceView.h"
+
+static void PythonQtSequenceView_dealloc(PythonQtSequenceViewObject* self)
+{
+  delete self->_data;
+  self->_data = NULL;
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static Py_ssize_t PythonQtSequenceView_length(PythonQtSequenceViewObject* self)
+{
+  return self->_data->size();
+}
+
+static PyObject* PythonQtSequenceView_item(PythonQtSequenceViewObject* self, Py_ssize_t index)
+{
+  if (index < 0 || index >= self->_data->size()) {
+    PyErr_SetString(PyExc_IndexError, "sequence view index out of range");
+    return NULL;
+  }
+  return self->_data->item(index);
+}
+
+static PyObject* PythonQtSequenceView_subscript(PythonQtSequenceViewObject* self, PyObject* key)
+{
+  if (PySlice_Check(key)) {
+    Py_ssize_t start, stop, step, length;
+#ifdef PY3K
+    if (PySlice_GetIndicesEx(key, self->_data->size(), &start, &stop, &step, &length) < 0) {
+#else
+    if (PySlice_GetIndicesEx((PySliceObject*)key, self->_data->size(), &start, &stop, &step, &length) < 0) {
+#endif
+      return NULL;
+    }
+    // only the elements of the slice are converted
+    PyObject* result = PyTuple_New(length);
+    for (Py_ssize_t i = 0; i < length; i++) {
+      PyObject* item = self->_data->item(start + i * step);
+      if (!item) {
+        Py_DECREF(result);
+        return NULL;
+      }
+      PyTuple_SET_ITEM(result, i, item);
+    }
+    return result;
+  }
+  if (PyIndex_Check(key)) {
+    Py_ssize_t index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+    if (index == -1 && PyErr_Occurred()) {
+      return NULL;
+    }
+    if (index < 0) {
+      index += self->_data->size();
+    }
+    return PythonQtSequenceView_item(self, index);
+  }
+  PyErr_Format(PyExc_TypeError, "sequence view indices must be integers or slices, not %.200s", Py_TYPE(key)->tp_name);
+  return NULL;
+}
+
+static PyObject* PythonQtSequenceView_repr(PythonQtSequenceViewObject* self)
+{
+#ifdef PY3K
+  return PyUnicode_FromFormat("<PythonQt sequence view of %d elements>", self->_data->size());
+#else
+  return PyString_FromFormat("<PythonQt sequence view of %d elements>", self->_data->size());
+#endif
+}
+
+static PySequenceMethods PythonQtSequenceView_as_sequence = {
+  (lenfunc)PythonQtSequenceView_length,      /* sq_length */
+  0,      /* sq_concat */
+  0,      /* sq_repeat */
+  (ssizeargfunc)PythonQtSequenceView_item,      /* sq_item */
+};
+
+static PyMappingMethods PythonQtSequenceView_as_mapping = {
+  (lenfunc)PythonQtSequenceView_length,      /* mp_length */
+  (binaryfunc)PythonQtSequenceView_subscript,      /* mp_subscript */
+  0,      /* mp_ass_subscript */
+};
+
+PyTypeObject PythonQtSequenceView_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "SequenceView",
+    sizeof(PythonQtSequenceViewObject),
+    0,
+    (destructor)PythonQtSequenceView_dealloc,     /* tp_dealloc */
+    0,          /* tp_print */
+    0,          /* tp_getattr */
+    0,          /* tp_setattr */
+    0,
+    (reprfunc)PythonQtSequenceView_repr,          /* tp_repr */
+    0,          /* tp_as_number */
+    &PythonQtSequenceView_as_sequence,          /* tp_as_sequence */
+    &PythonQtSequenceView_as_mapping,          /* tp_as_mapping */
+    0,      /* tp_hash */
+    0,      /* tp_call */
+    0,          /* tp_str */
+    0,    /* tp_getattro */
+    0,          /* tp_setattro */
+    0,          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,/* tp_flags */
+    "A read-only sequence on a returned Qt container, which converts the elements on access",          /* tp_doc */
+};
+
+PyObject* PythonQtSequenceView_New(PythonQtSequenceViewData* data)
+{
+  PythonQtSequenceViewObject* view = PyObject_New(PythonQtSequenceViewObject, &PythonQtSequenceView_Type);
+  if (!view) {
+    delete data;
+    return NULL;
+  }
+  view->_data = data;
+  return (PyObject*)view;
+}
@@ -0,0 +1,78 @@
+#ifndef _PYTHONQTSEQUENCEVIEW_H
+#define _PYTHONQTSEQUENCEVIEW_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtSequenceView.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+
+#include "PythonQtSystem.h"
+
+extern PYTHONQT_EXPORT PyTypeObject PythonQtSequenceView_Type;
+
+#define PythonQtSequenceView_Check(op) (Py_TYPE(op) == &PythonQtSequenceView_Type)
+
+//! the elements that are viewed by a PythonQtSequenceViewObject, which are converted to Python on access
+class PYTHONQT_EXPORT PythonQtSequenceViewData
+{
+public:
+  virtual ~PythonQtSequenceViewData() {}
+
+  //! returns the number of elements
+  virtual int size() const = 0;
+
+  //! returns the element at the given index (0 <= index < size()) as new reference
+  virtual PyObject* item(int index) const = 0;
+};
+
+//! defines a read-only python sequence (len, indexing, slicing, iteration) on a copy of a returned Qt container,
+//! the elements are only converted when they are accessed
+typedef struct {
+    PyObject_HEAD
+    PythonQtSequenceViewData* _data;
+} PythonQtSequenceViewObject;
+
+//! returns a new sequence view on the given \c data, the view takes ownership of \c data
+PYTHONQT_EXPORT PyObject* PythonQtSequenceView_New(PythonQtSequenceViewData* data);
+
+#endif
@@ -46,6 +46,7 @@
 #include "PythonQtMisc.h"
 #include "PythonQtConversion.h"
 #include "PythonQtSlot.h"
+#include "PythonQtEventLoop.h"
 
 #include <iostream>
 
@@ -251,6 +252,28 @@ static PyMethodDef meth_methods[] = {
   {NULL, NULL, 0 , NULL}  /* Sentinel */
 };
 
+#ifdef PYTHONQT_SUPPORTS_ASYNCIO
+static PyObject *
+meth_await(PythonQtSignalFunctionObject *m)
+{
+  PythonQtObjectPtr module = PythonQt::priv()->asyncioEventLoopModule();
+  if (!module) {
+    PyErr_SetString(PyExc_RuntimeError, "awaiting a signal requires the PythonQt asyncio event loop, see PythonQt::installAsyncioEventLoop()");
+    return NULL;
+  }
+  if (!PyObject_TypeCheck(m->m_self, &PythonQtInstanceWrapper_Type)) {
+    PyErr_SetString(PyExc_TypeError, "only the signals of an object can be awaited");
+    return NULL;
+  }
+  // returns the iterator of a future that is finished by the next emit of the signal
+  return PyObject_CallMethod(module, const_cast<char*>("awaitSignal"), const_cast<char*>("O"), m);
+}
+
+static PyAsyncMethods meth_as_async = {
+  (unaryfunc)meth_await,      /* am_await */
+};
+#endif
+
 static PyObject *
 meth_repr(PythonQtSignalFunctionObject *f)
 {
@@ -341,7 +364,9 @@ PyTypeObject PythonQtSignalFunction_Type = {
     0,          /* tp_print */
     0,          /* tp_getattr */
     0,          /* tp_setattr */
-#ifdef PY3K
+#if defined(PYTHONQT_SUPPORTS_ASYNCIO)
+    &meth_as_async,             /* tp_as_async */
+#elif defined(PY3K)
     0,
 #else
     (cmpfunc)meth_compare,      /* tp_compare */
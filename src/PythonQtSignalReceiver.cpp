@@ -62,6 +62,9 @@ PyObject* PythonQtSignalTarget::call(PyObject* callable, const PythonQtMethodInf
 {
   Q_UNUSED(skipFirstArgumentOfMethodInfo)
 
+  // the signal may be emitted from any thread, so we need to make sure that we hold the GIL
+  PYTHONQT_GIL_SCOPE
+
   // Note: we check if the callable is a PyFunctionObject and has a fixed number of arguments
   // if that is the case, we only pass these arguments to python and skip the additional arguments from the signal
 
@@ -173,6 +176,9 @@ PythonQtSignalReceiver::PythonQtSignalReceiver(QObject* obj):PythonQtSignalRecei
 PythonQtSignalReceiver::~PythonQtSignalReceiver()
 {
   PythonQt::priv()->removeSignalEmitter(_obj);
+  // the targets hold references to the Python callables
+  PYTHONQT_GIL_SCOPE
+  _targets.clear();
 }
 
 
@@ -181,15 +187,19 @@ bool PythonQtSignalReceiver::addSignalHandler(const char* signal, PyObject* call
   bool flag = false;
   int sigId = getSignalIndex(signal);
   if (sigId>=0) {
+    int slotId = _slotIdForSignal.value(sigId, -1);
+    if (slotId == -1) {
+      // connect the signal to a new simulated slot, which is shared by all callables of the signal
+      slotId = _slotCount;
+      _slotCount++;
+      _slotIdForSignal.insert(sigId, slotId);
+      QMetaObject::connect(_obj, sigId, this, slotId, Qt::AutoConnection, 0);
+    }
     // create PythonQtMethodInfo from signal
     QMetaMethod meta = _obj->metaObject()->method(sigId);
     const PythonQtMethodInfo* signalInfo = PythonQtMethodInfo::getCachedMethodInfo(meta, _objClassInfo);
-    PythonQtSignalTarget t(sigId, signalInfo, _slotCount, callable);
-    _targets.append(t);
-    // now connect to ourselves with the new slot id
-    QMetaObject::connect(_obj, sigId, this, _slotCount, Qt::AutoConnection, 0);
+    _targets[slotId].append(PythonQtSignalTarget(sigId, signalInfo, slotId, callable));
 
-    _slotCount++;
     flag = true;
 
     if (sigId == _destroyedSignal1Id || sigId == _destroyedSignal2Id) {
@@ -209,25 +219,30 @@ bool PythonQtSignalReceiver::removeSignalHandler(const char* signal, PyObject* c
   int foundCount = 0;
   int sigId = getSignalIndex(signal);
   if (sigId>=0) {
-    QMutableListIterator<PythonQtSignalTarget> i(_targets);
-    if (callable) {
-      while (i.hasNext()) {
-        if (i.next().isSame(sigId, callable)) {
-          i.remove();
-          foundCount++;
-          break;
+    int slotId = _slotIdForSignal.value(sigId, -1);
+    if (slotId != -1) {
+      QList<PythonQtSignalTarget>& targets = _targets[slotId];
+      if (callable) {
+        for (int i = 0; i < targets.size(); i++) {
+          if (targets.at(i).isSame(sigId, callable)) {
+            targets.removeAt(i);
+            foundCount++;
+            break;
+          }
         }
+      } else {
+        foundCount = targets.size();
+        targets.clear();
       }
-    } else {
-      while (i.hasNext()) {
-        if (i.next().signalId() == sigId) {
-          i.remove();
-          foundCount++;
-        }
+      if (targets.isEmpty()) {
+        // no more callables, so we do not need to receive the signal anymore
+        _targets.remove(slotId);
+        _slotIdForSignal.remove(sigId);
+        QMetaObject::disconnect(_obj, sigId, this, slotId);
       }
     }
   }
-  if ((foundCount>0) && (sigId == _destroyedSignal1Id) || (sigId == _destroyedSignal2Id)) {
+  if ((foundCount>0) && ((sigId == _destroyedSignal1Id) || (sigId == _destroyedSignal2Id))) {
     _destroyedSignalCount -= foundCount;
     if (_destroyedSignalCount==0) {
       // make ourself child of QObject again, to get deleted when the object gets deleted
@@ -254,18 +269,28 @@ int PythonQtSignalReceiver::qt_metacall(QMetaObject::Call c, int id, void **argu
     QObject::qt_metacall(c, id, arguments);
   }
 
-  Q_FOREACH(const PythonQtSignalTarget& t, _targets) {
-    if (t.slotId() == id) {
+  PYTHONQT_GIL_SCOPE
+
+  QHash<int, QList<PythonQtSignalTarget> >::const_iterator it = _targets.constFind(id);
+  if (it != _targets.constEnd()) {
+    // the list is implicitly shared, so this does not copy the targets, but it allows
+    // the called handlers to add/remove signal handlers while we iterate
+    const QList<PythonQtSignalTarget> targets = it.value();
+    int destroyedSignalCalls = 0;
+    for (int i = 0; i < targets.size(); i++) {
+      const PythonQtSignalTarget& t = targets.at(i);
       t.call(arguments);
-      // if the signal is the last destroyed signal, we delete ourselves
       int sigId = t.signalId();
       if ((sigId == _destroyedSignal1Id) || (sigId == _destroyedSignal2Id)) {
-        _destroyedSignalCount--;
-        if (_destroyedSignalCount == 0) {
-          delete this;
-        }
+        destroyedSignalCalls++;
+      }
+    }
+    if (destroyedSignalCalls > 0) {
+      // if the signal is the last destroyed signal, we delete ourselves
+      _destroyedSignalCount -= destroyedSignalCalls;
+      if (_destroyedSignalCount <= 0) {
+        delete this;
       }
-      break;
     }
   }
   return 0;
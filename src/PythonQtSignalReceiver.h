@@ -46,6 +46,8 @@
 
 #include "PythonQtSystem.h"
 #include "PythonQtObjectPtr.h"
+#include <QHash>
+#include <QList>
 
 class PythonQtMethodInfo;
 class PythonQtClassInfo;
@@ -132,8 +134,11 @@ private:
   PythonQtClassInfo* _objClassInfo;
   int _slotCount;
   int _destroyedSignalCount;
-  // linear list may get slow on multiple targets, but I think typically we have many objects and just a few signals
-  QList<PythonQtSignalTarget> _targets;
+  //! maps the simulated slot ids to the targets that are called when the slot is invoked,
+  //! all targets of one signal share the same slot id
+  QHash<int, QList<PythonQtSignalTarget> > _targets;
+  //! maps the signal ids to the simulated slot ids that they are connected to
+  QHash<int, int> _slotIdForSignal;
 
   static int _destroyedSignal1Id;
   static int _destroyedSignal2Id;
@@ -45,6 +45,8 @@
 #include "PythonQtClassInfo.h"
 #include "PythonQtMisc.h"
 #include "PythonQtConversion.h"
+#include "PythonQtProfiler.h"
+#include "PythonQtDirectCall.h"
 #include <iostream>
 
 #include <exception>
@@ -54,16 +56,56 @@
 
 #define PYTHONQT_MAX_ARGS 32
 
+//! calls the direct call of the slot (see PythonQtDirectCall.h) instead of qt_metacall
+static PyObject* PythonQtCallDirectCall(PythonQtDirectCallCB* directCall, PythonQtClassInfo* classInfo, QObject* objectToCall, PyObject* args, bool strict, PythonQtSlotInfo* info, void* firstArgument)
+{
+  // the generic argument converters still use the value storages, see PythonQtCallSlot()
+  PythonQtValueStoragePosition globalValueStoragePos;
+  PythonQtValueStoragePosition globalPtrStoragePos;
+  PythonQtValueStoragePosition globalVariantStoragePos;
+  PythonQtConv::global_valueStorage.getPos(globalValueStoragePos);
+  PythonQtConv::global_ptrStorage.getPos(globalPtrStoragePos);
+  PythonQtConv::global_variantStorage.getPos(globalVariantStoragePos);
+
+  qint64 startTime = PythonQtProfiler::isEnabled() ? PythonQtProfiler::now() : 0;
+
+  void* object = NULL;
+  if (info->isInstanceDecorator()) {
+    // for decorators on CPP objects, we take the cpp ptr, for QObjects we take the QObject pointer
+    object = firstArgument ? firstArgument : objectToCall;
+    if (object) {
+      // upcast to correct parent class
+      object = ((char*)object)+info->upcastingOffset();
+    }
+  }
+  PythonQtDirectCallContext context(classInfo, info, objectToCall, args, strict);
+  PyObject* result = (*directCall)(context, info->decorator(), object, args);
+
+  if (context.profiled()) {
+    PythonQtProfilerStats* stats = PythonQtProfiler::slotStats(info, classInfo, objectToCall);
+    PythonQtProfiler::addCall(stats, (context.cppStartTime() - startTime) + (PythonQtProfiler::now() - context.cppEndTime()), context.cppEndTime() - context.cppStartTime());
+  }
+
+  PythonQtConv::global_valueStorage.setPos(globalValueStoragePos);
+  PythonQtConv::global_ptrStorage.setPos(globalPtrStoragePos);
+  PythonQtConv::global_variantStorage.setPos(globalVariantStoragePos);
+  return result;
+}
 
 bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObject* args, bool strict, PythonQtSlotInfo* info, void* firstArgument, PyObject** pythonReturnValue, void** directReturnValuePointer)
 {
-  static unsigned int recursiveEntry = 0;
-
   if (directReturnValuePointer) {
     *directReturnValuePointer = NULL;
   }
+  PythonQtDirectCallCB* directCall = info->directCall();
+  if (directCall && !directReturnValuePointer) {
+    // typed call generated for the wrapper slot, which converts the arguments itself and skips qt_metacall
+    *pythonReturnValue = PythonQtCallDirectCall(directCall, classInfo, objectToCall, args, strict, info, firstArgument);
+    return *pythonReturnValue != NULL;
+  }
   // store the current storage position, so that we can get back to this state after a slot is called
-  // (do this locally, so that we have all positions on the stack
+  // (do this locally, so that we have all positions on the stack, the storages are per thread,
+  // so slots of other threads that run while the GIL is released do not interfere)
   PythonQtValueStoragePosition globalValueStoragePos;
   PythonQtValueStoragePosition globalPtrStoragePos;
   PythonQtValueStoragePosition globalVariantStoragePos;
@@ -71,15 +113,21 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
   PythonQtConv::global_ptrStorage.getPos(globalPtrStoragePos);
   PythonQtConv::global_variantStorage.getPos(globalVariantStoragePos);
 
-  recursiveEntry++;
+  // the time stamps of the built-in profiler
+  bool profiling = PythonQtProfiler::isEnabled();
+  qint64 startTime = profiling ? PythonQtProfiler::now() : 0;
+  qint64 cppStartTime = 0;
+  qint64 cppEndTime = 0;
+  bool profiledCall = false;
 
   // the arguments that are passed to qt_metacall
   void* argList[PYTHONQT_MAX_ARGS];
   PyObject* result = NULL;
   int argc = info->parameterCount();
-  const QList<PythonQtSlotInfo::ParameterInfo>& params = info->parameters();
+  // the precompiled converters, the first one is for the return value
+  const PythonQtArgumentConverter* converters = info->argumentConverters();
 
-  const PythonQtSlotInfo::ParameterInfo& returnValueParam = params.at(0);
+  const PythonQtSlotInfo::ParameterInfo& returnValueParam = *converters[0].info;
   // set return argument to NULL
   argList[0] = NULL;
 
@@ -101,8 +149,8 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
     argList[1] = &arg1;
     if (ok) {
       for (int i = 2; i<argc && ok; i++) {
-        const PythonQtSlotInfo::ParameterInfo& param = params.at(i);
-        argList[i] = PythonQtConv::ConvertPythonToQt(param, PyTuple_GET_ITEM(args, i-2), strict, classInfo);
+        const PythonQtArgumentConverter& converter = converters[i];
+        argList[i] = (*converter.toQt)(*converter.info, PyTuple_GET_ITEM(args, i-2), strict, classInfo);
         if (argList[i]==NULL) {
           ok = false;
           break;
@@ -111,8 +159,8 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
     }
   } else {
     for (int i = 1; i<argc && ok; i++) {
-      const PythonQtSlotInfo::ParameterInfo& param = params.at(i);
-      argList[i] = PythonQtConv::ConvertPythonToQt(param, PyTuple_GET_ITEM(args, i-1), strict, classInfo);
+      const PythonQtArgumentConverter& converter = converters[i];
+      argList[i] = (*converter.toQt)(*converter.info, PyTuple_GET_ITEM(args, i-1), strict, classInfo);
       if (argList[i]==NULL) {
         ok = false;
         break;
@@ -167,7 +215,14 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
       hadException = true;
       PyErr_SetString(PyExc_RuntimeError, "Trying to call a slot on a deleted QObject!");
     } else {
+      // release the GIL while the C++ code runs, unless the slot deals with Python objects itself
+      bool releaseGIL = PythonQtThreadSupport::isEnabled() && !info->usesPythonObjects();
+      if (profiling) {
+        profiledCall = true;
+        cppStartTime = PythonQtProfiler::now();
+      }
       try {
+        PythonQtThreadStateSaver threadStateSaver(releaseGIL);
         obj->qt_metacall(QMetaObject::InvokeMetaMethod, info->slotIndex(), argList);
       } catch (std::out_of_range & e) {
         hadException = true;
@@ -195,6 +250,9 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
         what += e.what();
         PyErr_SetString(PyExc_RuntimeError, what.constData());
       }
+      if (profiling) {
+        cppEndTime = PythonQtProfiler::now();
+      }
     }
   
     if (profilingCB) {
@@ -209,7 +267,7 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
         } else {
           // the resulting object maybe present already, because we created it above at 1)...
           if (!result) {
-            result = PythonQtConv::ConvertQtValueToPython(returnValueParam, argList[0]);
+            result = (*converters[0].toPython)(returnValueParam, argList[0]);
           }
         }
       } else {
@@ -221,7 +279,10 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
       result = NULL;
     }
   }
-  recursiveEntry--;
+  if (profiledCall) {
+    PythonQtProfilerStats* stats = PythonQtProfiler::slotStats(info, classInfo, objectToCall);
+    PythonQtProfiler::addCall(stats, (cppStartTime - startTime) + (PythonQtProfiler::now() - cppEndTime), cppEndTime - cppStartTime);
+  }
 
   // reset the parameter storage position to the stored pos to "pop" the parameter stack
   PythonQtConv::global_valueStorage.setPos(globalValueStoragePos);
@@ -307,25 +368,55 @@ PyObject *PythonQtSlotFunction_CallImpl(PythonQtClassInfo* classInfo, QObject* o
     *directReturnValuePointer = NULL;
   }
   if (info->nextInfo()) {
-    // overloaded slot call, try on all slots with strict conversion first
-    bool strict = true;
-    PythonQtSlotInfo* i = info;
-    while (i) {
-      bool skipFirst = i->isInstanceDecorator();
-      if (i->parameterCount()-1-(skipFirst?1:0) == argc) {
-        PyErr_Clear();
-        ok = PythonQtCallSlot(classInfo, objectToCall, args, strict, i, firstArg, &r, directReturnValuePointer);
-        if (PyErr_Occurred() || ok) break;
+    // overloaded slot call, first try the overload that matched the same argument types the last time
+    // the number of overloads that did not match and the one that was called, for the profiler
+    int retries = 0;
+    PythonQtSlotInfo* calledSlot = NULL;
+    PythonQtSlotInfo* cached = info->cachedOverload(args);
+    if (cached) {
+      PyErr_Clear();
+      ok = PythonQtCallSlot(classInfo, objectToCall, args, true, cached, firstArg, &r, directReturnValuePointer);
+      if (ok) {
+        info->addOverloadCacheHit();
+        calledSlot = cached;
+      } else {
+        retries++;
       }
-      i = i->nextInfo();
-      if (!i) {
-        if (strict) {
-          // one more run without being strict
-          strict = false;
-          i = info;
+    }
+    if (!ok && !PyErr_Occurred()) {
+      info->addOverloadCacheMiss();
+      // try on all slots with strict conversion first
+      bool strict = true;
+      PythonQtSlotInfo* i = info;
+      while (i) {
+        bool skipFirst = i->isInstanceDecorator();
+        if (i->parameterCount()-1-(skipFirst?1:0) == argc) {
+          PyErr_Clear();
+          ok = PythonQtCallSlot(classInfo, objectToCall, args, strict, i, firstArg, &r, directReturnValuePointer);
+          if (ok) {
+            // only strict matches are cached, a non-strict match may depend on the argument values
+            if (strict) {
+              info->cacheOverload(args, i);
+            }
+            calledSlot = i;
+          } else {
+            retries++;
+          }
+          if (PyErr_Occurred() || ok) break;
+        }
+        i = i->nextInfo();
+        if (!i) {
+          if (strict) {
+            // one more run without being strict
+            strict = false;
+            i = info;
+          }
         }
       }
     }
+    if (retries && PythonQtProfiler::isEnabled()) {
+      PythonQtProfiler::slotStats(calledSlot ? calledSlot : info, classInfo, objectToCall)->overloadRetries += retries;
+    }
     if (!ok && !PyErr_Occurred()) {
       QString e = QString("Could not find matching overload for given arguments:\n" + PythonQtConv::PyObjGetString(args) + "\n The following slots are available:\n");
       PythonQtSlotInfo* i = info;
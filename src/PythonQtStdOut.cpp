@@ -40,6 +40,116 @@
 //----------------------------------------------------------------------------------
 
 #include "PythonQtStdOut.h"
+#include "PythonQtThreadSupport.h"
+
+#include <string.h>
+
+PythonQtStdOutBuffer::PythonQtStdOutBuffer(int capacity, int flushThreshold)
+{
+  _data.resize(capacity);
+  _start = 0;
+  _size = 0;
+  _completeLinesSize = 0;
+  _flushThreshold = qMin(flushThreshold, capacity);
+  _totalDroppedBytes = 0;
+}
+
+//! returns if the byte is a UTF-8 continuation byte (10xxxxxx)
+static inline bool PythonQtStdOutBuffer_isContinuationByte(char c)
+{
+  return (c & 0xC0) == 0x80;
+}
+
+void PythonQtStdOutBuffer::append(const QByteArray& data)
+{
+  int capacity = _data.size();
+  int count = qMin(data.size(), capacity - _size);
+  const char* src = data.constData();
+  if (count < data.size()) {
+    // only drop complete UTF-8 sequences
+    while (count > 0 && PythonQtStdOutBuffer_isContinuationByte(src[count])) {
+      count--;
+    }
+    _totalDroppedBytes += data.size() - count;
+  }
+  // the last newline of the appended part marks the end of the complete lines
+  for (int i = count - 1; i >= 0; i--) {
+    if (src[i] == '\n') {
+      _completeLinesSize = _size + i + 1;
+      break;
+    }
+  }
+  // copy in (at most) two segments, since the free space may wrap around
+  int end = (_start + _size) % capacity;
+  int firstPart = qMin(count, capacity - end);
+  char* dest = _data.data();
+  memcpy(dest + end, src, firstPart);
+  memcpy(dest, src + firstPart, count - firstPart);
+  _size += count;
+}
+
+QByteArray PythonQtStdOutBuffer::take(bool completeLinesOnly)
+{
+  int capacity = _data.size();
+  int count = completeLinesOnly ? _completeLinesSize : _size;
+  if (!completeLinesOnly && count > 0) {
+    // keep an incomplete UTF-8 sequence at the end for the next flush (a newline always ends a sequence)
+    const char* data = _data.constData();
+    int lead = count - 1;
+    while (lead > 0 && count - lead < 4 && PythonQtStdOutBuffer_isContinuationByte(data[(_start + lead) % capacity])) {
+      lead--;
+    }
+    unsigned char c = data[(_start + lead) % capacity];
+    int sequenceLength = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+    if (lead + sequenceLength > count) {
+      count = lead;
+    }
+  }
+  QByteArray result;
+  if (count > 0) {
+    result.resize(count);
+    int firstPart = qMin(count, capacity - _start);
+    const char* src = _data.constData();
+    memcpy(result.data(), src + _start, firstPart);
+    memcpy(result.data() + firstPart, src, count - firstPart);
+    _start = (_start + count) % capacity;
+    _size -= count;
+  }
+  // there is no newline behind the last newline
+  _completeLinesSize = 0;
+  return result;
+}
+
+void PythonQtStdOutRedirect_setBuffering(PythonQtStdOutRedirect* self, int capacity, int flushThreshold)
+{
+  PythonQtStdOutRedirect_flushBuffer(self, false);
+  delete self->_buffer;
+  self->_buffer = NULL;
+  if (capacity > 0) {
+    self->_buffer = new PythonQtStdOutBuffer(capacity, flushThreshold);
+  }
+}
+
+void PythonQtStdOutRedirect_flushBuffer(PythonQtStdOutRedirect* self, bool completeLinesOnly)
+{
+  // output written while the callback runs stays in the buffer until the next flush
+  if (!self->_buffer || !self->_cb || self->_flushing) {
+    return;
+  }
+  // the number of dropped bytes is reported by PythonQt::droppedStdOutBytes(), not in the output itself
+  QByteArray data = self->_buffer->take(completeLinesOnly);
+  if (data.isEmpty()) {
+    return;
+  }
+  QString output = QString::fromUtf8(data.constData(), data.size());
+  self->_flushing = true;
+  {
+    // see PythonQtStdOutRedirect_write()
+    PYTHONQT_ALLOW_THREADS_SCOPE
+    (*self->_cb)(output);
+  }
+  self->_flushing = false;
+}
 
 static PyObject *PythonQtStdOutRedirect_new(PyTypeObject *type, PyObject * /*args*/, PyObject * /*kwds*/)
 {
@@ -48,10 +158,19 @@ static PyObject *PythonQtStdOutRedirect_new(PyTypeObject *type, PyObject * /*arg
 
   self->softspace = 0;
   self->_cb = NULL;
+  self->_buffer = NULL;
+  self->_flushing = false;
 
   return (PyObject *)self;
 }
 
+static void PythonQtStdOutRedirect_dealloc(PythonQtStdOutRedirect* self)
+{
+  delete self->_buffer;
+  self->_buffer = NULL;
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
 static PyObject *PythonQtStdOutRedirect_write(PyObject *self, PyObject *args)
 {
   PythonQtStdOutRedirect*  s = (PythonQtStdOutRedirect*)self;
@@ -80,18 +199,48 @@ static PyObject *PythonQtStdOutRedirect_write(PyObject *self, PyObject *args)
       }
     }
 
-    if (s->softspace > 0) {
-      (*s->_cb)(QString(""));
+    if (s->_buffer) {
       s->softspace = 0;
+      QByteArray data = output.toUtf8();
+      if (s->_buffer->size() + data.size() > s->_buffer->capacity()) {
+        // make room before anything is dropped
+        PythonQtStdOutRedirect_flushBuffer(s, false);
+        if (s->_buffer->size() == 0 && !s->_flushing) {
+          // output that is larger than the buffer is passed on as a whole,
+          // only output written while the callback runs is dropped when it does not fit
+          s->_flushing = true;
+          {
+            PYTHONQT_ALLOW_THREADS_SCOPE
+            (*s->_cb)(output);
+          }
+          s->_flushing = false;
+          return Py_BuildValue("");
+        }
+      }
+      s->_buffer->append(data);
+      if (s->_buffer->needsFlush()) {
+        PythonQtStdOutRedirect_flushBuffer(s, !s->_buffer->reachedFlushThreshold());
+      }
+      return Py_BuildValue("");
     }
 
+    bool emitSoftspace = s->softspace > 0;
+    s->softspace = 0;
+
+    // the callback emits Qt signals which may be delivered to other threads,
+    // so we do not hold the GIL while it runs (the callback itself does not touch Python)
+    PYTHONQT_ALLOW_THREADS_SCOPE
+    if (emitSoftspace) {
+      (*s->_cb)(QString(""));
+    }
     (*s->_cb)(output);
   }
   return Py_BuildValue("");
 }
 
-static PyObject *PythonQtStdOutRedirect_flush(PyObject * /*self*/, PyObject * /*args*/)
+static PyObject *PythonQtStdOutRedirect_flush(PyObject *self, PyObject * /*args*/)
 {
+  PythonQtStdOutRedirect_flushBuffer((PythonQtStdOutRedirect*)self, false);
   return Py_BuildValue("");
 }
 
@@ -105,7 +254,7 @@ static PyMethodDef PythonQtStdOutRedirect_methods[] = {
   {"write", (PyCFunction)PythonQtStdOutRedirect_write, METH_VARARGS,
   "redirect the writing to a callback"},
   {"flush", (PyCFunction)PythonQtStdOutRedirect_flush, METH_VARARGS,
-  "flush the output, currently not implemented but needed for logging framework"
+  "flush the buffered output (if buffering is enabled)"
   },
   {"isatty", (PyCFunction)PythonQtStdOutRedirect_isatty,   METH_NOARGS,
   "return False since this object is not a tty-like device. Needed for logging framework"
@@ -125,7 +274,7 @@ PyTypeObject PythonQtStdOutRedirectType = {
     "PythonQtStdOutRedirect",             /*tp_name*/
     sizeof(PythonQtStdOutRedirect),             /*tp_basicsize*/
     0,                         /*tp_itemsize*/
-    0, /*tp_dealloc*/
+    (destructor)PythonQtStdOutRedirect_dealloc, /*tp_dealloc*/
     0,                         /*tp_print*/
     0,                         /*tp_getattr*/
     0,                         /*tp_setattr*/
@@ -47,6 +47,7 @@
 
 #include "structmember.h"
 #include <QString>
+#include <QByteArray>
 
 //! declares the type of the stdout redirection class
 extern PyTypeObject PythonQtStdOutRedirectType;
@@ -54,11 +55,61 @@ extern PyTypeObject PythonQtStdOutRedirectType;
 //! declares the callback that is called from the write() function
 typedef void PythonQtOutputChangedCB(const QString& str);
 
+//! a bounded ring buffer that collects the (UTF-8 encoded) output of a buffered stdout redirection,
+//! data that does not fit into the buffer is dropped and counted
+class PythonQtStdOutBuffer {
+public:
+  PythonQtStdOutBuffer(int capacity, int flushThreshold);
+
+  //! appends the data, the part that does not fit into the buffer is dropped
+  void append(const QByteArray& data);
+
+  //! returns if the buffer contains a complete line or reached the flush threshold
+  bool needsFlush() const { return _completeLinesSize > 0 || reachedFlushThreshold(); }
+
+  //! returns if the buffer reached the flush threshold
+  bool reachedFlushThreshold() const { return _size >= _flushThreshold; }
+
+  //! removes and returns the buffered data, only up to the last newline if \c completeLinesOnly is set,
+  //! an incomplete UTF-8 sequence at the end stays in the buffer
+  QByteArray take(bool completeLinesOnly);
+
+  //! returns the number of buffered bytes
+  int size() const { return _size; }
+
+  //! returns the maximum number of buffered bytes
+  int capacity() const { return _data.size(); }
+
+  //! returns the number of bytes that were dropped since the buffer was created
+  qint64 totalDroppedBytes() const { return _totalDroppedBytes; }
+
+private:
+  QByteArray _data;
+  int _start;
+  int _size;
+  //! the number of buffered bytes up to and including the last newline
+  int _completeLinesSize;
+  int _flushThreshold;
+  qint64 _totalDroppedBytes;
+};
+
 //! declares the stdout redirection class
 typedef struct {
   PyObject_HEAD
   PythonQtOutputChangedCB* _cb;
   int softspace;
+  //! the buffer of the buffered mode (NULL if the output is passed to the callback on each write)
+  PythonQtStdOutBuffer* _buffer;
+  //! set while the buffered output is passed to the callback
+  bool _flushing;
 } PythonQtStdOutRedirect;
 
+//! enables the buffered mode of the redirection (or disables it if \c capacity is 0),
+//! already buffered output is flushed first
+void PythonQtStdOutRedirect_setBuffering(PythonQtStdOutRedirect* self, int capacity, int flushThreshold);
+
+//! passes the buffered output to the callback (only up to the last newline if \c completeLinesOnly is set),
+//! needs to be called with the GIL held
+void PythonQtStdOutRedirect_flushBuffer(PythonQtStdOutRedirect* self, bool completeLinesOnly);
+
 #endif
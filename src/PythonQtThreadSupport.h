@@ -0,0 +1,140 @@
+#ifndef _PYTHONQTTHREADSUPPORT_H
+#define _PYTHONQTTHREADSUPPORT_H
+
+/*
+ *
+ *  Copyright (C) 2010 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtThreadSupport.h
+// \author  Florian Link
+// \author  Last changed by $Author: florian $
+// \date    2015-02
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+#include "PythonQtSystem.h"
+
+//! Global switch for the GIL handling of PythonQt, it is enabled by PythonQt::init()
+//! when the PythonQt::ThreadSupport flag is passed.
+//! If it is disabled (the default), all GIL helpers below are no-ops.
+//! Note that the thread that called PythonQt::init() holds the GIL afterwards, an application that
+//! wants to run Python on other threads while it is idle needs to release it (e.g. with PyEval_SaveThread()).
+class PYTHONQT_EXPORT PythonQtThreadSupport
+{
+public:
+  //! returns if PythonQt releases/acquires the GIL when calling into C++ or Python
+  static bool isEnabled() { return _enabled; }
+
+  //! enables/disables the GIL handling, this needs to be done before any other thread uses Python
+  static void setEnabled(bool flag) { _enabled = flag; }
+
+private:
+  static bool _enabled;
+};
+
+//! Ensures that the current thread holds the GIL for the lifetime of the scope object.
+//! This needs to be used whenever C++ code that may run on an arbitrary thread
+//! (signal receivers, virtual overrides of shell classes, callbacks) calls into Python.
+//! Nesting is allowed, if the GIL is already held by the current thread, this is cheap.
+class PYTHONQT_EXPORT PythonQtGILScope
+{
+public:
+  PythonQtGILScope() {
+    _ensured = PythonQtThreadSupport::isEnabled();
+    if (_ensured) {
+      _state = PyGILState_Ensure();
+    }
+  }
+
+  ~PythonQtGILScope() { release(); }
+
+  //! releases the GIL before the end of the scope
+  void release() {
+    if (_ensured) {
+      PyGILState_Release(_state);
+      _ensured = false;
+    }
+  }
+
+private:
+  PyGILState_STATE _state;
+  bool _ensured;
+};
+
+//! Releases the GIL for the lifetime of the scope object, so that other threads can run
+//! Python code while the current thread executes (potentially long running) C++ code.
+//! The current thread must hold the GIL when the object is created and
+//! must not touch any Python object until the GIL is restored.
+class PYTHONQT_EXPORT PythonQtThreadStateSaver
+{
+public:
+  //! releases the GIL if \c releaseGIL is true (and thread support is enabled)
+  explicit PythonQtThreadStateSaver(bool releaseGIL = true) {
+    _state = NULL;
+    if (releaseGIL) {
+      save();
+    }
+  }
+
+  ~PythonQtThreadStateSaver() { restore(); }
+
+  //! releases the GIL (if thread support is enabled)
+  void save() {
+    if (!_state && PythonQtThreadSupport::isEnabled()) {
+      _state = PyEval_SaveThread();
+    }
+  }
+
+  //! reacquires the GIL (if it was released by this object)
+  void restore() {
+    if (_state) {
+      PyEval_RestoreThread(_state);
+      _state = NULL;
+    }
+  }
+
+  //! returns if the GIL is currently released by this object
+  bool isSaved() const { return _state!=NULL; }
+
+private:
+  PyThreadState* _state;
+};
+
+//! convenience macro to hold the GIL until the end of the current scope
+#define PYTHONQT_GIL_SCOPE PythonQtGILScope internalGILScope;
+
+//! convenience macro to release the GIL until the end of the current scope
+#define PYTHONQT_ALLOW_THREADS_SCOPE PythonQtThreadStateSaver internalThreadStateSaver;
+
+#endif
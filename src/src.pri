@@ -11,8 +11,11 @@ HEADERS +=                    \
   $$PWD/PythonQtClassInfo.h         \
   $$PWD/PythonQtImporter.h          \
   $$PWD/PythonQtObjectPtr.h         \
+  $$PWD/PythonQtProfiler.h          \
+  $$PWD/PythonQtCodeCache.h         \
   $$PWD/PythonQtSignal.h            \
   $$PWD/PythonQtSlot.h              \
+  $$PWD/PythonQtDirectCall.h        \
   $$PWD/PythonQtStdIn.h             \
   $$PWD/PythonQtStdOut.h            \
   $$PWD/PythonQtMisc.h              \
@@ -28,8 +31,13 @@ HEADERS +=                    \
   $$PWD/PythonQtVariants.h          \
   $$PWD/gui/PythonQtScriptingConsole.h    \
   $$PWD/PythonQtSystem.h \
+  $$PWD/PythonQtThreadSupport.h \
   $$PWD/PythonQtUtils.h \
-  $$PWD/PythonQtBoolResult.h
+  $$PWD/PythonQtBoolResult.h \
+  $$PWD/PythonQtByteArrayBuffer.h \
+  $$PWD/PythonQtSequenceView.h \
+  $$PWD/PythonQtNumericBuffer.h \
+  $$PWD/PythonQtEventLoop.h
   
 SOURCES +=                    \
   $$PWD/PythonQtStdDecorators.cpp   \
@@ -37,10 +45,13 @@ SOURCES +=                    \
   $$PWD/PythonQtClassInfo.cpp       \
   $$PWD/PythonQtImporter.cpp        \
   $$PWD/PythonQtObjectPtr.cpp       \
+  $$PWD/PythonQtProfiler.cpp        \
+  $$PWD/PythonQtCodeCache.cpp       \
   $$PWD/PythonQtStdIn.cpp           \
   $$PWD/PythonQtStdOut.cpp          \
   $$PWD/PythonQtSignal.cpp          \
   $$PWD/PythonQtSlot.cpp            \
+  $$PWD/PythonQtDirectCall.cpp      \
   $$PWD/PythonQtMisc.cpp            \
   $$PWD/PythonQtMethodInfo.cpp      \
   $$PWD/PythonQtConversion.cpp      \
@@ -49,6 +60,10 @@ SOURCES +=                    \
   $$PWD/PythonQtQFileImporter.cpp   \
   $$PWD/PythonQtClassWrapper.cpp    \
   $$PWD/PythonQtBoolResult.cpp      \
+  $$PWD/PythonQtByteArrayBuffer.cpp \
+  $$PWD/PythonQtSequenceView.cpp    \
+  $$PWD/PythonQtNumericBuffer.cpp   \
+  $$PWD/PythonQtEventLoop.cpp       \
   $$PWD/gui/PythonQtScriptingConsole.cpp \
 
 
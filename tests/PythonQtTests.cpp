@@ -40,6 +40,10 @@
 //----------------------------------------------------------------------------------
 
 #include "PythonQtTests.h"
+#include "PythonQtClassInfo.h"
+#include "PythonQtConversion.h"
+#include "PythonQtInstanceWrapper.h"
+#include "PythonQtDirectCall.h"
 
 void PythonQtTestSlotCalling::initTestCase()
 {
@@ -71,6 +75,10 @@ void* polymorphic_ClassB_Handler(const void* ptr, const char** className) {
   return NULL;
 }
 
+int polymorphic_ClassB_Discriminator(const void* ptr) {
+  return ((ClassB*)ptr)->type();
+}
+
 void PythonQtTestSlotCalling::testInheritance() {
   PythonQt::self()->registerCPPClass("ClassA",NULL,NULL, PythonQtCreateObject<ClassAWrapper>);
   PythonQt::self()->registerCPPClass("ClassB",NULL,NULL, PythonQtCreateObject<ClassBWrapper>);
@@ -118,14 +126,41 @@ void PythonQtTestSlotCalling::testInheritance() {
   QVERIFY(_helper->runScript("if type(obj.createClassDAsA())==PythonQt.private.ClassA: obj.setPassed();\n"));
   QVERIFY(_helper->runScript("if type(obj.createClassDAsB())==PythonQt.private.ClassB: obj.setPassed();\n"));
 
-  PythonQt::self()->addPolymorphicHandler("ClassB", polymorphic_ClassB_Handler);
+  PythonQt::self()->addPolymorphicHandler("ClassB", polymorphic_ClassB_Handler, polymorphic_ClassB_Discriminator);
 
-  QVERIFY(_helper->runScript("if type(obj.getClassBPtr(obj.createClassB()))==PythonQt.private.ClassB: obj.setPassed();\n"));
-  QVERIFY(_helper->runScript("if type(obj.createClassCAsB())==PythonQt.private.ClassC: obj.setPassed();\n"));
-  QVERIFY(_helper->runScript("if type(obj.createClassDAsB())==PythonQt.private.ClassD: obj.setPassed();\n"));
+  // the second pass uses the downcasts that were cached per type() value (including the pointer offset of ClassC)
+  for (int i = 0; i < 2; i++) {
+    QVERIFY(_helper->runScript("if type(obj.getClassBPtr(obj.createClassB()))==PythonQt.private.ClassB: obj.setPassed();\n"));
+    QVERIFY(_helper->runScript("c = obj.createClassCAsB()\nif type(c)==PythonQt.private.ClassC and c.getZ()==3 and c.getY()==2: obj.setPassed();\n"));
+    QVERIFY(_helper->runScript("if type(obj.createClassDAsB())==PythonQt.private.ClassD: obj.setPassed();\n"));
+  }
 
 }
 
+void PythonQtTestSlotCalling::testOverrideLookup()
+{
+  PythonQt::self()->registerCPPClass("ClassA",NULL,NULL, PythonQtCreateObject<ClassAWrapper>);
+  PythonQtObjectPtr main = PythonQt::self()->getMainModule();
+  main.evalScript("class OverrideMixin(object): pass\n"
+                  "class OverrideDerived(PythonQt.private.ClassA, OverrideMixin): pass\n"
+                  "overrideObject = OverrideDerived()\n");
+  PythonQtObjectPtr object = main.getVariable("overrideObject");
+  QVERIFY(object && PyObject_TypeCheck(object.object(), &PythonQtInstanceWrapper_Type));
+  PythonQtInstanceWrapper* wrapper = (PythonQtInstanceWrapper*)object.object();
+  int overrideIndex = PythonQtInstanceWrapper_overrideIndex("testOverride");
+  PythonQtObjectPtr name;
+  name.setNewRef(PyString_FromString("testOverride"));
+  QVERIFY(!PythonQtInstanceWrapper_findOverride(wrapper, overrideIndex, name));
+
+  // the cached override bits of the subclass are invalidated when a plain Python base class is modified
+  main.evalScript("OverrideMixin.testOverride = lambda self: 42\n");
+  PythonQtObjectPtr method;
+  method.setNewRef(PythonQtInstanceWrapper_findOverride(wrapper, overrideIndex, name));
+  QVERIFY(method);
+  main.evalScript("del OverrideMixin.testOverride\n");
+  QVERIFY(!PythonQtInstanceWrapper_findOverride(wrapper, overrideIndex, name));
+}
+
 void PythonQtTestSlotCalling::testAutoConversion() {
   QVERIFY(_helper->runScript("if obj.setAutoConvertColor(PythonQt.QtCore.Qt.red)==PythonQt.Qt.QColor(PythonQt.QtCore.Qt.red): obj.setPassed();\n"));
   QVERIFY(_helper->runScript("if obj.setAutoConvertBrush(PythonQt.QtCore.Qt.red)==PythonQt.Qt.QBrush(PythonQt.QtCore.Qt.red): obj.setPassed();\n"));
@@ -152,6 +187,27 @@ void PythonQtTestSlotCalling::testOverloadedCall()
   QVERIFY(_helper->runScript("obj.overload(('test','test2')); obj.setPassed();\n", 4));
   QVERIFY(_helper->runScript("obj.overload(obj); obj.setPassed();\n", 5));
   QVERIFY(_helper->runScript("obj.overload(12,13); obj.setPassed();\n", 6));
+
+  // repeated calls are dispatched via the overload cache and still select the same overloads
+  PythonQtSlotInfo* slot = PythonQt::priv()->getClassInfo(_helper->metaObject())->member("overload")._slot;
+  QVERIFY(slot);
+  int hits = slot->overloadCacheHits();
+  QVERIFY(_helper->runScript("obj.overload(12.5); obj.setPassed();\n", 1));
+  QVERIFY(_helper->runScript("obj.overload(12); obj.setPassed();\n", 2));
+  QVERIFY(_helper->runScript("obj.overload(True); obj.setPassed();\n", 0));
+  QVERIFY(_helper->runScript("obj.overload(obj); obj.setPassed();\n", 5));
+  QVERIFY(_helper->runScript("obj.overload(12,13); obj.setPassed();\n", 6));
+  QCOMPARE(slot->overloadCacheHits(), hits + 5);
+}
+
+void PythonQtTestSlotCalling::testValueDependentOverloadedCall()
+{
+  // the cached overload for a large integer must not be used for small integers and vice versa
+  QVERIFY(_helper->runScript("obj.rangeOverload(2**40); obj.setPassed();\n", 1));
+  QVERIFY(_helper->runScript("obj.rangeOverload(12); obj.setPassed();\n", 0));
+  QVERIFY(_helper->runScript("obj.rangeOverload(2**40); obj.setPassed();\n", 1));
+  QVERIFY(_helper->runScript("obj.rangeOverload(-2**40); obj.setPassed();\n", 1));
+  QVERIFY(_helper->runScript("obj.rangeOverload(-12); obj.setPassed();\n", 0));
 }
 
 void PythonQtTestSlotCalling::testPyObjectSlotCall()
@@ -177,6 +233,118 @@ void PythonQtTestSlotCalling::testCPPSlotCalls()
   QVERIFY(_helper->runScript("if obj.getQColor5()==PythonQt.QtGui.QColor(1,2,3): obj.setPassed();\n"));
 }
 
+void PythonQtTestSlotCalling::testByteArrayZeroCopy()
+{
+  QVERIFY(_helper->runScript("if obj.getQByteArray(bytearray(b'abc')).data()==b'abc': obj.setPassed();\n"));
+
+  PythonQtConv::setByteArrayZeroCopyEnabled(true);
+  QVERIFY(_helper->runScript("b = obj.getQByteArray(b'abc')\nif isinstance(b, memoryview) and b.readonly and b.tobytes()==b'abc': obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("if obj.getQByteArray(bytearray(b'xyz')).tobytes()==b'xyz': obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("if obj.getQByteArray(memoryview(b'mem')).tobytes()==b'mem': obj.setPassed();\n"));
+
+  // signals are not called with the shared data, since queued connections keep a copy of the arguments
+  QObject::connect(_helper, SIGNAL(byteArraySignal(const QByteArray&)), _helper, SLOT(storeQByteArray(const QByteArray&)), Qt::QueuedConnection);
+  QVERIFY(_helper->runScript("obj.byteArraySignal(b'queued' + b'signal')\nobj.setPassed()\n"));
+  PythonQt::self()->evalScript(PythonQt::self()->getMainModule(), "import gc\ngc.collect()\nb = b'x' * 11\n");
+  QCoreApplication::processEvents();
+  QCOMPARE(_helper->storedQByteArray(), QByteArray("queuedsignal"));
+  QObject::disconnect(_helper, SIGNAL(byteArraySignal(const QByteArray&)), _helper, SLOT(storeQByteArray(const QByteArray&)));
+  PythonQtConv::setByteArrayZeroCopyEnabled(false);
+}
+
+void PythonQtTestSlotCalling::testProfiler()
+{
+  PythonQt::self()->resetProfilerStats();
+  PythonQt::self()->setProfilingEnabled(true);
+  QVERIFY(_helper->runScript("obj.getInt(1)\nobj.getInt(2)\nobj.intProp = 3\nif obj.intProp == 3: obj.setPassed();\n"));
+  PythonQt::self()->setProfilingEnabled(false);
+
+  QHash<QByteArray, PythonQtProfilerStats> stats;
+  Q_FOREACH(const PythonQtProfilerStats& s, PythonQt::self()->profilerStats()) {
+    stats.insert(s.name, s);
+  }
+  QCOMPARE(stats.value("PythonQtTestSlotCallingHelper::getInt(int)").calls, (qint64)2);
+  QCOMPARE(stats.value("PythonQtTestSlotCallingHelper::setProperty(intProp)").calls, (qint64)1);
+  QCOMPARE(stats.value("PythonQtTestSlotCallingHelper::getProperty(intProp)").calls, (qint64)1);
+  QVERIFY(stats.value("PythonQtTestSlotCallingHelper::getInt(int)").totalTime >= stats.value("PythonQtTestSlotCallingHelper::getInt(int)").cppTime);
+
+  QVERIFY(_helper->runScript("stats = PythonQt.profilerStats()\nif [s['calls'] for s in stats if s['name'] == 'PythonQtTestSlotCallingHelper::getInt(int)'] == [2]: obj.setPassed();\n"));
+  PythonQt::self()->resetProfilerStats();
+  QVERIFY(PythonQt::self()->profilerStats().isEmpty());
+}
+
+void PythonQtTestSlotCalling::testMemberLookupCache()
+{
+  // interned names hit the cache on repeated access, non-interned names use the name based lookup
+  QVERIFY(_helper->runScript("obj.intProp = 7\nvalues = [obj.intProp for i in range(3)]\nif values == [7, 7, 7] and getattr(obj, ''.join(['int', 'Prop'])) == 7: obj.setPassed();\n"));
+  // attributes set in the instance dict and Python methods still take precedence
+  QVERIFY(_helper->runScript("obj.customAttr = 3\nif obj.customAttr == 3 and obj.className() == 'PythonQtTestSlotCallingHelper': obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("try:\n  obj.noSuchMember\nexcept AttributeError:\n  obj.setPassed()\n"));
+}
+
+void PythonQtTestSlotCalling::testInlineValueCopies()
+{
+  PythonQtObjectPtr main = PythonQt::self()->getMainModule();
+  main.evalScript("inlineColors = [obj.getQColor1(PythonQt.QtGui.QColor(i,2,3)) for i in range(10)]\ninlineColor = inlineColors[5]\n");
+  PythonQtObjectPtr color = PythonQt::self()->lookupObject(main, "inlineColor");
+  QVERIFY(color && PyObject_TypeCheck(color.object(), &PythonQtInstanceWrapper_Type));
+  PythonQtInstanceWrapper* wrapper = (PythonQtInstanceWrapper*)color.object();
+#if( QT_VERSION >= QT_VERSION_CHECK(5,0,0) )
+  // QColor is small enough to be stored inside of the wrapper, unless the storage is not aligned for its size
+  QVERIFY(wrapper->_useInlineStorage || ((quintptr)&wrapper->_inlineStorage) % 16 != 0);
+#endif
+  QCOMPARE(((quintptr)wrapper->_wrappedPtr) % Q_ALIGNOF(QColor), (quintptr)0);
+  QCOMPARE(*(QColor*)wrapper->_wrappedPtr, QColor(5,2,3));
+  QVERIFY(_helper->runScript("if inlineColor.red() == 5 and inlineColors[9] == PythonQt.QtGui.QColor(9,2,3): obj.setPassed();\n"));
+  // calling __init__ again replaces the inline copy with a heap object
+  main.evalScript("inlineColor.__init__(7,2,3)\n");
+  QVERIFY(!wrapper->_useInlineStorage);
+  QCOMPARE(*(QColor*)wrapper->_wrappedPtr, QColor(7,2,3));
+  color = NULL;
+  main.evalScript("del inlineColors\ndel inlineColor\n");
+}
+
+void PythonQtTestSlotCalling::testSequenceViews()
+{
+  PythonQtConv::setSequenceViewsEnabled(true);
+  QVERIFY(_helper->runScript("v = obj.getQStringList(('a','b','c'))\nif len(v) == 3 and v[0] == 'a' and v[-1] == 'c' and v[1:] == ('b','c') and list(v) == ['a','b','c']: obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("v = obj.getQListQSize()\nif len(v) == 2 and v[1] == PythonQt.QtCore.QSize(3,4) and tuple(v) == (PythonQt.QtCore.QSize(1,2), PythonQt.QtCore.QSize(3,4)): obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("try:\n  v[2]\nexcept IndexError:\n  obj.setPassed()\n"));
+
+  // deleted QObjects in a view of pointers are returned as None
+  QObject* first = new QObject;
+  QObject* second = new QObject;
+  second->setObjectName("second");
+  _helper->setQObjectListProp(QObjectList() << first << second);
+  QVERIFY(_helper->runScript("v = obj.qObjectListProp\nobj.setPassed()\n"));
+  delete first;
+  QVERIFY(_helper->runScript("if len(v) == 2 and v[0] is None and v[1].objectName == 'second': obj.setPassed();\n"));
+  _helper->setQObjectListProp(QObjectList());
+  delete second;
+  PythonQtConv::setSequenceViewsEnabled(false);
+  QVERIFY(_helper->runScript("if obj.getQStringList(('a','b'))==('a','b'): obj.setPassed();\n"));
+}
+
+void PythonQtTestSlotCalling::testNumericBuffers()
+{
+  PythonQtConv::setNumericBuffersEnabled(true);
+  QVERIFY(_helper->runScript("v = obj.getQListdouble()\nif isinstance(v, memoryview) and v.format == 'd' and v.tolist() == [1.1,2.2,3.3]: obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("if obj.getQListInt().tolist() == [1,2,3] and len(obj.getQVectordouble([])) == 0: obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("import array\nv = obj.getQVectordouble(array.array('d', [0.5, 1.5, 2.5]))\nif v.tolist() == [0.5, 1.5, 2.5] and obj.getQVectordouble(v).tolist() == [0.5, 1.5, 2.5]: obj.setPassed();\n"));
+  PythonQtConv::setNumericBuffersEnabled(false);
+  QVERIFY(_helper->runScript("if obj.getQListqint64(array.array('q', [4, 5])) == (4, 5): obj.setPassed();\n"));
+  // buffers with another element type are converted element by element
+  QVERIFY(_helper->runScript("if obj.getQVectordouble(array.array('i', [1, 2])) == (1.0, 2.0): obj.setPassed();\n"));
+}
+
+void PythonQtTestSlotCalling::testOperators()
+{
+  // the operator slots are cached per class, nested operator calls must not share the argument tuple
+  QVERIFY(_helper->runScript("s = PythonQt.QtCore.QSize(0,0)\nfor i in range(10):\n  s = s + PythonQt.QtCore.QSize(1,2)\ns += PythonQt.QtCore.QSize(1,1)\n"
+                             "if s == PythonQt.QtCore.QSize(11,21) and s != PythonQt.QtCore.QSize(0,0) and (s - s) + s == s: obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("if PythonQt.QtGui.QColor(1,2,3) == PythonQt.QtGui.QColor(1,2,3) and PythonQt.QtGui.QColor(1,2,3) != PythonQt.QtGui.QColor(3,2,1): obj.setPassed();\n"));
+}
+
 void PythonQtTestSlotCalling::testPODSlotCalls()
 {
   QVERIFY(_helper->runScript("if obj.getBool(False)==False: obj.setPassed();\n"));
@@ -251,9 +419,62 @@ void PythonQtTestSlotCalling::testObjectSlotCalls()
   QVERIFY(_helper->runScript("if obj.getQWidget(obj)==obj: obj.setPassed();\n"));
 }
 
+int PQCppObjectDecorator::_directCallCount = 0;
+
+// the direct calls as the generator writes them with --direct-calls
+static PyObject* PQCppObjectDecorator_getHPlus_1(PythonQtDirectCallContext& context, QObject* decorator, void* object, PyObject* args)
+{
+  Q_UNUSED(args);
+  PQCppObjectDecorator::_directCallCount++;
+  PyObject* result = NULL;
+  context.enter();
+  try {
+    PythonQtThreadStateSaver threadStateSaver(context.releaseGIL());
+    int r = static_cast<PQCppObjectDecorator*>(decorator)->getHPlus(static_cast<PQCppObject*>(object));
+    threadStateSaver.restore();
+    context.leave();
+    result = PythonQtDirectReturnValue(context, r);
+  } catch (std::exception& e) {
+    context.leave();
+    context.setException(e);
+  }
+  return result;
+}
+
+static PyObject* PQCppObjectDecorator_getHPlus_2(PythonQtDirectCallContext& context, QObject* decorator, void* object, PyObject* args)
+{
+  PQCppObjectDecorator::_directCallCount++;
+  PythonQtDirectArgument<int > a0;
+  if (!a0.convert(context, args, 0)) return NULL;
+  PyObject* result = NULL;
+  context.enter();
+  try {
+    PythonQtThreadStateSaver threadStateSaver(context.releaseGIL());
+    int r = static_cast<PQCppObjectDecorator*>(decorator)->getHPlus(static_cast<PQCppObject*>(object), a0.value());
+    threadStateSaver.restore();
+    context.leave();
+    result = PythonQtDirectReturnValue(context, r);
+  } catch (std::exception& e) {
+    context.leave();
+    context.setException(e);
+  }
+  return result;
+}
+
+const PythonQtDirectCallEntry* PQCppObjectDecorator::directCalls()
+{
+  static const PythonQtDirectCallEntry entries[] = {
+    {"getHPlus(PQCppObject*)", PQCppObjectDecorator_getHPlus_1},
+    {"getHPlus(PQCppObject*, int)", PQCppObjectDecorator_getHPlus_2},
+    {NULL, NULL}
+  };
+  return entries;
+}
+
 void PythonQtTestSlotCalling::testCppFactory()
 {
   PythonQtTestCppFactory* f = new PythonQtTestCppFactory;
+  PythonQt::priv()->registerDirectCalls(&PQCppObjectDecorator::staticMetaObject, PQCppObjectDecorator::directCalls());
   PythonQt::self()->addInstanceDecorators(new PQCppObjectDecorator);
   // do not register, since we want to know if that works as well
   //qRegisterMetaType<PQCppObjectNoWrap>("PQCppObjectNoWrap");
@@ -262,6 +483,11 @@ void PythonQtTestSlotCalling::testCppFactory()
   PythonQt::self()->addWrapperFactory(f);
   QVERIFY(_helper->runScript("if obj.createPQCppObject(12).getHeight()==12: obj.setPassed();\n"));
   QVERIFY(_helper->runScript("if obj.createPQCppObject(12).getH()==12: obj.setPassed();\n"));
+  // getHPlus() is called via the registered direct calls (one per number of arguments)
+  QVERIFY(_helper->runScript("if obj.createPQCppObject(12).getHPlus()==13 and obj.createPQCppObject(12).getHPlus(5)==17: obj.setPassed();\n"));
+  QCOMPARE(PQCppObjectDecorator::_directCallCount, 2);
+  // arguments that do not match are reported as for qt_metacall
+  QVERIFY(_helper->runScript("try:\n  obj.createPQCppObject(12).getHPlus('a')\nexcept ValueError:\n  obj.setPassed()\n"));
   QVERIFY(_helper->runScript("pq1 = obj.createPQCppObject(12);\n"
     "pq2 = obj.createPQCppObject(13);\n"
     "pq3 = obj.getPQCppObject(pq1);\n"
@@ -335,6 +561,60 @@ void PythonQtTestSlotCalling::testProperties()
   QVERIFY(_helper->runScript("obj.sizeProp = PythonQt.QtCore.QSize(1,2)\nif obj.sizeProp == PythonQt.QtCore.QSize(1,2): obj.setPassed();\n"));
 }
 
+void PythonQtTestSlotCalling::testBulkProperties()
+{
+  QVERIFY(_helper->runScript("obj.setProperties({'intProp': 12, 'floatProp': 1.5, 'variantProp': 'test'})\n"
+    "if obj.getProperties(['intProp', 'floatProp', 'variantProp']) == {'intProp': 12, 'floatProp': 1.5, 'variantProp': 'test'}: obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("props = obj.getProperties()\nif props['intProp'] == 12 and 'objectName' in props: obj.setPassed();\n"));
+  // nothing is written if one of the properties is unknown
+  QVERIFY(_helper->runScript("try:\n  obj.setProperties({'intProp': 13, 'noSuchProp': 1})\nexcept AttributeError:\n  if obj.intProp == 12: obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("try:\n  obj.getProperties(['intProp', 'noSuchProp'])\nexcept AttributeError:\n  if obj.intProp == 12: obj.setPassed();\n"));
+
+  QVariantMap values;
+  values["intProp"] = 21;
+  values["floatProp"] = 2.5;
+  QVERIFY(PythonQt::self()->setProperties(_helper, values));
+  QVariantMap result = PythonQt::self()->getProperties(_helper, QStringList() << "intProp" << "floatProp");
+  QCOMPARE(result.value("intProp").toInt(), 21);
+  QCOMPARE(result.value("floatProp").toFloat(), 2.5f);
+
+  // nothing is written if one of the values does not fit, the error is reported like Python errors
+  values["intProp"] = 22;
+  values["sizeProp"] = QString("no size");
+  QVERIFY(!PythonQt::self()->setProperties(_helper, values));
+  QVERIFY(PythonQt::self()->hadError());
+  PythonQt::self()->clearError();
+  QCOMPARE(_helper->intProp(), 21);
+
+  // C++ members of the same name take precedence over the built-in methods
+  PythonQtTestPropertiesNameHelper nameHelper;
+  PythonQt::self()->addObject(PythonQt::self()->getMainModule(), "nameObj", &nameHelper);
+  QVERIFY(_helper->runScript("if nameObj.getProperties() == 'slot' and 'intProp' in obj.getProperties(['intProp']): obj.setPassed();\n"));
+  PythonQt::self()->getMainModule().evalScript("del nameObj\n");
+}
+
+void PythonQtTestSlotCalling::testThreadSupport()
+{
+#if PY_VERSION_HEX < 0x03070000
+  PyEval_InitThreads();
+#endif
+  PythonQtThreadSupport::setEnabled(true);
+  PythonQt::self()->getMainModule().evalScript("workerDone = False\n");
+  PythonQtTestSlotCallingThread worker;
+  worker.start();
+  // the slot calls of both threads release the GIL, so the worker runs while the main thread is in the loop
+  QVERIFY(_helper->runScript("count = 0\n"
+                             "while not workerDone:\n"
+                             "  if obj.getInt(count) != count: break\n"
+                             "  count += 1\n"
+                             "if workerDone and workerResult == 499500: obj.setPassed()\n"));
+  {
+    PythonQtThreadStateSaver threadStateSaver;
+    QVERIFY(worker.wait(10000));
+  }
+  PythonQtThreadSupport::setEnabled(false);
+}
+
 bool PythonQtTestSlotCallingHelper::runScript(const char* script, int expectedOverload)
 {
   _called = false;
@@ -410,6 +690,36 @@ void PythonQtTestSignalHandler::testRecursiveSignalHandler()
   QVERIFY(_helper->emitSignal1(12));
 }
 
+void PythonQtTestSignalHandler::testSignalHandlerBenchmark_data()
+{
+  QTest::addColumn<int>("handlerCount");
+  QTest::newRow("1 handler") << 1;
+  QTest::newRow("100 handlers") << 100;
+  QTest::newRow("10000 handlers") << 10000;
+}
+
+void PythonQtTestSignalHandler::testSignalHandlerBenchmark()
+{
+  QFETCH(int, handlerCount);
+  PythonQtObjectPtr main = PythonQt::self()->getMainModule();
+  main.evalScript("benchmarkCalls = 0\ndef benchmarkHandler(a):\n  global benchmarkCalls\n  benchmarkCalls += 1\n");
+  PythonQtObjectPtr handler = PythonQt::self()->lookupCallable(main, "benchmarkHandler");
+  QVERIFY(handler);
+
+  PythonQtTestSignalHandlerHelper helper(this);
+  for (int i = 0; i < handlerCount; i++) {
+    QVERIFY(PythonQt::self()->addSignalHandler(&helper, SIGNAL(intSignal(int)), handler));
+  }
+  helper.emitIntSignal(1);
+  QCOMPARE(main.getVariable("benchmarkCalls").toInt(), handlerCount);
+
+  QBENCHMARK {
+    helper.emitIntSignal(1);
+  }
+
+  QVERIFY(PythonQt::self()->removeSignalHandler(&helper, SIGNAL(intSignal(int)), NULL));
+}
+
 
 void PythonQtTestApi::initTestCase()
 {
@@ -530,6 +840,174 @@ void PythonQtTestApi::testImporter()
   PyRun_SimpleString("import bla\n");
 }
 
+void PythonQtTestApi::testImporterDirectoryCache()
+{
+  QDir dir(QDir::tempPath());
+  QVERIFY(dir.mkpath("PythonQtImporterCacheTest"));
+  QVERIFY(dir.cd("PythonQtImporterCacheTest"));
+  QString moduleFile = dir.absoluteFilePath("pqcachetest.py");
+  QFile::remove(moduleFile);
+  QFile::remove(moduleFile + "c");
+
+  PythonQt::self()->installDefaultImporter();
+  PythonQt::self()->setImporterDirectoryCacheEnabled(true);
+  QVERIFY(PythonQt::self()->importerDirectoryCacheEnabled());
+  PythonQt::self()->overwriteSysPath(QStringList() << dir.absolutePath());
+
+  // the module does not exist yet, the directory listing is cached
+  _main.evalScript("try:\n  import pqcachetest\n  found = True\nexcept ImportError:\n  found = False\n");
+  QVERIFY(!_main.getVariable("found").toBool());
+
+  QFile file(moduleFile);
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.write("value = 42\n");
+  file.close();
+
+  PythonQt::self()->clearImporterDirectoryCache();
+  _main.evalScript("import pqcachetest\nvalue = pqcachetest.value\n");
+  QCOMPARE(_main.getVariable("value").toInt(), 42);
+
+  // a new file changes the modification date of the directory, which refreshes the cached listing
+  QString secondModuleFile = dir.absoluteFilePath("pqcachetest2.py");
+  QFile::remove(secondModuleFile);
+  QFile::remove(secondModuleFile + "c");
+  _main.evalScript("try:\n  import pqcachetest2\n  found = True\nexcept ImportError:\n  found = False\n");
+  QVERIFY(!_main.getVariable("found").toBool());
+  QDateTime listedDate = QFileInfo(dir.absolutePath()).lastModified();
+  for (int i = 0; i < 30; i++) {
+    QFile secondFile(secondModuleFile);
+    QVERIFY(secondFile.open(QIODevice::WriteOnly));
+    secondFile.write("value = 43\n");
+    secondFile.close();
+    if (QFileInfo(dir.absolutePath()).lastModified() != listedDate) {
+      break;
+    }
+    // the file system has a coarse time resolution, try again later
+    QFile::remove(secondModuleFile);
+    QTest::qSleep(100);
+  }
+  _main.evalScript("import pqcachetest2\nvalue = pqcachetest2.value\n");
+  QCOMPARE(_main.getVariable("value").toInt(), 43);
+
+  PythonQt::self()->setImporterDirectoryCacheEnabled(false);
+  QFile::remove(moduleFile);
+  QFile::remove(moduleFile + "c");
+  QFile::remove(secondModuleFile);
+  QFile::remove(secondModuleFile + "c");
+}
+
+void PythonQtTestApi::testImporterBytecodeCache()
+{
+  QDir dir(QDir::tempPath());
+  QVERIFY(dir.mkpath("PythonQtBytecodeCacheTest"));
+  QVERIFY(dir.cd("PythonQtBytecodeCacheTest"));
+  QString moduleFile = dir.absoluteFilePath("pqbytecodetest.py");
+  QFile::remove(moduleFile);
+  QFile::remove(moduleFile + "c");
+  QDir cacheDir(dir.absoluteFilePath("cache"));
+  cacheDir.removeRecursively();
+
+  PythonQt::self()->installDefaultImporter();
+  PythonQt::self()->setImporterBytecodeCacheDirectory(cacheDir.absolutePath());
+  QCOMPARE(PythonQt::self()->importerBytecodeCacheDirectory(), cacheDir.absolutePath());
+  PythonQt::self()->overwriteSysPath(QStringList() << dir.absolutePath());
+
+  QFile file(moduleFile);
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.write("value = 42\n");
+  file.close();
+
+  _main.evalScript("import pqbytecodetest\nvalue = pqbytecodetest.value\n");
+  QCOMPARE(_main.getVariable("value").toInt(), 42);
+  QCOMPARE(cacheDir.entryList(QDir::Files).count(), 1);
+
+  // the cached code is used when the module is imported again: to prove that the source is not compiled again,
+  // the code in the cache entry is replaced by code that sets another value (keeping the magic number and source hash)
+  QFile::remove(moduleFile + "c");
+  _main.addVariable("cacheFile", cacheDir.absoluteFilePath(cacheDir.entryList(QDir::Files).first()));
+  _main.addVariable("moduleFile", moduleFile);
+  _main.evalScript("import marshal\n"
+                   "f = open(cacheFile, 'rb')\nheader = f.read(24)\nf.close()\n"
+                   "f = open(cacheFile, 'wb')\nf.write(header + marshal.dumps(compile('value = 99\\n', moduleFile, 'exec')))\nf.close()\n");
+  _main.evalScript("import sys\ndel sys.modules['pqbytecodetest']\nimport pqbytecodetest\nvalue = pqbytecodetest.value\n");
+  QCOMPARE(_main.getVariable("value").toInt(), 99);
+
+  // a changed source is compiled again
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.write("value = 43\n");
+  file.close();
+  QFile::remove(moduleFile + "c");
+  _main.evalScript("del sys.modules['pqbytecodetest']\nimport pqbytecodetest\nvalue = pqbytecodetest.value\n");
+  QCOMPARE(_main.getVariable("value").toInt(), 43);
+  QCOMPARE(cacheDir.entryList(QDir::Files).count(), 1);
+
+  PythonQt::self()->setImporterBytecodeCacheDirectory(QString());
+  QFile::remove(moduleFile);
+  QFile::remove(moduleFile + "c");
+  cacheDir.removeRecursively();
+}
+
+void PythonQtTestApi::testLazyClassRegistration()
+{
+  PythonQt::self()->setLazyClassRegistrationEnabled(true);
+  if (!PythonQt::self()->lazyClassRegistrationEnabled()) {
+    // not supported by this Python version
+    return;
+  }
+  PythonQt::self()->registerCPPClass("PythonQtTestLazyClassA", NULL, "LazyTest");
+  PythonQt::self()->registerCPPClass("PythonQtTestLazyClassB", NULL, "LazyTest");
+  PythonQt::self()->setLazyClassRegistrationEnabled(false);
+
+  PythonQtClassInfo* infoA = PythonQt::priv()->getClassInfo("PythonQtTestLazyClassA");
+  PythonQtClassInfo* infoB = PythonQt::priv()->getClassInfo("PythonQtTestLazyClassB");
+  QVERIFY(infoA && infoA->isPythonQtClassWrapperPending());
+  QVERIFY(infoB && infoB->isPythonQtClassWrapperPending());
+
+  // attribute access creates only the accessed class
+  _main.evalScript("from PythonQt import LazyTest\nlazyName = LazyTest.PythonQtTestLazyClassA.__name__\n");
+  QCOMPARE(_main.getVariable("lazyName").toString(), QString("PythonQtTestLazyClassA"));
+  QVERIFY(!infoA->isPythonQtClassWrapperPending());
+  QVERIFY(infoB->isPythonQtClassWrapperPending());
+
+  // star imports see all classes
+  _main.evalScript("from PythonQt.LazyTest import *\nlazyName = PythonQtTestLazyClassB.__name__\n");
+  QCOMPARE(_main.getVariable("lazyName").toString(), QString("PythonQtTestLazyClassB"));
+  QVERIFY(!infoB->isPythonQtClassWrapperPending());
+}
+
+void PythonQtTestApi::testCodeCache()
+{
+  PythonQt::self()->purgeCodeCache();
+  QCOMPARE(PythonQt::self()->codeCacheHits(), 0);
+  QCOMPARE(PythonQt::self()->codeCacheMisses(), 0);
+
+  for (int i = 0; i < 3; i++) {
+    QCOMPARE(_main.evalScript("1+2", Py_eval_input).toInt(), 3);
+  }
+  QCOMPARE(PythonQt::self()->codeCacheMisses(), 1);
+  QCOMPARE(PythonQt::self()->codeCacheHits(), 2);
+
+  // the same source with a different start token is compiled again
+  _main.evalScript("1+2", Py_single_input);
+  QCOMPARE(PythonQt::self()->codeCacheMisses(), 2);
+
+#ifdef PY3K
+  // the script is compiled as UTF-8
+  QString euro(QChar(0x20AC));
+  QCOMPARE(_main.evalScript("'" + euro + "'", Py_eval_input).toString(), euro);
+#endif
+
+  // a disabled cache compiles the script each time
+  int size = PythonQt::self()->codeCacheSize();
+  PythonQt::self()->setCodeCacheSize(0);
+  PythonQt::self()->purgeCodeCache();
+  _main.evalScript("1+2", Py_eval_input);
+  _main.evalScript("1+2", Py_eval_input);
+  QCOMPARE(PythonQt::self()->codeCacheHits(), 0);
+  QCOMPARE(PythonQt::self()->codeCacheMisses(), 2);
+  PythonQt::self()->setCodeCacheSize(size);
+}
+
 void PythonQtTestApi::testQtNamespace()
 {
   QVERIFY(_main.getVariable("PythonQt.QtCore.Qt.red").toInt()==Qt::red);
@@ -547,6 +1025,84 @@ void PythonQtTestApi::testConnects()
   //TODO: add signal/slot connect both with QObject.connect and connect
 }
 
+void PythonQtTestApi::testAsyncioEventLoop()
+{
+  if (!PythonQt::self()->installAsyncioEventLoop()) {
+#if QT_VERSION >= QT_VERSION_CHECK(5,0,0)
+    QSKIP("asyncio event loop is not supported by this Python version");
+#else
+    QSKIP("asyncio event loop is not supported by this Python version", SkipSingle);
+#endif
+  }
+  _main.evalScript("import asyncio\n"
+                   "loop = asyncio.get_event_loop()\n"
+                   "async def sleeper():\n"
+                   "  await asyncio.sleep(0.01)\n"
+                   "  return 42\n"
+                   "sleepResult = loop.run_until_complete(sleeper())\n");
+  QCOMPARE(_main.getVariable("sleepResult").toInt(), 42);
+  QVERIFY(_main.evalScript("isinstance(loop, PythonQt.eventloop.QtEventLoop)", Py_eval_input).toBool());
+
+#if QT_VERSION >= QT_VERSION_CHECK(5,0,0)
+  // signals are awaitable
+  _main.evalScript("async def rename():\n"
+                   "  await asyncio.sleep(0)\n"
+                   "  obj.objectName = 'renamedByCoroutine'\n"
+                   "async def waitForRename():\n"
+                   "  loop.create_task(rename())\n"
+                   "  return await obj.objectNameChanged\n"
+                   "signalResult = loop.run_until_complete(waitForRename())\n");
+  QCOMPARE(_main.getVariable("signalResult").toString(), QString("renamedByCoroutine"));
+#endif
+
+  // the loop is also dispatched by the application's event loop
+  _main.evalScript("async def setFlag():\n"
+                   "  global flag\n"
+                   "  flag = True\n"
+                   "flag = False\n"
+                   "loop.create_task(setFlag())\n");
+  for (int i = 0; i < 100 && !_main.getVariable("flag").toBool(); i++) {
+    QCoreApplication::processEvents();
+  }
+  QVERIFY(_main.getVariable("flag").toBool());
+
+  // other threads wake up the loop via its self-pipe
+  _main.evalScript("import threading\n"
+                   "def setThreadFlag():\n"
+                   "  global threadFlag\n"
+                   "  threadFlag = True\n"
+                   "threadFlag = False\n"
+                   "thread = threading.Thread(target=lambda: loop.call_soon_threadsafe(setThreadFlag))\n"
+                   "thread.start()\n"
+                   "thread.join()\n");
+  for (int i = 0; i < 100 && !_main.getVariable("threadFlag").toBool(); i++) {
+    QCoreApplication::processEvents();
+    QTest::qSleep(1);
+  }
+  QVERIFY(_main.getVariable("threadFlag").toBool());
+}
+
+void PythonQtTestApi::testStringConversion()
+{
+  QStringList strings;
+  strings << QString() << "" << "ascii" << QString::fromUtf8("Latin-1 \xc3\xa4\xc3\xb6\xc3\xbc")
+          << QString::fromUtf8("UCS-2 \xe2\x82\xac \xe4\xb8\xad") << QString::fromUtf8("UCS-4 \xf0\x9f\x98\x80 pair");
+  Q_FOREACH(const QString& str, strings) {
+    PythonQtObjectPtr pyStr;
+    pyStr.setNewRef(PythonQtConv::QStringToPyObject(str));
+    QVERIFY(pyStr);
+    QCOMPARE(PythonQtConv::PyObjGetString(pyStr), str.isNull() ? QString("") : str);
+    _main.addVariable("convertedString", QVariant(str));
+    QCOMPARE(_main.evalScript("len(convertedString)", Py_eval_input).toInt(), str.toUcs4().size());
+  }
+#ifdef PY3K
+  // python strings of each kind are converted to QString
+  QCOMPARE(_main.evalScript("'\\xe4' * 3", Py_eval_input).toString(), QString(3, QChar(0xe4)));
+  QCOMPARE(_main.evalScript("'\\u20ac' * 3", Py_eval_input).toString(), QString(3, QChar(0x20ac)));
+  QCOMPARE(_main.evalScript("'\\U0001f600'", Py_eval_input).toString(), QString::fromUtf8("\xf0\x9f\x98\x80"));
+#endif
+}
+
 void PythonQtTestApi::testQColorDecorators()
 {
   PythonQtObjectPtr colorClass = _main.getVariable("PythonQt.QtGui.QColor");
@@ -611,6 +1167,59 @@ void PythonQtTestApi::testRedirect()
   PyRun_SimpleString("print('test')\n");
 }
 
+void PythonQtTestApi::testBufferedRedirect()
+{
+  PythonQt::self()->setRedirectStdOutBuffering(64, 32, 0);
+  QSignalSpy spy(PythonQt::self(), SIGNAL(pythonStdOut(const QString&)));
+
+  // incomplete lines are buffered
+  PyRun_SimpleString("import sys\nsys.stdout.write('a')\nsys.stdout.write('b')\n");
+  QCOMPARE(spy.count(), 0);
+  // complete lines are emitted at once
+  PyRun_SimpleString("sys.stdout.write('c\\nd')\n");
+  QCOMPARE(spy.count(), 1);
+  QCOMPARE(spy.at(0).at(0).toString(), QString("abc\n"));
+  PyRun_SimpleString("sys.stdout.flush()\n");
+  QCOMPARE(spy.count(), 2);
+  QCOMPARE(spy.at(1).at(0).toString(), QString("d"));
+
+  // output that is larger than the buffer is emitted as a whole after the buffered output
+  PyRun_SimpleString("sys.stdout.write('ab')\nsys.stdout.write('x' * 100)\n");
+  QCOMPARE(spy.count(), 4);
+  QCOMPARE(spy.at(2).at(0).toString(), QString("ab"));
+  QCOMPARE(spy.at(3).at(0).toString(), QString(100, 'x'));
+  QCOMPARE(PythonQt::self()->droppedStdOutBytes(), (qint64)0);
+
+  // output written while the buffered output is emitted is dropped if it does not fit
+  PyRun_SimpleString("def stdOutHandler(text):\n"
+                     "  if text == 'full\\n':\n"
+                     "    sys.stdout.write('y' * 100)\n"
+#ifdef PY3K
+                     "  elif text == 'utf\\n':\n"
+                     "    sys.stdout.write('y' * 63 + '\\u00e4')\n"
+#endif
+                     );
+  PythonQtObjectPtr handler = PythonQt::self()->lookupObject(PythonQt::self()->getMainModule(), "stdOutHandler");
+  QVERIFY(PythonQt::self()->addSignalHandler(PythonQt::self(), SIGNAL(pythonStdOut(const QString&)), handler));
+  PyRun_SimpleString("sys.stdout.write('full\\n')\n");
+  QCOMPARE(spy.count(), 5);
+  QCOMPARE(PythonQt::self()->droppedStdOutBytes(), (qint64)36);
+  PythonQt::self()->flushStdOut();
+  QCOMPARE(spy.count(), 6);
+  QCOMPARE(spy.at(5).at(0).toString(), QString(64, 'y'));
+#ifdef PY3K
+  // multi-byte UTF-8 sequences are never cut
+  PyRun_SimpleString("sys.stdout.write('utf\\n')\n");
+  QCOMPARE(PythonQt::self()->droppedStdOutBytes(), (qint64)38);
+  PythonQt::self()->flushStdOut();
+  QCOMPARE(spy.count(), 8);
+  QCOMPARE(spy.at(7).at(0).toString(), QString(63, 'y'));
+#endif
+  PythonQt::self()->removeSignalHandler(PythonQt::self(), SIGNAL(pythonStdOut(const QString&)), handler);
+
+  PythonQt::self()->setRedirectStdOutBuffering(0);
+}
+
 void PythonQtTestApiHelper::stdOut(const QString& s)
 {
   outBuf.append(s);
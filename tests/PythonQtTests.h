@@ -45,6 +45,7 @@
 #include "PythonQt.h"
 #include <QtTest/QtTest>
 #include <QVariant>
+#include <QThread>
 #include "PythonQtImportFileInterface.h"
 #include "PythonQtCppWrapperFactory.h"
 
@@ -68,7 +69,14 @@ private Q_SLOTS:
   void testCall();
   void testVariables();
   void testRedirect();
+  void testBufferedRedirect();
   void testImporter();
+  void testImporterDirectoryCache();
+  void testImporterBytecodeCache();
+  void testLazyClassRegistration();
+  void testCodeCache();
+  void testAsyncioEventLoop();
+  void testStringConversion();
   void testQColorDecorators();
   void testQtNamespace();
   void testConnects();
@@ -217,7 +225,13 @@ class PQCppObjectDecorator : public QObject {
   Q_OBJECT
 public Q_SLOTS:
   int  getH(PQCppObject* obj) { return obj->getHeight(); }
+  int  getHPlus(PQCppObject* obj, int add = 1) { return obj->getHeight() + add; }
 
+public:
+  //! the direct calls of the slots, as generated by the generator with --direct-calls
+  static const PythonQtDirectCallEntry* directCalls();
+  //! counts the calls that went through directCalls()
+  static int _directCallCount;
 };
 
 //! an cpp object to be wrapped by decorators only
@@ -326,10 +340,21 @@ private Q_SLOTS:
   void testMultiArgsSlotCall();
   void testPyObjectSlotCall();
   void testOverloadedCall();
+  void testValueDependentOverloadedCall();
   void testCppFactory();
   void testInheritance();
+  void testOverrideLookup();
   void testAutoConversion();
   void testProperties();
+  void testByteArrayZeroCopy();
+  void testProfiler();
+  void testMemberLookupCache();
+  void testInlineValueCopies();
+  void testSequenceViews();
+  void testNumericBuffers();
+  void testOperators();
+  void testBulkProperties();
+  void testThreadSupport();
 
 private:
   PythonQtTestSlotCallingHelper* _helper;
@@ -337,6 +362,24 @@ private:
 };
 
 //! helper class for slot calling test
+//! has a slot that is named like the built-in getProperties() method of wrapped objects
+class PythonQtTestPropertiesNameHelper : public QObject
+{
+  Q_OBJECT
+public Q_SLOTS:
+  QString getProperties() { return "slot"; }
+};
+
+//! calls slots from Python on a worker thread, see PythonQtTestSlotCalling::testThreadSupport()
+class PythonQtTestSlotCallingThread : public QThread
+{
+protected:
+  virtual void run() {
+    PYTHONQT_GIL_SCOPE
+    PythonQt::self()->getMainModule().evalScript("workerResult = sum([obj.getInt(i) for i in range(1000)])\nworkerDone = True\n");
+  }
+};
+
 class PythonQtTestSlotCallingHelper : public QObject
 {
   Q_OBJECT
@@ -409,6 +452,10 @@ public Q_SLOTS:
   void overload(QObject* str) { _calledOverload = 5; _called = true;}
   void overload(float a, int b) { _calledOverload = 6; _called = true;}
 
+  //! overloads that are selected depending on the integer value
+  void rangeOverload(int a) { _calledOverload = 0; _called = true;}
+  void rangeOverload(qint64 a) { _calledOverload = 1; _called = true;}
+
   //! POD values:
   int getInt(int a) {   _called = true; return a; }
   unsigned int getUInt(unsigned int a) { _called = true;  return a; }
@@ -428,6 +475,8 @@ public Q_SLOTS:
   //! important qt types:
   QString getQString(const QString& s) { _called = true;  return s; }
   QStringList getQStringList(const QStringList& l) { _called = true;  return l; }
+  //! returns a deep copy, since \c b may reference the data of a Python object
+  QByteArray getQByteArray(const QByteArray& b) { _called = true;  return QByteArray(b.constData(), b.size()); }
   QVariant getQVariant(const QVariant& var) { _called = true;  return var; }
 
   QList<int> getQListInt() { _called = true; return QList<int>() << 1 << 2 << 3; }
@@ -437,6 +486,8 @@ public Q_SLOTS:
   QList<double> getQListdouble() { _called = true; return QList<double>() << 1.1 << 2.2 << 3.3; }
   QList<quint64> getQListquint64() { _called = true; return QList<quint64>() << 1 << 2 << 3; }
   QList<qint64> getQListqint64() { _called = true; return QList<qint64>() << 1 << 2 << 3; }
+  QList<qint64> getQListqint64(const QList<qint64>& list) { _called = true; return list; }
+  QVector<double> getQVectordouble(const QVector<double>& list) { _called = true; return list; }
   //QList<GLuint64> getQListGLuint64() { _called = true; return QList<GLuint64>() << 1 << 2 << 3; }
   //QList<GLuint> getQListGLuint() { _called = true; return QList<GLuint>() << 1 << 2 << 3; }
 
@@ -517,11 +568,21 @@ public Q_SLOTS:
   QBrush  setAutoConvertBrush(const QBrush& brush) { _called = true; return brush; };
   QPen    setAutoConvertPen(const QPen& pen) { _called = true; return pen; };
   QCursor setAutoConvertCursor(const QCursor& cursor) { _called = true; return cursor; };
-  
+
+  //! keeps a copy of the byte array, connected to byteArraySignal() with a queued connection
+  void storeQByteArray(const QByteArray& b) { _storedByteArray = b; }
+
+Q_SIGNALS:
+  void byteArraySignal(const QByteArray& b);
+
+public:
+  const QByteArray& storedQByteArray() const { return _storedByteArray; }
+
 private:
   bool _passed;
   mutable bool _called;
   int  _calledOverload;
+  QByteArray _storedByteArray;
   PythonQtTestSlotCalling* _test;
 };
 
@@ -537,6 +598,8 @@ private Q_SLOTS:
 
   void testSignalHandler();
   void testRecursiveSignalHandler();
+  void testSignalHandlerBenchmark_data();
+  void testSignalHandlerBenchmark();
 
 private:
   PythonQtTestSignalHandlerHelper* _helper;